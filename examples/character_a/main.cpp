@@ -1,4 +1,6 @@
+#include "fuji/core/internal/utility/dynamic_state.hpp"
 #include "fuji/core/internal/utility/shader_module.hpp"
+#include "fuji/core/internal/utility/shader_module_registry.hpp"
 #include "fuji/core/internal/utility/vertex_shader_input_layout.hpp"
 #include <array>
 #include <cstddef>
@@ -17,18 +19,9 @@
 #include <vulkan/vulkan_core.h>
 #include <vulkan_engine.hpp>
 
+#include <fuji/core/internal/utility/memory_allocator.hpp>
 #include <fuji/core/internal/utility/shader_stage_flow.hpp>
-
-std::uint32_t findMemoryType(std::uint32_t typeFilter, vk::PhysicalDeviceMemoryProperties memoryProperties, vk::MemoryPropertyFlags properties) {
-    for(std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
-        if((typeFilter & (1 << i))
-                && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
-    }
-
-    throw std::runtime_error("failed to find suitable memory type");
-}
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
 
 struct Vertex {
     glm::vec2 pos;
@@ -37,29 +30,7 @@ struct Vertex {
 
 class Texture {
 public:
-    Texture(VulkanEngine& engine, const std::vector<glm::u8vec4>& imageData, std::uint32_t width, std::uint32_t height) {
-        vk::BufferCreateInfo imageBufferInfo {};
-        imageBufferInfo.size = sizeof(glm::vec4) * width * height;
-        imageBufferInfo.usage = vk::BufferUsageFlagBits::eTransferSrc;
-        imageBufferInfo.sharingMode = vk::SharingMode::eExclusive;
-        this->buffer = engine.getDevice()->createBufferUnique(imageBufferInfo);
-
-        vk::MemoryRequirements bufferMemoryRequirements = engine.getDevice()->getBufferMemoryRequirements(this->buffer.get());
-        vk::PhysicalDeviceMemoryProperties imageMemoryProperties = engine.getPhysicalDevice().getMemoryProperties();
-        vk::MemoryPropertyFlags imageProperties = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-        std::uint32_t imageMemoryType = findMemoryType(bufferMemoryRequirements.memoryTypeBits, imageMemoryProperties, imageProperties);
-        vk::MemoryAllocateInfo imageMemoryAllocInfo {};
-        imageMemoryAllocInfo.allocationSize = bufferMemoryRequirements.size;
-        imageMemoryAllocInfo.memoryTypeIndex = imageMemoryType;
-        this->deviceMemory = engine.getDevice()->allocateMemoryUnique(imageMemoryAllocInfo);
-        void* imageMapData;
-        engine.getDevice()->bindBufferMemory(this->buffer.get(), this->deviceMemory.get(), 0);
-        if(engine.getDevice()->mapMemory(this->deviceMemory.get(), 0, imageBufferInfo.size, vk::MemoryMapFlags { 0 }, &imageMapData) != vk::Result::eSuccess) {
-            throw std::runtime_error("failed to map memory to vertex buffer");
-        }
-        std::memcpy(imageMapData, imageData.data(), imageBufferInfo.size);
-        engine.getDevice()->unmapMemory(this->deviceMemory.get());
-
+    Texture(VulkanEngine& engine, fuji::core::utility::MemoryAllocator& allocator, fuji::core::utility::UploadScheduler& uploadScheduler, const std::vector<glm::u8vec4>& imageData, std::uint32_t width, std::uint32_t height) {
         vk::ImageCreateInfo imageInfo {};
         imageInfo.imageType = vk::ImageType::e2D;
         imageInfo.extent.width = width;
@@ -74,22 +45,17 @@ public:
         imageInfo.sharingMode = vk::SharingMode::eExclusive;
         imageInfo.samples = vk::SampleCountFlagBits::e1;
         imageInfo.flags = vk::ImageCreateFlags { 0 };
-        this->image = engine.getDevice()->createImageUnique(imageInfo);
+        this->image = allocator.createImage(imageInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
 
-        vk::MemoryRequirements imageMemoryRequirements = engine.getDevice()->getImageMemoryRequirements(this->image.get());
-        vk::MemoryAllocateInfo imageAllocInfo {};
-        imageAllocInfo.allocationSize = imageMemoryRequirements.size;
-        imageAllocInfo.memoryTypeIndex = findMemoryType(imageMemoryRequirements.memoryTypeBits, imageMemoryProperties, vk::MemoryPropertyFlagBits::eDeviceLocal);
-        this->imageMemory = engine.getDevice()->allocateMemoryUnique(imageAllocInfo);
-
-        engine.getDevice()->bindImageMemory(this->image.get(), this->imageMemory.get(), 0);
-
-        this->transitionImageLayout(engine, this->image.get(), vk::Format::eR8G8B8A8Srgb, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
-        this->copyBufferToImage(engine, this->buffer.get(), this->image.get(), width, height);
-        this->transitionImageLayout(engine, this->image.get(), vk::Format::eR8G8B8A8Srgb, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal);
+        fuji::core::utility::ImageUploadRegion region {};
+        region.data = imageData.data();
+        region.size = sizeof(glm::u8vec4) * imageData.size();
+        region.offset = vk::Offset3D { 0, 0, 0 };
+        region.extent = vk::Extent3D { width, height, 1 };
+        uploadScheduler.uploadImage(this->image.image.get(), region, vk::ImageLayout::eUndefined);
 
         vk::ImageViewCreateInfo viewInfo {};
-        viewInfo.image = this->image.get();
+        viewInfo.image = this->image.image.get();
         viewInfo.viewType = vk::ImageViewType::e2D;
         viewInfo.format = vk::Format::eR8G8B8A8Srgb;
         viewInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
@@ -121,7 +87,7 @@ public:
     ~Texture() = default;
 
     vk::Image& getImage() {
-        return image.get();
+        return image.image.get();
     }
 
     vk::ImageView& getImageView() {
@@ -132,114 +98,9 @@ public:
         return sampler.get();
     }
 private:
-    vk::UniqueBuffer buffer;
-    vk::UniqueDeviceMemory deviceMemory;
-    vk::UniqueDeviceMemory imageMemory;
-    vk::UniqueImage image;
+    fuji::core::utility::AllocatedImage image;
     vk::UniqueImageView imageView;
     vk::UniqueSampler sampler;
-private:
-    std::vector<vk::UniqueCommandBuffer> beginSingleTimeCommands(VulkanEngine& engine) {
-        vk::CommandBufferAllocateInfo allocInfo {};
-        allocInfo.level = vk::CommandBufferLevel::ePrimary;
-        allocInfo.commandPool = engine.getCommandPool().get();
-        allocInfo.commandBufferCount = 1;
-
-        std::vector<vk::UniqueCommandBuffer> commandBuffers = engine.getDevice()->allocateCommandBuffersUnique(allocInfo);
-
-        vk::CommandBufferBeginInfo beginInfo {};
-        beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
-
-        commandBuffers[0]->begin(beginInfo);
-
-        return commandBuffers;
-    }
-
-    void endSingleTimeCommands(VulkanEngine& engine, std::vector<vk::UniqueCommandBuffer> commandBuffers) {
-        commandBuffers[0]->end();
-
-        vk::SubmitInfo submitInfo {};
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &commandBuffers[0].get();
-
-        engine.getGraphicsQueue().submit({ submitInfo }, VK_NULL_HANDLE);
-        engine.getGraphicsQueue().waitIdle();
-    }
-
-    void transitionImageLayout(VulkanEngine& engine, vk::Image image, vk::Format format, vk::ImageLayout oldLayout, vk::ImageLayout newLayout) {
-        std::vector<vk::UniqueCommandBuffer> commandBuffers = this->beginSingleTimeCommands(engine);
-
-        vk::ImageMemoryBarrier barrier {};
-        barrier.oldLayout = oldLayout;
-        barrier.newLayout = newLayout;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.image = this->image.get();
-        barrier.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
-        barrier.subresourceRange.baseMipLevel = 0;
-        barrier.subresourceRange.levelCount = 1;
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount = 1;
-
-        vk::PipelineStageFlags sourceStage;
-        vk::PipelineStageFlags destinationStage;
-        if(oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eTransferDstOptimal) {
-            barrier.srcAccessMask = vk::AccessFlags { 0 };
-            barrier.dstAccessMask = vk::AccessFlagBits::eTransferWrite;
-
-            sourceStage = vk::PipelineStageFlagBits::eTopOfPipe;
-            destinationStage = vk::PipelineStageFlagBits::eTransfer;
-        } else if(oldLayout == vk::ImageLayout::eTransferDstOptimal && newLayout == vk::ImageLayout::eShaderReadOnlyOptimal) {
-            barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
-            barrier.dstAccessMask = vk::AccessFlagBits::eShaderRead;
-
-            sourceStage = vk::PipelineStageFlagBits::eTransfer;
-            destinationStage = vk::PipelineStageFlagBits::eFragmentShader;
-        } else {
-            throw std::runtime_error("unsupported layout transition");
-        }
-
-        commandBuffers[0]->pipelineBarrier(
-            sourceStage, destinationStage,
-            vk::DependencyFlags { 0 },
-            0, nullptr,
-            0, nullptr,
-            1, &barrier
-        );
-
-        endSingleTimeCommands(engine, std::move(commandBuffers));
-    }
-
-    void copyBufferToImage(VulkanEngine& engine, vk::Buffer buffer, vk::Image image, std::uint32_t width, std::uint32_t height) {
-        auto commandBuffers = beginSingleTimeCommands(engine);
-
-        vk::BufferImageCopy region {};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-        
-        region.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = 1;
-
-        region.imageOffset = vk::Offset3D { 0, 0, 0 };
-        region.imageExtent = vk::Extent3D {
-            width,
-            height,
-            1
-        };
-
-        commandBuffers[0]->copyBufferToImage(
-            buffer, 
-            image,
-            vk::ImageLayout::eTransferDstOptimal,
-            1,
-            &region);
-
-        endSingleTimeCommands(engine, std::move(commandBuffers));
-    }
-
 };
 
 int main() {
@@ -272,7 +133,15 @@ int main() {
             }
         }
 
-        Texture texture { engine, imageData, 16, 16 };
+        fuji::core::utility::MemoryAllocator allocator { engine.getPhysicalDevice(), engine.getDevice().get() };
+        fuji::core::utility::UploadScheduler uploadScheduler {
+            engine.getPhysicalDevice(),
+            allocator,
+            engine.getGraphicsQueueFamilyIndex(),
+            engine.getTransferQueueFamilyIndex()
+        };
+        Texture texture { engine, allocator, uploadScheduler, imageData, 16, 16 };
+        uploadScheduler.wait(uploadScheduler.flush(engine.getTransferQueue()));
 
         std::vector<Vertex> vertices = {
             { glm::vec2(-0.5, 0.5), glm::vec2(0, 1) },
@@ -284,23 +153,8 @@ int main() {
         positionBufferInfo.size = sizeof(Vertex) * vertices.size();
         positionBufferInfo.usage = vk::BufferUsageFlagBits::eVertexBuffer;
         positionBufferInfo.sharingMode = vk::SharingMode::eExclusive;
-        vk::UniqueBuffer positionBuffer = engine.getDevice()->createBufferUnique(positionBufferInfo);
-
-        vk::MemoryRequirements memoryRequirements = engine.getDevice()->getBufferMemoryRequirements(positionBuffer.get());
-        vk::PhysicalDeviceMemoryProperties memoryProperties = engine.getPhysicalDevice().getMemoryProperties();
-        vk::MemoryPropertyFlags properties = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-        std::uint32_t memoryType = findMemoryType(memoryRequirements.memoryTypeBits, memoryProperties, properties);
-        vk::MemoryAllocateInfo memoryAllocInfo {};
-        memoryAllocInfo.allocationSize = memoryRequirements.size;
-        memoryAllocInfo.memoryTypeIndex = memoryType;
-        vk::UniqueDeviceMemory positionBufferMemory = engine.getDevice()->allocateMemoryUnique(memoryAllocInfo);
-        engine.getDevice()->bindBufferMemory(positionBuffer.get(), positionBufferMemory.get(), 0);
-        void* mapData;
-        if(engine.getDevice()->mapMemory(positionBufferMemory.get(), 0, positionBufferInfo.size, vk::MemoryMapFlags { 0 }, &mapData) != vk::Result::eSuccess) {
-            throw std::runtime_error("failed to map memory to vertex buffer");
-        }
-        std::memcpy(mapData, vertices.data(), positionBufferInfo.size);
-        engine.getDevice()->unmapMemory(positionBufferMemory.get());
+        fuji::core::utility::AllocatedBuffer positionBuffer = allocator.createBuffer(positionBufferInfo, vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+        std::memcpy(positionBuffer.allocation->mappedData, vertices.data(), positionBufferInfo.size);
 
         std::array<vk::DescriptorPoolSize, 1> poolSizes {};
         poolSizes[0].type = vk::DescriptorType::eCombinedImageSampler;
@@ -349,14 +203,11 @@ int main() {
         descriptorWrites[0].pImageInfo = &imageInfo;
         engine.getDevice()->updateDescriptorSets(descriptorWrites, {});
 
-        std::ifstream vert_fin { TEXTURE_VERT_SPV_FILE, std::ios::in | std::ios::binary };
-        std::vector<char> vert_code { std::istreambuf_iterator<char>{ vert_fin }, std::istreambuf_iterator<char> {} };
-        std::ifstream frag_fin { TEXTURE_FRAG_SPV_FILE, std::ios::in | std::ios::binary };
-        std::vector<char> frag_code { std::istreambuf_iterator<char>{ frag_fin }, std::istreambuf_iterator<char> {} };
+        fuji::core::utility::ShaderModuleRegistry shaderModuleRegistry { engine.getDevice().get() };
 
         std::vector<fuji::core::utility::ShaderModule> shaderModules;
-        shaderModules.emplace_back(engine.getDevice().get(), vert_code, vk::ShaderStageFlagBits::eVertex);
-        shaderModules.emplace_back(engine.getDevice().get(), frag_code, vk::ShaderStageFlagBits::eFragment);
+        shaderModules.push_back(shaderModuleRegistry.acquire(TEXTURE_VERT_SPV_FILE, vk::ShaderStageFlagBits::eVertex));
+        shaderModules.push_back(shaderModuleRegistry.acquire(TEXTURE_FRAG_SPV_FILE, vk::ShaderStageFlagBits::eFragment));
 
         fuji::core::utility::ShaderStageFlow shaderStageFlow {
             std::move(shaderModules),
@@ -371,31 +222,16 @@ int main() {
         inputAssembly.topology = vk::PrimitiveTopology::eTriangleStrip;
         inputAssembly.primitiveRestartEnable = VK_FALSE;
 
-        vk::Viewport viewport {
-            0.0f, 0.0f,
-            static_cast<float>(engine.getSwapchainExtent().width), 
-            static_cast<float>(engine.getSwapchainExtent().height),
-            0.0f, 1.0f
-        };
-
-        vk::Rect2D scissor {
-            { 0, 0 },
-            engine.getSwapchainExtent()
-        };
-
-        std::vector<vk::DynamicState> dynamicStates = {
-            vk::DynamicState::eViewport,
-            vk::DynamicState::eScissor
-        };
+        std::vector<vk::DynamicState> dynamicStates = fuji::core::utility::DynamicStateRecorder::getDynamicStates({});
         vk::PipelineDynamicStateCreateInfo dynamicState {};
-        // dynamicState.dynamicStateCount = dynamicStates.size();
-        // dynamicState.pDynamicStates = dynamicStates.data();
+        dynamicState.dynamicStateCount = dynamicStates.size();
+        dynamicState.pDynamicStates = dynamicStates.data();
 
         vk::PipelineViewportStateCreateInfo viewportState {};
         viewportState.viewportCount = 1;
-        viewportState.pViewports = &viewport;
+        viewportState.pViewports = nullptr;
         viewportState.scissorCount = 1;
-        viewportState.pScissors = &scissor;
+        viewportState.pScissors = nullptr;
 
         vk::PipelineRasterizationStateCreateInfo rasterizer {};
         rasterizer.depthClampEnable = VK_FALSE;
@@ -509,29 +345,20 @@ int main() {
             throw std::runtime_error("failed to create GraphicsPipeline");
         }
 
-        vk::CommandBufferAllocateInfo allocInfo {};
-        allocInfo.commandPool = engine.getCommandPool().get();
-        allocInfo.level = vk::CommandBufferLevel::ePrimary;
-        allocInfo.commandBufferCount = 1;
-
-        auto commandBuffers = engine.getDevice()->allocateCommandBuffersUnique(allocInfo);
-
-
         std::vector<vk::DescriptorSet> copiedDescriptorSets = {
             descriptorSets[0].get()
         };
 
         engine.setCommandBufferRecorder([
-            &commandBuffer = commandBuffers[0].get(),
             &renderPass = renderPass.get(),
             &graphicsPipeline = graphicsPipeline[0].get(),
             extent = engine.getSwapchainExtent(),
-            &positionBuffer = positionBuffer.get(),
+            &positionBuffer = positionBuffer.buffer.get(),
             &descriptorSets = copiedDescriptorSets,
-            &pipelineLayout = pipelineLayout
-        ](vk::Framebuffer framebuffer) {
-            vk::CommandBufferBeginInfo beginInfo {};
-            commandBuffer.begin(beginInfo);
+            &pipelineLayout = pipelineLayout,
+            &uploadScheduler
+        ](vk::CommandBuffer& commandBuffer, vk::Framebuffer& framebuffer) {
+            uploadScheduler.recordAcquireBarriers(commandBuffer);
 
             vk::RenderPassBeginInfo renderPassInfo {};
             renderPassInfo.renderPass = renderPass;
@@ -548,19 +375,19 @@ int main() {
             commandBuffer.beginRenderPass(renderPassInfo, vk::SubpassContents::eInline);
                 commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, graphicsPipeline);
 
-                // vk::Viewport viewport {
-                //     0.0f, 0.0f,
-                //     static_cast<float>(extent.width),
-                //     static_cast<float>(extent.height),
-                //     0.0f, 1.0f
-                // };
-                // commandBuffer.setViewport(0, { viewport });
+                vk::Viewport viewport {
+                    0.0f, 0.0f,
+                    static_cast<float>(extent.width),
+                    static_cast<float>(extent.height),
+                    0.0f, 1.0f
+                };
+                commandBuffer.setViewport(0, { viewport });
 
-                // vk::Rect2D scissor {
-                //     vk::Offset2D { 0, 0 },
-                //     extent
-                // };
-                // commandBuffer.setScissor(0, { scissor });
+                vk::Rect2D scissor {
+                    vk::Offset2D { 0, 0 },
+                    extent
+                };
+                commandBuffer.setScissor(0, { scissor });
 
                 commandBuffer.bindVertexBuffers(0, { positionBuffer }, { 0 });
 
@@ -569,15 +396,13 @@ int main() {
                 commandBuffer.draw(4, 1, 0, 0);
 
             commandBuffer.endRenderPass();
-
-            commandBuffer.end();
         });
 
         engine.setupRenderTarget(renderPass.get());
 
         while(glfwWindowShouldClose(window) == GLFW_FALSE) {
             glfwPollEvents();
-            engine.drawFrame(commandBuffers[0].get());
+            engine.drawFrame();
         }
 
         engine.getDevice()->waitIdle();
@@ -31,7 +31,7 @@ namespace {
 }
 
 
-VulkanEngine::VulkanEngine(std::string applicationName) : applicationName(std::move(applicationName)) {
+VulkanEngine::VulkanEngine(std::string applicationName, std::uint32_t framesInFlight) : applicationName(std::move(applicationName)), framesInFlight(framesInFlight) {
 
 }
 
@@ -70,49 +70,30 @@ void VulkanEngine::initialize(GLFWwindow* window) {
     this->graphicsQueue = this->device->getQueue(graphicsQueueIndex, 0);
     auto [presentQueueFamily, presentQueueIndex] = findPresentQueueFamility(this->physicalDevice).value();
     this->presentQueue = this->device->getQueue(presentQueueIndex, 0);
+    this->transferQueue = this->device->getQueue(this->getTransferQueueFamilyIndex(), 0);
     this->swapchain = this->createSwapchain();
     this->swapchainImageViews = this->createImageViews();
 
-    this->imageAvailableSemaphore = this->createImageAvailableSemaphore();
-    this->renderFinishedSemaphore = this->createRenderFinishedSemaphore();
-    this->inFlightFence = this->createInFlightFence();
-
     this->commandPool = this->createCommandPool();
+    this->frameRing = std::make_unique<fuji::core::utility::FrameRing>(this->device.get(), graphicsQueueIndex, this->framesInFlight);
 
     this->initialized = true;
 }
 
-void VulkanEngine::drawFrame(vk::CommandBuffer& commandBuffer) {
-    auto result = this->device->waitForFences({ this->inFlightFence.get() }, VK_TRUE, 5000000000L);
-    if(result != vk::Result::eSuccess) {
-        throw std::runtime_error("failed to wait fence");
-    }
-    this->device->resetFences({ this->inFlightFence.get() });
+void VulkanEngine::drawFrame() {
+    fuji::core::utility::FrameSlot& slot = this->frameRing->acquire();
 
-    auto [result1, imageIndex] = this->device->acquireNextImageKHR(swapchain.get(), UINT64_MAX, this->imageAvailableSemaphore.get(), VK_NULL_HANDLE);
-    if(result1 != vk::Result::eSuccess) {
+    auto [result, imageIndex] = this->device->acquireNextImageKHR(swapchain.get(), UINT64_MAX, slot.imageAvailableSemaphore.get(), VK_NULL_HANDLE);
+    if(result != vk::Result::eSuccess) {
         throw std::runtime_error("failed to acquire next image");
     }
 
-    commandBuffer.reset();
-    recorder(framebuffers[imageIndex].get());
+    recorder(slot.commandBuffer.get(), framebuffers[imageIndex].get());
 
-    vk::SubmitInfo submitInfo {};
-
-    vk::Semaphore waitSemaphores[] = { imageAvailableSemaphore.get() };
+    vk::Semaphore waitSemaphores[] = { slot.imageAvailableSemaphore.get() };
     vk::PipelineStageFlags waitStages[] = { vk::PipelineStageFlagBits::eColorAttachmentOutput };
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &commandBuffer;
-
-    vk::Semaphore signalSemaphores[] = { renderFinishedSemaphore.get() };
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = signalSemaphores;
-
-    graphicsQueue.submit({ submitInfo }, inFlightFence.get());
+    vk::Semaphore signalSemaphores[] = { slot.renderFinishedSemaphore.get() };
+    this->frameRing->submit(graphicsQueue, waitSemaphores, waitStages, signalSemaphores);
 
     vk::PresentInfoKHR presentInfo{};
     presentInfo.waitSemaphoreCount = 1;
@@ -133,7 +114,7 @@ void VulkanEngine::setupRenderTarget(vk::RenderPass renderPass) {
     this->framebuffers = this->createFramebuffers(renderPass);
 }
 
-void VulkanEngine::setCommandBufferRecorder(std::function<void (vk::Framebuffer&)> recorder) {
+void VulkanEngine::setCommandBufferRecorder(std::function<void (vk::CommandBuffer&, vk::Framebuffer&)> recorder) {
     this->recorder = recorder;
 }
 
@@ -161,6 +142,10 @@ vk::UniqueCommandPool& VulkanEngine::getCommandPool() {
     return this->commandPool;
 }
 
+fuji::core::utility::FrameRing& VulkanEngine::getFrameRing() {
+    return *this->frameRing;
+}
+
 const vk::Format& VulkanEngine::getFormat() const {
     return swapchainImageFormat;
 }
@@ -173,6 +158,18 @@ vk::Queue& VulkanEngine::getGraphicsQueue() {
     return this->graphicsQueue;
 }
 
+vk::Queue& VulkanEngine::getTransferQueue() {
+    return this->transferQueue;
+}
+
+std::uint32_t VulkanEngine::getGraphicsQueueFamilyIndex() {
+    return findGraphicsQueueFamility(this->physicalDevice).value().second;
+}
+
+std::uint32_t VulkanEngine::getTransferQueueFamilyIndex() {
+    return fuji::core::utility::UploadScheduler::findTransferQueueFamily(this->physicalDevice, this->getGraphicsQueueFamilyIndex());
+}
+
 vk::UniqueShaderModule VulkanEngine::createShaderModule(const std::vector<char> &code) {
     vk::ShaderModuleCreateInfo createInfo {};
     createInfo.codeSize = code.size();
@@ -221,6 +218,7 @@ vk::UniqueDevice VulkanEngine::createDevice() {
     std::set<std::uint32_t> uniqueQueueFamilies = {
         findGraphicsQueueFamility(this->physicalDevice).value().second,
         findPresentQueueFamility(this->physicalDevice).value().second,
+        this->getTransferQueueFamilyIndex(),
     };
 
     float queuePriority = 1.0f;
@@ -233,11 +231,14 @@ vk::UniqueDevice VulkanEngine::createDevice() {
     }
 
     vk::PhysicalDeviceFeatures physicalDeviceFeatures;
+    vk::PhysicalDeviceVulkan12Features vulkan12Features {};
+    vulkan12Features.timelineSemaphore = VK_TRUE;
 
     auto extensions = this->getRequiredDeviceExtensions();
     std::vector<const char*> cstrExtensions;
     std::transform(extensions.begin(), extensions.end(), std::back_inserter(cstrExtensions), [](auto& s) { return s.c_str(); });
     vk::DeviceCreateInfo deviceCreateInfo;
+    deviceCreateInfo.pNext = &vulkan12Features;
     deviceCreateInfo.pQueueCreateInfos = queueCreateInfos.data();
     deviceCreateInfo.queueCreateInfoCount = queueCreateInfos.size();
     deviceCreateInfo.pEnabledFeatures = &physicalDeviceFeatures;
@@ -394,29 +395,6 @@ vk::UniqueCommandPool VulkanEngine::createCommandPool() {
     return this->device->createCommandPoolUnique(poolInfo);
 }
 
-vk::UniqueSemaphore VulkanEngine::createImageAvailableSemaphore() {
-    assert(this->device.get() != static_cast<vk::Device>(nullptr));
-
-    vk::SemaphoreCreateInfo semaphoreInfo {};
-    return this->device->createSemaphoreUnique(semaphoreInfo);
-}
-
-vk::UniqueSemaphore VulkanEngine::createRenderFinishedSemaphore() {
-    assert(this->device.get() != static_cast<vk::Device>(nullptr));
-
-    vk::SemaphoreCreateInfo semaphoreInfo {};
-    return this->device->createSemaphoreUnique(semaphoreInfo);
-}
-
-vk::UniqueFence VulkanEngine::createInFlightFence() {
-    assert(this->device.get() != static_cast<vk::Device>(nullptr));
-
-    vk::FenceCreateInfo fenceInfo {};
-    fenceInfo.flags = vk::FenceCreateFlagBits::eSignaled;
-    return this->device->createFenceUnique(fenceInfo);
-}
-
-
 vk::PhysicalDevice VulkanEngine::choosePhysicalDevice() {
     assert(this->instance.get() != static_cast<vk::Instance>(nullptr));
 
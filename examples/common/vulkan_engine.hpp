@@ -1,7 +1,9 @@
 #ifndef FUJI_EXAMPLE_COMMON_VULKAN_ENGINE_HPP
 #define FUJI_EXAMPLE_COMMON_VULKAN_ENGINE_HPP
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <optional>
 #include <utility>
@@ -10,6 +12,9 @@
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
 
+#include <fuji/core/internal/utility/frame_ring.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+
 #define NDEBUG 1
 
 struct SwapchainSupportDetails {
@@ -20,21 +25,25 @@ struct SwapchainSupportDetails {
 
 class VulkanEngine {
 public:
-    VulkanEngine(std::string applicationName);
+    VulkanEngine(std::string applicationName, std::uint32_t framesInFlight = 2);
     void initialize(GLFWwindow* window);
     void setupRenderTarget(vk::RenderPass renderPass);
-    void setCommandBufferRecorder(std::function<void(vk::Framebuffer&)> recorder);
+    void setCommandBufferRecorder(std::function<void(vk::CommandBuffer&, vk::Framebuffer&)> recorder);
     bool isInitialized();
-    void drawFrame(vk::CommandBuffer& commandBuffer);
+    void drawFrame();
 
     vk::UniqueInstance& getInstance();
     vk::PhysicalDevice& getPhysicalDevice();
     vk::UniqueDevice& getDevice();
     vk::UniqueSurfaceKHR& getSurface();
     vk::UniqueCommandPool& getCommandPool();
+    fuji::core::utility::FrameRing& getFrameRing();
     const vk::Format& getFormat() const;
     const vk::Extent2D& getSwapchainExtent() const;
     vk::Queue& getGraphicsQueue();
+    vk::Queue& getTransferQueue();
+    std::uint32_t getGraphicsQueueFamilyIndex();
+    std::uint32_t getTransferQueueFamilyIndex();
 
     vk::UniqueShaderModule createShaderModule(const std::vector<char>& code);
 private:
@@ -44,6 +53,7 @@ private:
     vk::UniqueDevice device;
     vk::Queue graphicsQueue;
     vk::Queue presentQueue;
+    vk::Queue transferQueue;
     vk::UniqueSurfaceKHR surface;
     vk::UniqueSwapchainKHR swapchain;
     std::vector<vk::Image> swapchainImages;
@@ -52,10 +62,9 @@ private:
     std::vector<vk::UniqueImageView> swapchainImageViews;
     std::vector<vk::UniqueFramebuffer> framebuffers;
     vk::UniqueCommandPool commandPool;
-    vk::UniqueSemaphore imageAvailableSemaphore;
-    vk::UniqueSemaphore renderFinishedSemaphore;
-    vk::UniqueFence inFlightFence;
-    std::function<void(vk::Framebuffer&)> recorder;
+    std::uint32_t framesInFlight;
+    std::unique_ptr<fuji::core::utility::FrameRing> frameRing;
+    std::function<void(vk::CommandBuffer&, vk::Framebuffer&)> recorder;
     GLFWwindow* window;
     bool initialized = false;
 
@@ -68,9 +77,6 @@ protected:
     std::vector<vk::UniqueImageView> createImageViews();
     vk::UniqueDebugUtilsMessengerEXT createDebugMessenger();
     std::vector<vk::UniqueFramebuffer> createFramebuffers(vk::RenderPass renderPass);
-    vk::UniqueSemaphore createImageAvailableSemaphore();
-    vk::UniqueSemaphore createRenderFinishedSemaphore();
-    vk::UniqueFence createInFlightFence();
     vk::UniqueCommandPool createCommandPool();
     vk::PhysicalDevice choosePhysicalDevice();
     vk::SurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<vk::SurfaceFormatKHR>& availableFormats);
@@ -1,19 +1,43 @@
 #ifndef INCLUDE_FUJI_CORE_INSTANCE_HPP
 #define INCLUDE_FUJI_CORE_INSTANCE_HPP
 
+#include <array>
+#include <cstdint>
+#include <functional>
+
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_handles.hpp>
 
+#include <fuji/core/internal/utility/dynamic_state.hpp>
+#include <fuji/core/internal/utility/frame_ring.hpp>
+
 namespace fuji {
     class Instance {
     public:
-        Instance(vk::UniqueDevice& device);
+        using Record = std::function<void(vk::CommandBuffer& commandBuffer)>;
+
+        Instance(vk::UniqueDevice& device, std::uint32_t queueFamilyIndex, vk::Format colorFormat, std::uint32_t framesInFlight = 2, core::utility::DynamicStateSupport dynamicStateSupport = {}, vk::ImageLayout finalLayout = vk::ImageLayout::ePresentSrcKHR);
         ~Instance() = default;
-        void draw(vk::UniqueFramebuffer& framebuffer);
+        const vk::RenderPass& getRenderPass() const;
+        vk::ImageLayout getFinalLayout() const noexcept;
+        core::utility::DynamicStateValues& getDynamicStateValues() noexcept;
+        core::utility::FrameRing& getFrameRing() noexcept;
+        void setClearColor(const std::array<float, 4>& clearColor) noexcept;
+        core::utility::FrameSlot& beginFrame();
+        void beginRenderPass(vk::CommandBuffer& commandBuffer, vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent);
+        void bindPipeline(vk::CommandBuffer& commandBuffer, const vk::Pipeline& pipeline) const;
+        void endRenderPass(vk::CommandBuffer& commandBuffer) const;
+        void draw(vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent, const Record& record = {});
+        void draw(vk::CommandBuffer& commandBuffer, vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent, const Record& record = {});
+        void endFrame(const vk::Queue& queue, vk::ArrayProxy<const vk::Semaphore> waitSemaphores = {}, vk::ArrayProxy<const vk::PipelineStageFlags> waitStages = {}, vk::ArrayProxy<const vk::Semaphore> signalSemaphores = {});
     private:
+        vk::UniqueDevice& device;
+        core::utility::FrameRing frameRing;
+        core::utility::DynamicStateRecorder dynamicStateRecorder;
+        core::utility::DynamicStateValues dynamicStateValues;
+        std::array<float, 4> clearColor;
+        vk::ImageLayout finalLayout;
         vk::UniqueRenderPass renderPass;
-        vk::UniquePipeline pipeline;
-        vk::UniquePipelineLayout pipelineLayout;
     };
 }
 
@@ -0,0 +1,58 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_BINDLESS_IMAGE_TABLE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_BINDLESS_IMAGE_TABLE_HPP
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "fuji/core/internal/utility/buddy_allocator.hpp"
+
+namespace fuji::core::utility {
+    // A single descriptor set whose binding 0 is a partially bound, update-after-bind array of sampled images
+    // (VK_EXT_descriptor_indexing, core in Vulkan 1.2). Images are addressed by slot index, so draws sampling
+    // different images share one bound set. Slots are handed out in contiguous ranges and a removed range is
+    // recycled only after the frame that removed it has completed. The capacity may not exceed getMaxCapacity().
+    // Ranges come from a buddy allocator and occupy the next power of two of slots, so five image views reserve
+    // eight; getReservedCount() reports the slots taken including that rounding.
+    class BindlessImageTable {
+    public:
+        BindlessImageTable(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, std::uint32_t capacity = 4096, vk::ShaderStageFlags stageFlags = vk::ShaderStageFlagBits::eFragment);
+        BindlessImageTable(const BindlessImageTable&) = delete;
+        ~BindlessImageTable() = default;
+        void beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber);
+        std::uint32_t add(vk::ArrayProxy<const vk::ImageView> imageViews, vk::ImageLayout imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal);
+        void update(std::uint32_t index, const vk::ImageView& imageView, vk::ImageLayout imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal);
+        void remove(std::uint32_t firstIndex);
+        const vk::DescriptorSetLayout& getDescriptorSetLayout() const;
+        const vk::DescriptorSet& getDescriptorSet() const;
+        std::uint32_t getCapacity() const noexcept;
+        std::uint32_t getUsedCount() const noexcept;
+        std::uint32_t getReservedCount() const noexcept;
+        std::size_t getPendingRemovalCount() const noexcept;
+
+        static bool isSupported(const vk::PhysicalDevice& physicalDevice);
+        static std::uint32_t getMaxCapacity(const vk::PhysicalDevice& physicalDevice);
+        static vk::PhysicalDeviceDescriptorIndexingFeatures getRequiredFeatures() noexcept;
+    private:
+        struct PendingRemoval {
+            std::uint32_t firstIndex;
+            std::uint64_t frameNumber;
+        };
+    private:
+        void write(std::uint32_t firstIndex, vk::ArrayProxy<const vk::ImageView> imageViews, vk::ImageLayout imageLayout);
+    private:
+        vk::Device device;
+        std::uint32_t capacity;
+        std::uint64_t frameNumber;
+        BuddyAllocator slotAllocator;
+        vk::UniqueDescriptorSetLayout descriptorSetLayout;
+        vk::UniqueDescriptorPool descriptorPool;
+        vk::DescriptorSet descriptorSet;
+        std::map<std::uint32_t, std::uint32_t> allocatedRanges;
+        std::vector<PendingRemoval> pendingRemovals;
+    };
+}
+
+#endif
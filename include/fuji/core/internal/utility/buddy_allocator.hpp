@@ -0,0 +1,39 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_BUDDY_ALLOCATOR_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_BUDDY_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace fuji::core::utility {
+    class BuddyAllocator {
+    public:
+        BuddyAllocator(std::uint64_t size, std::uint64_t minimumBlockSize = 256);
+        std::optional<std::uint64_t> allocate(std::uint64_t size, std::uint64_t alignment = 1);
+        void free(std::uint64_t offset);
+        std::uint64_t getSize() const noexcept;
+        std::uint64_t getAllocatedBytes() const noexcept;
+        std::uint64_t getRequestedBytes() const noexcept;
+        std::uint64_t getLargestFreeBlock() const noexcept;
+        std::size_t getAllocationCount() const noexcept;
+        bool isEmpty() const noexcept;
+    private:
+        struct AllocatedBlock {
+            std::uint32_t level;
+            std::uint64_t requestedSize;
+        };
+    private:
+        std::uint64_t getBlockSize(std::uint32_t level) const noexcept;
+    private:
+        std::uint64_t size;
+        std::uint64_t minimumBlockSize;
+        std::vector<std::set<std::uint64_t>> freeBlocks;
+        std::unordered_map<std::uint64_t, AllocatedBlock> allocatedBlocks;
+        std::uint64_t allocatedBytes;
+        std::uint64_t requestedBytes;
+    };
+}
+
+#endif
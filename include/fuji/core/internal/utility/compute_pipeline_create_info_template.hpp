@@ -0,0 +1,33 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_COMPUTE_PIPELINE_CREATE_INFO_TEMPLATE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_COMPUTE_PIPELINE_CREATE_INFO_TEMPLATE_HPP
+
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "fuji/core/internal/utility/pipeline_cache.hpp"
+#include "fuji/core/internal/utility/shader_module.hpp"
+#include "fuji/core/internal/utility/specialization_constants.hpp"
+
+namespace fuji::core::utility {
+    class ComputePipelineCreateInfoTemplate {
+    public:
+        ComputePipelineCreateInfoTemplate(ShaderModule shaderModule, const vk::PipelineLayout& pipelineLayout);
+        virtual ~ComputePipelineCreateInfoTemplate() = default;
+        vk::ComputePipelineCreateInfo getCreateInfo() const noexcept;
+        const ShaderModule& getShaderModule() const noexcept;
+        void setSpecializationConstants(const SpecializationConstants& constants);
+        const SpecializationConstants& getSpecializationConstants() const noexcept;
+
+        static std::vector<vk::UniquePipeline> createComputePipeline(vk::Device& device, vk::ArrayProxy<std::unique_ptr<ComputePipelineCreateInfoTemplate>> computePipelineCreateInfos);
+        static std::vector<vk::UniquePipeline> createComputePipeline(vk::Device& device, PipelineCache& pipelineCache, vk::ArrayProxy<std::unique_ptr<ComputePipelineCreateInfoTemplate>> computePipelineCreateInfos);
+    private:
+        ShaderModule shaderModule;
+        vk::PipelineLayout pipelineLayout;
+        SpecializationConstants specializationConstants;
+        vk::SpecializationInfo specializationInfo;
+    };
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_DYNAMIC_STATE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_DYNAMIC_STATE_HPP
+
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    struct DynamicStateSupport {
+        bool extendedDynamicState = false;
+        bool colorBlendEnable = false;
+    };
+
+    struct DynamicStateValues {
+        vk::Viewport viewport;
+        vk::Rect2D scissor;
+        vk::CullModeFlags cullMode = vk::CullModeFlagBits::eNone;
+        vk::FrontFace frontFace = vk::FrontFace::eCounterClockwise;
+        vk::PrimitiveTopology primitiveTopology = vk::PrimitiveTopology::eTriangleList;
+        bool blendEnable = false;
+
+        void setExtent(vk::Extent2D extent) noexcept;
+    };
+
+    class DynamicStateRecorder {
+    public:
+        DynamicStateRecorder(const vk::Device& device, DynamicStateSupport support);
+        const DynamicStateSupport& getSupport() const noexcept;
+        void record(vk::CommandBuffer& commandBuffer, const DynamicStateValues& values) const;
+
+        static std::vector<vk::DynamicState> getDynamicStates(const DynamicStateSupport& support);
+    private:
+        DynamicStateSupport support;
+        PFN_vkCmdSetCullMode cmdSetCullMode;
+        PFN_vkCmdSetFrontFace cmdSetFrontFace;
+        PFN_vkCmdSetPrimitiveTopology cmdSetPrimitiveTopology;
+        PFN_vkCmdSetColorBlendEnableEXT cmdSetColorBlendEnable;
+    };
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_FRAME_RING_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_FRAME_RING_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    struct FrameSlot {
+        vk::UniqueCommandPool commandPool;
+        vk::UniqueCommandBuffer commandBuffer;
+        vk::UniqueFence inFlightFence;
+        vk::UniqueSemaphore imageAvailableSemaphore;
+        vk::UniqueSemaphore renderFinishedSemaphore;
+        std::vector<vk::UniqueBuffer> transientBuffers;
+        std::vector<vk::UniqueDeviceMemory> transientMemories;
+        std::uint64_t frameNumber = 0;
+    };
+
+    class FrameRing {
+    public:
+        FrameRing(const vk::Device& device, std::uint32_t queueFamilyIndex, std::uint32_t framesInFlight = 2);
+        FrameRing(const FrameRing&) = delete;
+        ~FrameRing();
+        FrameSlot& acquire();
+        void submit(const vk::Queue& queue, vk::ArrayProxy<const vk::Semaphore> waitSemaphores = {}, vk::ArrayProxy<const vk::PipelineStageFlags> waitStages = {}, vk::ArrayProxy<const vk::Semaphore> signalSemaphores = {});
+        void retain(vk::UniqueBuffer buffer);
+        void retain(vk::UniqueDeviceMemory memory);
+        bool isComplete(std::uint64_t frameNumber) const;
+        void wait(std::uint64_t frameNumber);
+        void waitIdle();
+        const vk::Device& getDevice() const noexcept;
+        FrameSlot& getCurrentSlot() noexcept;
+        std::uint32_t getCurrentIndex() const noexcept;
+        std::uint32_t getFramesInFlight() const noexcept;
+        std::uint64_t getFrameNumber() const noexcept;
+        std::uint64_t getCompletedFrameNumber() const noexcept;
+    private:
+        vk::Device device;
+        std::vector<FrameSlot> slots;
+        std::uint32_t currentIndex;
+        std::uint64_t frameNumber;
+        std::uint64_t completedFrameNumber;
+    };
+}
+
+#endif
@@ -1,23 +1,44 @@
 #ifndef INCLUDE_FUJI_CORE_UTILITY_GRAPHICS_PIPELINE_CREATE_INFO_TEMPLATE_HPP
 #define INCLUDE_FUJI_CORE_UTILITY_GRAPHICS_PIPELINE_CREATE_INFO_TEMPLATE_HPP
 
+#include <cstdint>
 #include <memory>
 
 #include <vulkan/vulkan.hpp>
 
+#include "fuji/core/internal/utility/dynamic_state.hpp"
+#include "fuji/core/internal/utility/pipeline_cache.hpp"
 #include "fuji/core/internal/utility/shader_stage_flow.hpp"
 
 namespace fuji::core::utility {
     class GraphicsPipelineCreateInfoTemplate {
     public:
-        GraphicsPipelineCreateInfoTemplate(std::unique_ptr<ShaderStageFlow> shaderStageFlow);
+        GraphicsPipelineCreateInfoTemplate(std::unique_ptr<ShaderStageFlow> shaderStageFlow, DynamicStateSupport dynamicStateSupport = {});
         virtual ~GraphicsPipelineCreateInfoTemplate() = default;
-        virtual std::vector<vk::DynamicState> getDynamicStates() const noexcept;
-        vk::GraphicsPipelineCreateInfo getCreateInfo() const noexcept;
+        virtual std::vector<vk::DynamicState> getDynamicStates() const;
+        vk::GraphicsPipelineCreateInfo getCreateInfo() const;
+        ShaderStageFlow& getShaderStageFlow() noexcept;
+        void setPipelineLayout(const vk::PipelineLayout& pipelineLayout) noexcept;
+        void setRenderPass(const vk::RenderPass& renderPass, std::uint32_t subpass = 0) noexcept;
+        void setPrimitiveTopology(vk::PrimitiveTopology primitiveTopology) noexcept;
+        void setColorBlendAttachmentState(const vk::PipelineColorBlendAttachmentState& colorBlendAttachmentState) noexcept;
 
         static std::vector<vk::UniquePipeline> createGraphicsPipeline(vk::Device& device, vk::ArrayProxy<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos);
+        static std::vector<vk::UniquePipeline> createGraphicsPipeline(vk::Device& device, PipelineCache& pipelineCache, vk::ArrayProxy<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos);
     private:
         std::unique_ptr<ShaderStageFlow> shaderStageFlow;
+        DynamicStateSupport dynamicStateSupport;
+        mutable std::vector<vk::DynamicState> dynamicStates;
+        mutable vk::PipelineDynamicStateCreateInfo dynamicStateCreateInfo;
+        vk::PipelineViewportStateCreateInfo viewportStateCreateInfo;
+        vk::PipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo;
+        vk::PipelineRasterizationStateCreateInfo rasterizationStateCreateInfo;
+        vk::PipelineMultisampleStateCreateInfo multisampleStateCreateInfo;
+        vk::PipelineColorBlendAttachmentState colorBlendAttachmentState;
+        mutable vk::PipelineColorBlendStateCreateInfo colorBlendStateCreateInfo;
+        vk::PipelineLayout pipelineLayout;
+        vk::RenderPass renderPass;
+        std::uint32_t subpass;
     };
 }
 
@@ -0,0 +1,29 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_MAPPED_FILE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace fuji::core::utility {
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& filePath);
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+        const std::uint8_t* getData() const noexcept;
+        std::size_t getSize() const noexcept;
+    private:
+        void unmap() noexcept;
+    private:
+        const std::uint8_t* address;
+        std::size_t size;
+        std::vector<std::uint8_t> fallback;
+    };
+}
+
+#endif
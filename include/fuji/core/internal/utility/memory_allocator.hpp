@@ -0,0 +1,120 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_MEMORY_ALLOCATOR_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_MEMORY_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/buddy_allocator.hpp>
+
+namespace fuji::core::utility {
+    enum class ResourceTiling {
+        eLinear,
+        eOptimal
+    };
+
+    struct Allocation {
+        vk::DeviceMemory memory;
+        vk::DeviceSize offset = 0;
+        vk::DeviceSize size = 0;
+        std::uint8_t* mappedData = nullptr;
+        std::uint32_t memoryType = 0;
+        ResourceTiling tiling = ResourceTiling::eLinear;
+        bool dedicated = false;
+    };
+
+    struct MemoryStatistics {
+        std::size_t blockCount = 0;
+        std::size_t allocationCount = 0;
+        vk::DeviceSize reservedBytes = 0;
+        vk::DeviceSize allocatedBytes = 0;
+        vk::DeviceSize usedBytes = 0;
+        vk::DeviceSize largestFreeBlock = 0;
+        double getFragmentation() const noexcept;
+        MemoryStatistics& operator+=(const MemoryStatistics& other) noexcept;
+    };
+
+    class MemoryAllocator;
+
+    class UniqueAllocation {
+    public:
+        UniqueAllocation() noexcept;
+        UniqueAllocation(MemoryAllocator& allocator, const Allocation& allocation) noexcept;
+        UniqueAllocation(UniqueAllocation&& other) noexcept;
+        UniqueAllocation(const UniqueAllocation&) = delete;
+        UniqueAllocation& operator=(UniqueAllocation&& other) noexcept;
+        UniqueAllocation& operator=(const UniqueAllocation&) = delete;
+        ~UniqueAllocation();
+        const Allocation& get() const noexcept;
+        const Allocation* operator->() const noexcept;
+        explicit operator bool() const noexcept;
+        void reset() noexcept;
+    private:
+        MemoryAllocator* allocator;
+        Allocation allocation;
+    };
+
+    struct AllocatedBuffer {
+        UniqueAllocation allocation;
+        vk::UniqueBuffer buffer;
+    };
+
+    struct AllocatedImage {
+        UniqueAllocation allocation;
+        vk::UniqueImage image;
+    };
+
+    class MemoryAllocator {
+    public:
+        static constexpr vk::DeviceSize defaultBlockSize = 64 * 1024 * 1024;
+
+        MemoryAllocator(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, vk::DeviceSize blockSize = defaultBlockSize);
+        MemoryAllocator(const MemoryAllocator&) = delete;
+        ~MemoryAllocator() = default;
+        Allocation allocate(const vk::MemoryRequirements& requirements, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties = {}, ResourceTiling tiling = ResourceTiling::eLinear);
+        void free(const Allocation& allocation);
+        AllocatedBuffer createBuffer(const vk::BufferCreateInfo& createInfo, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties = {});
+        AllocatedImage createImage(const vk::ImageCreateInfo& createInfo, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties = {});
+        void flush(const Allocation& allocation) const;
+        void flush(vk::ArrayProxy<const Allocation> ranges) const;
+        void invalidate(const Allocation& allocation) const;
+        bool isCoherent(const Allocation& allocation) const noexcept;
+        MemoryStatistics getStatistics() const;
+        MemoryStatistics getStatistics(std::uint32_t memoryType) const;
+        const vk::Device& getDevice() const noexcept;
+        const vk::PhysicalDeviceMemoryProperties& getMemoryProperties() const noexcept;
+    private:
+        struct Block {
+            vk::UniqueDeviceMemory memory;
+            BuddyAllocator allocator;
+            std::uint8_t* mappedData;
+        };
+        struct Pool {
+            std::vector<std::unique_ptr<Block>> blocks;
+        };
+        struct DedicatedAllocation {
+            vk::UniqueDeviceMemory memory;
+            vk::DeviceSize size;
+            std::uint32_t memoryType;
+        };
+    private:
+        std::unique_ptr<Block> createBlock(std::uint32_t memoryType) const;
+        vk::UniqueDeviceMemory allocateDeviceMemory(vk::DeviceSize size, std::uint32_t memoryType, std::uint8_t*& mappedData) const;
+        MemoryStatistics collectStatistics(std::uint32_t memoryType) const;
+        vk::MappedMemoryRange getMappedRange(const Allocation& allocation) const noexcept;
+    private:
+        vk::Device device;
+        vk::PhysicalDeviceMemoryProperties memoryProperties;
+        vk::DeviceSize blockSize;
+        vk::DeviceSize nonCoherentAtomSize;
+        mutable std::mutex mutex;
+        std::map<std::pair<std::uint32_t, ResourceTiling>, Pool> pools;
+        std::map<VkDeviceMemory, DedicatedAllocation> dedicatedAllocations;
+    };
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_MEMORY_TYPE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_MEMORY_TYPE_HPP
+
+#include <cstdint>
+#include <optional>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    std::optional<std::uint32_t> findMemoryType(const vk::PhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t typeFilter, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties = {});
+    std::uint32_t requireMemoryType(const vk::PhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t typeFilter, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties = {});
+}
+
+#endif
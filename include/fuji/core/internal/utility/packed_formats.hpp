@@ -0,0 +1,48 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_PACKED_FORMATS_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_PACKED_FORMATS_HPP
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/primitive_formats.hpp>
+
+#define  DEFINE_PACKED_FORMAT(name, storage_type, value_type, pack_function, unpack_function)   \
+struct name { \
+    storage_type packed; \
+    name() = default; \
+    name(const value_type& value) : packed(pack_function(value)) {} \
+    name& operator=(const value_type& value) { \
+        this->packed = pack_function(value); \
+        return *this; \
+    } \
+    value_type get() const { \
+        return unpack_function(this->packed); \
+    } \
+};
+
+namespace fuji::core::utility {
+    DEFINE_PACKED_FORMAT(Half2, std::uint32_t, glm::vec2, glm::packHalf2x16, glm::unpackHalf2x16);
+    DEFINE_PACKED_FORMAT(Half4, std::uint64_t, glm::vec4, glm::packHalf4x16, glm::unpackHalf4x16);
+    DEFINE_PACKED_FORMAT(Unorm16x2, std::uint32_t, glm::vec2, glm::packUnorm2x16, glm::unpackUnorm2x16);
+    DEFINE_PACKED_FORMAT(Snorm16x2, std::uint32_t, glm::vec2, glm::packSnorm2x16, glm::unpackSnorm2x16);
+    DEFINE_PACKED_FORMAT(Unorm8x4, std::uint32_t, glm::vec4, glm::packUnorm4x8, glm::unpackUnorm4x8);
+    DEFINE_PACKED_FORMAT(Snorm8x4, std::uint32_t, glm::vec4, glm::packSnorm4x8, glm::unpackSnorm4x8);
+    DEFINE_PACKED_FORMAT(Unorm10x3x2, std::uint32_t, glm::vec4, glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2);
+
+    static_assert(sizeof(Half2) == 4 && sizeof(Unorm16x2) == 4 && sizeof(Snorm16x2) == 4);
+    static_assert(sizeof(Unorm8x4) == 4 && sizeof(Snorm8x4) == 4 && sizeof(Unorm10x3x2) == 4);
+    static_assert(sizeof(Half4) == 8);
+
+    DEFINE_PRIMITIVE_FORMAT(Half2, vk::Format::eR16G16Sfloat);
+    DEFINE_PRIMITIVE_FORMAT(Half4, vk::Format::eR16G16B16A16Sfloat);
+    DEFINE_PRIMITIVE_FORMAT(Unorm16x2, vk::Format::eR16G16Unorm);
+    DEFINE_PRIMITIVE_FORMAT(Snorm16x2, vk::Format::eR16G16Snorm);
+    DEFINE_PRIMITIVE_FORMAT(Unorm8x4, vk::Format::eR8G8B8A8Unorm);
+    DEFINE_PRIMITIVE_FORMAT(Snorm8x4, vk::Format::eR8G8B8A8Snorm);
+    DEFINE_PRIMITIVE_FORMAT(Unorm10x3x2, vk::Format::eA2B10G10R10UnormPack32);
+}
+
+#endif
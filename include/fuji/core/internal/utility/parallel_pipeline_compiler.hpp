@@ -0,0 +1,48 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_PARALLEL_PIPELINE_COMPILER_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_PARALLEL_PIPELINE_COMPILER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "fuji/core/internal/utility/graphics_pipeline_create_info_template.hpp"
+#include "fuji/core/internal/utility/pipeline_cache.hpp"
+
+namespace fuji::core::utility {
+    class ParallelPipelineCompiler {
+    public:
+        ParallelPipelineCompiler(vk::Device& device, PipelineCache& pipelineCache, std::uint32_t workerCount = 0);
+        ParallelPipelineCompiler(const ParallelPipelineCompiler&) = delete;
+        ~ParallelPipelineCompiler();
+        std::vector<std::future<vk::UniquePipeline>> compile(std::vector<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos);
+        void wait();
+        std::uint32_t getWorkerCount() const noexcept;
+    private:
+        struct Job {
+            std::unique_ptr<GraphicsPipelineCreateInfoTemplate> graphicsPipelineCreateInfo;
+            std::promise<vk::UniquePipeline> promise;
+        };
+
+        void work(std::size_t workerIndex);
+    private:
+        vk::Device& device;
+        PipelineCache& pipelineCache;
+        std::vector<std::unique_ptr<PipelineCache>> workerCaches;
+        std::vector<std::thread> workers;
+        std::deque<Job> jobs;
+        std::mutex mutex;
+        std::condition_variable jobAvailable;
+        std::condition_variable jobsFinished;
+        std::size_t runningJobCount;
+        bool stopping;
+    };
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_PIPELINE_CACHE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_PIPELINE_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    class PipelineCache {
+    public:
+        PipelineCache(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, std::filesystem::path filePath, bool creationFeedbackEnabled = false);
+        explicit PipelineCache(const vk::Device& device, bool creationFeedbackEnabled = false);
+        PipelineCache(const PipelineCache&) = delete;
+        ~PipelineCache() = default;
+        const vk::PipelineCache& getHandle() const;
+        const std::filesystem::path& getFilePath() const noexcept;
+        bool isLoadedFromFile() const noexcept;
+        bool isCreationFeedbackEnabled() const noexcept;
+        std::size_t getDataSize() const;
+        std::uint64_t getHitCount() const noexcept;
+        std::uint64_t getMissCount() const noexcept;
+        void recordCreationFeedback(const vk::PipelineCreationFeedback& feedback) noexcept;
+        // Without creation feedback, hits and misses are inferred from cache data growth across one call, so a
+        // call in which any pipeline missed counts all of its pipelines as misses.
+        void recordDataGrowth(std::size_t dataSizeBefore, std::uint32_t pipelineCount);
+        template <typename CreateInfo>
+        std::vector<vk::UniquePipeline> createPipelines(const vk::Device& device, std::vector<CreateInfo>& createInfos);
+        void save() const;
+        template <typename CreateInfo>
+        static std::vector<vk::UniquePipeline> createUncachedPipelines(const vk::Device& device, const std::vector<CreateInfo>& createInfos);
+        std::unique_ptr<PipelineCache> createWorkerCache() const;
+        void merge(const std::vector<std::unique_ptr<PipelineCache>>& sourceCaches);
+    private:
+        PipelineCache(const vk::Device& device, const vk::PhysicalDeviceProperties& properties, const std::vector<std::uint8_t>& initialData, bool creationFeedbackEnabled);
+        std::vector<std::uint8_t> load() const;
+        bool validate(const std::vector<std::uint8_t>& data) const noexcept;
+    private:
+        vk::Device device;
+        vk::PhysicalDeviceProperties properties;
+        std::filesystem::path filePath;
+        vk::UniquePipelineCache pipelineCache;
+        bool loadedFromFile;
+        bool creationFeedbackEnabled;
+        std::atomic<std::uint64_t> hitCount;
+        std::atomic<std::uint64_t> missCount;
+    };
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_PIPELINE_VARIANT_CACHE_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_PIPELINE_VARIANT_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "fuji/core/internal/utility/graphics_pipeline_create_info_template.hpp"
+#include "fuji/core/internal/utility/pipeline_cache.hpp"
+#include "fuji/core/internal/utility/specialization_constants.hpp"
+
+namespace fuji::core::utility {
+    class PipelineVariantCache {
+    public:
+        using TemplateFactory = std::function<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>()>;
+
+        PipelineVariantCache(vk::Device& device, PipelineCache& pipelineCache, TemplateFactory templateFactory);
+        PipelineVariantCache(const PipelineVariantCache&) = delete;
+        ~PipelineVariantCache() = default;
+        vk::Pipeline get(const SpecializationConstants& constants);
+        std::size_t size();
+        std::uint64_t getHitCount() const noexcept;
+        std::uint64_t getMissCount() const noexcept;
+    private:
+        vk::Device& device;
+        PipelineCache& pipelineCache;
+        TemplateFactory templateFactory;
+        std::mutex mutex;
+        std::unordered_map<SpecializationConstants, std::shared_future<vk::Pipeline>, SpecializationConstants::Hash> pipelines;
+        std::vector<vk::UniquePipeline> ownedPipelines;
+        std::atomic<std::uint64_t> hitCount;
+        std::atomic<std::uint64_t> missCount;
+    };
+}
+
+#endif
@@ -1,7 +1,10 @@
 #ifndef INCLUDE_FUJI_CORE_UTILITY_PRIMITIVE_FORMATS_HPP
 #define INCLUDE_FUJI_CORE_UTILITY_PRIMITIVE_FORMATS_HPP
 
-#include <glm/fwd.hpp>
+#include <cstdint>
+#include <type_traits>
+
+#include <glm/glm.hpp>
 #include <vulkan/vulkan.hpp>
 
 
@@ -10,6 +13,17 @@ template <> \
 struct PrimitiveFormats<target_type> { \
     using type = target_type; \
     inline static constexpr vk::Format value = target_value; \
+    inline static constexpr std::uint32_t columnCount = 1; \
+    inline static constexpr std::uint32_t columnStride = sizeof(target_type); \
+};
+
+#define  DEFINE_PRIMITIVE_MATRIX_FORMAT(target_type, column_type, column_value, column_count)   \
+template <> \
+struct PrimitiveFormats<target_type> { \
+    using type = target_type; \
+    inline static constexpr vk::Format value = column_value; \
+    inline static constexpr std::uint32_t columnCount = column_count; \
+    inline static constexpr std::uint32_t columnStride = sizeof(column_type); \
 };
 
 
@@ -31,7 +45,9 @@ namespace fuji::core::utility {
     DEFINE_PRIMITIVE_FORMAT(glm::dvec2, vk::Format::eR64G64Sfloat);
     DEFINE_PRIMITIVE_FORMAT(glm::dvec3, vk::Format::eR64G64B64Sfloat);
     DEFINE_PRIMITIVE_FORMAT(glm::dvec4, vk::Format::eR64G64B64A64Sfloat);
-    DEFINE_PRIMITIVE_FORMAT(glm::mat4x4, vk::Format::eAstc4x4SfloatBlock);
+    DEFINE_PRIMITIVE_MATRIX_FORMAT(glm::mat2x2, glm::vec2, vk::Format::eR32G32Sfloat, 2);
+    DEFINE_PRIMITIVE_MATRIX_FORMAT(glm::mat3x3, glm::vec3, vk::Format::eR32G32B32Sfloat, 3);
+    DEFINE_PRIMITIVE_MATRIX_FORMAT(glm::mat4x4, glm::vec4, vk::Format::eR32G32B32A32Sfloat, 4);
 
     DEFINE_PRIMITIVE_FORMAT(std::int8_t, vk::Format::eR8Sint);
     DEFINE_PRIMITIVE_FORMAT(glm::i8vec2, vk::Format::eR8G8Sint);
@@ -65,6 +81,18 @@ namespace fuji::core::utility {
     DEFINE_PRIMITIVE_FORMAT(glm::u64vec2, vk::Format::eR64G64Uint);
     DEFINE_PRIMITIVE_FORMAT(glm::u64vec3, vk::Format::eR64G64B64Uint);
     DEFINE_PRIMITIVE_FORMAT(glm::u64vec4, vk::Format::eR64G64B64A64Uint);
+
+    template <class T>
+    struct HasPrimitiveFormat : std::negation<std::is_void<typename PrimitiveFormats<T>::type>> {};
+
+    template <class T>
+    constexpr vk::Format primitiveFormatOf() noexcept {
+        if constexpr (HasPrimitiveFormat<T>::value) {
+            return PrimitiveFormats<T>::value;
+        } else {
+            return vk::Format::eUndefined;
+        }
+    }
 }
 
 #endif
\ No newline at end of file
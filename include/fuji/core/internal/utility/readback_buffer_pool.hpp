@@ -0,0 +1,37 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_READBACK_BUFFER_POOL_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_READBACK_BUFFER_POOL_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    struct ReadbackBuffer {
+        vk::UniqueBuffer buffer;
+        vk::UniqueDeviceMemory memory;
+        const std::uint8_t* mappedData;
+        vk::DeviceSize capacity;
+        bool coherent;
+    };
+
+    class ReadbackBufferPool {
+    public:
+        ReadbackBufferPool(const vk::PhysicalDevice& physicalDevice, const vk::Device& device);
+        ReadbackBufferPool(const ReadbackBufferPool&) = delete;
+        ~ReadbackBufferPool() = default;
+        std::unique_ptr<ReadbackBuffer> acquire(vk::DeviceSize size);
+        void release(std::unique_ptr<ReadbackBuffer> buffer);
+        void invalidate(const ReadbackBuffer& buffer) const;
+        std::size_t getPooledCount() const noexcept;
+    private:
+        std::unique_ptr<ReadbackBuffer> create(vk::DeviceSize capacity) const;
+    private:
+        vk::Device device;
+        vk::PhysicalDeviceMemoryProperties memoryProperties;
+        std::vector<std::unique_ptr<ReadbackBuffer>> freeBuffers;
+    };
+}
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_RING_ALLOCATOR_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_RING_ALLOCATOR_HPP
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace fuji::core::utility {
+    class RingAllocator {
+    public:
+        explicit RingAllocator(std::uint64_t capacity);
+        std::optional<std::uint64_t> allocate(std::uint64_t size, std::uint64_t alignment = 1);
+        void endFrame(std::uint64_t frameNumber);
+        void release(std::uint64_t completedFrameNumber);
+        std::uint64_t getCapacity() const noexcept;
+        std::uint64_t getUsedBytes() const noexcept;
+        std::optional<std::uint64_t> getOldestFrameNumber() const noexcept;
+    private:
+        struct FrameMarker {
+            std::uint64_t frameNumber;
+            std::uint64_t head;
+            std::uint64_t totalAllocated;
+        };
+    private:
+        std::uint64_t capacity;
+        std::uint64_t head;
+        std::uint64_t tail;
+        std::uint64_t totalAllocated;
+        std::uint64_t totalReleased;
+        std::deque<FrameMarker> frames;
+    };
+}
+
+#endif
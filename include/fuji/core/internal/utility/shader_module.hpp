@@ -1,20 +1,35 @@
 #ifndef INCLUDE_FUJI_CORE_UTILITY_SHADER_MODULE_HPP
 #define INCLUDE_FUJI_CORE_UTILITY_SHADER_MODULE_HPP
 
+#include <cstdint>
+#include <memory>
+
 #include <vulkan/vulkan.hpp>
 
+#include <fuji/core/internal/utility/mapped_file.hpp>
+
 namespace fuji::core::utility {
     class ShaderModule {
     public:
         ShaderModule(const vk::Device& device, const std::vector<char>& code, vk::ShaderStageFlagBits shaderStage);
+        ShaderModule(const vk::Device& device, vk::ArrayProxy<const std::uint32_t> code, vk::ShaderStageFlagBits shaderStage);
+        ShaderModule(const vk::Device& device, const MappedFile& file, vk::ShaderStageFlagBits shaderStage);
+        ShaderModule(const ShaderModule&) = default;
         ShaderModule(ShaderModule&&) = default;
         ~ShaderModule() = default;
         const vk::ShaderModule& getHandle() const;
         vk::ShaderStageFlagBits getShaderStage() const;
+
+        static vk::ArrayProxy<const std::uint32_t> asSpirv(const std::uint8_t* data, std::size_t size);
+    private:
+        ShaderModule(std::shared_ptr<const vk::UniqueShaderModule> shaderModule, vk::ShaderStageFlagBits shaderStage);
+        static std::shared_ptr<const vk::UniqueShaderModule> createHandle(const vk::Device& device, vk::ArrayProxy<const std::uint32_t> code);
+
+        friend class ShaderModuleRegistry;
     private:
-        vk::UniqueShaderModule shaderModule;
+        std::shared_ptr<const vk::UniqueShaderModule> shaderModule;
         vk::ShaderStageFlagBits shaderStage;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
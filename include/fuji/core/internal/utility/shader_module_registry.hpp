@@ -0,0 +1,41 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_SHADER_MODULE_REGISTRY_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_SHADER_MODULE_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/shader_module.hpp>
+
+namespace fuji::core::utility {
+    class ShaderModuleRegistry {
+    public:
+        ShaderModuleRegistry(const vk::Device& device);
+        ShaderModuleRegistry(const ShaderModuleRegistry&) = delete;
+        ~ShaderModuleRegistry() = default;
+        ShaderModule acquire(vk::ArrayProxy<const std::uint32_t> code, vk::ShaderStageFlagBits shaderStage);
+        ShaderModule acquire(const std::filesystem::path& filePath, vk::ShaderStageFlagBits shaderStage);
+        std::size_t size();
+
+        static std::uint64_t hash(vk::ArrayProxy<const std::uint32_t> code) noexcept;
+    private:
+        struct Entry {
+            std::vector<std::uint32_t> code;
+            std::weak_ptr<const vk::UniqueShaderModule> shaderModule;
+        };
+    private:
+        void purgeExpired();
+    private:
+        vk::Device device;
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, std::vector<Entry>> shaderModules;
+    };
+}
+
+#endif
@@ -1,17 +1,42 @@
 #ifndef INCLUDE_FUJI_CORE_UTILITY_SHADER_STAGE_FLOW_HPP
 #define INCLUDE_FUJI_CORE_UTILITY_SHADER_STAGE_FLOW_HPP
 
+#include <initializer_list>
+#include <map>
+
 #include <vulkan/vulkan.hpp>
 
 #include <fuji/core/internal/utility/shader_module.hpp>
+#include <fuji/core/internal/utility/specialization_constants.hpp>
 #include <fuji/core/internal/utility/vertex_shader_input_layout.hpp>
 
 namespace fuji::core::utility {
     class ShaderStageFlow {
     public:
         ShaderStageFlow(std::vector<ShaderModule> shaderModules, VertexShaderInputLayout inputLayout);
+        template <class... Bindings>
+        ShaderStageFlow(std::vector<ShaderModule> shaderModules, StaticVertexShaderInputLayout<Bindings...>)
+                : shaderModules(std::move(shaderModules)), inputLayout(std::initializer_list<Binding> {}) {
+            using InputLayout = StaticVertexShaderInputLayout<Bindings...>;
+            this->createShaderStageCreateInfos();
+            this->vertexInputStateCreateInfo = vk::PipelineVertexInputStateCreateInfo {
+                {},
+                InputLayout::bindingDescriptions,
+                InputLayout::attributeDescriptions
+            };
+        }
         const vk::PipelineVertexInputStateCreateInfo& getVertexInputStateCreateInfo() const noexcept;
         const std::vector<vk::PipelineShaderStageCreateInfo>& getShaderStageCreateInfos() const noexcept;
+        void setSpecializationConstants(const SpecializationConstants& constants);
+        void setSpecializationConstants(vk::ShaderStageFlagBits shaderStage, const SpecializationConstants& constants);
+        const SpecializationConstants* getSpecializationConstants(vk::ShaderStageFlagBits shaderStage) const noexcept;
+    private:
+        struct Specialization {
+            SpecializationConstants constants;
+            vk::SpecializationInfo specializationInfo;
+        };
+
+        void createShaderStageCreateInfos();
     private:
         std::vector<ShaderModule> shaderModules;
         VertexShaderInputLayout inputLayout;
@@ -19,7 +44,8 @@ namespace fuji::core::utility {
         std::vector<vk::VertexInputAttributeDescription> attributeDescriptions;
         std::vector<vk::PipelineShaderStageCreateInfo> shaderStageCreateInfos;
         vk::PipelineVertexInputStateCreateInfo vertexInputStateCreateInfo;
+        std::map<vk::ShaderStageFlagBits, Specialization> specializations;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,50 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_SPECIALIZATION_CONSTANTS_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_SPECIALIZATION_CONSTANTS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+namespace fuji::core::utility {
+    class SpecializationConstants {
+    public:
+        struct Hash {
+            std::size_t operator()(const SpecializationConstants& constants) const noexcept;
+        };
+
+        SpecializationConstants() = default;
+
+        template <class T>
+        SpecializationConstants& set(std::uint32_t constantID, const T& value) {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "specialization constants must be scalars");
+            if constexpr (std::is_enum_v<T>) {
+                return this->set(constantID, static_cast<std::underlying_type_t<T>>(value));
+            } else if constexpr (std::is_same_v<T, bool>) {
+                vk::Bool32 boolValue = value ? VK_TRUE : VK_FALSE;
+                return this->setBytes(constantID, &boolValue, sizeof(boolValue));
+            } else if constexpr (sizeof(T) < sizeof(std::uint32_t)) {
+                // SPIR-V scalar constants are at least 32 bits wide
+                using Widened = std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>;
+                Widened widenedValue = static_cast<Widened>(value);
+                return this->setBytes(constantID, &widenedValue, sizeof(widenedValue));
+            } else {
+                return this->setBytes(constantID, &value, sizeof(value));
+            }
+        }
+        bool empty() const noexcept;
+        vk::SpecializationInfo getSpecializationInfo() const noexcept;
+        bool operator==(const SpecializationConstants& other) const noexcept;
+        bool operator!=(const SpecializationConstants& other) const noexcept;
+    private:
+        SpecializationConstants& setBytes(std::uint32_t constantID, const void* value, std::size_t size);
+    private:
+        std::vector<vk::SpecializationMapEntry> mapEntries;
+        std::vector<std::uint8_t> data;
+    };
+}
+
+#endif
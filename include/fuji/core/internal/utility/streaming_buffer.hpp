@@ -0,0 +1,57 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_STREAMING_BUFFER_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_STREAMING_BUFFER_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/frame_ring.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/ring_allocator.hpp>
+
+namespace fuji::core::utility {
+    struct StreamingRange {
+        vk::Buffer buffer;
+        vk::DeviceSize offset;
+        vk::DeviceSize size;
+        std::uint8_t* data;
+    };
+
+    // Persistently mapped buffer that hands out per-frame sub-ranges from a ring. Ranges written during a frame
+    // stay reserved until the FrameRing fence of that frame has signalled; when the ring is full, allocate()
+    // waits on the oldest in-flight frame instead of overwriting it. Writes to non-coherent memory are flushed
+    // with a single vkFlushMappedMemoryRanges per flush()/endFrame(). Call beginFrame() after FrameRing::acquire()
+    // and endFrame() before FrameRing::submit().
+    class StreamingBuffer {
+    public:
+        StreamingBuffer(MemoryAllocator& allocator, FrameRing& frameRing, vk::DeviceSize capacity,
+            vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eVertexBuffer, vk::DeviceSize alignment = 16);
+        StreamingBuffer(const StreamingBuffer&) = delete;
+        ~StreamingBuffer() = default;
+        void beginFrame();
+        std::optional<StreamingRange> allocate(vk::DeviceSize size, vk::DeviceSize alignment = 1);
+        std::optional<StreamingRange> write(const void* data, vk::DeviceSize size, vk::DeviceSize alignment = 1);
+        void flush();
+        void endFrame();
+        const vk::Buffer& getBuffer() const;
+        vk::DeviceSize getCapacity() const noexcept;
+        vk::DeviceSize getUsedBytes() const noexcept;
+        bool isCoherent() const noexcept;
+        std::uint64_t getFlushCount() const noexcept;
+        std::uint64_t getStallCount() const noexcept;
+    private:
+        MemoryAllocator& allocator;
+        FrameRing& frameRing;
+        vk::DeviceSize alignment;
+        AllocatedBuffer buffer;
+        RingAllocator ring;
+        bool coherent;
+        std::vector<Allocation> pendingFlushes;
+        std::uint64_t flushCount;
+        std::uint64_t stallCount;
+    };
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_UPLOAD_SCHEDULER_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_UPLOAD_SCHEDULER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/ring_allocator.hpp>
+
+namespace fuji::core::utility {
+    struct ImageUploadRegion {
+        const void* data;
+        vk::DeviceSize size;
+        vk::Offset3D offset;
+        vk::Extent3D extent;
+        std::uint32_t arrayLayer = 0;
+        std::uint32_t rowLength = 0;
+    };
+
+    // Batches copies into one command buffer per flush that signals a timeline semaphore.
+    // Exclusive resources owned by another transfer family must be acquired with recordAcquireBarriers().
+    class UploadScheduler {
+    public:
+        static constexpr vk::DeviceSize defaultStagingSize = 16 * 1024 * 1024;
+
+        UploadScheduler(const vk::PhysicalDevice& physicalDevice, MemoryAllocator& allocator, std::uint32_t graphicsQueueFamilyIndex, std::uint32_t transferQueueFamilyIndex, vk::DeviceSize stagingSize = defaultStagingSize);
+        UploadScheduler(const UploadScheduler&) = delete;
+        ~UploadScheduler();
+        static std::uint32_t findTransferQueueFamily(const vk::PhysicalDevice& physicalDevice, std::uint32_t graphicsQueueFamilyIndex);
+        void uploadBuffer(const vk::Buffer& buffer, vk::DeviceSize offset, const void* data, vk::DeviceSize size,
+            vk::SharingMode sharingMode = vk::SharingMode::eExclusive,
+            vk::PipelineStageFlags dstStage = vk::PipelineStageFlagBits::eVertexInput,
+            vk::AccessFlags dstAccess = vk::AccessFlagBits::eVertexAttributeRead);
+        void uploadImage(const vk::Image& image, vk::ArrayProxy<const ImageUploadRegion> regions, vk::ImageLayout oldLayout,
+            vk::ImageLayout newLayout = vk::ImageLayout::eShaderReadOnlyOptimal,
+            vk::SharingMode sharingMode = vk::SharingMode::eExclusive,
+            vk::PipelineStageFlags dstStage = vk::PipelineStageFlagBits::eFragmentShader);
+        std::uint64_t flush(const vk::Queue& transferQueue);
+        std::uint64_t recordAcquireBarriers(vk::CommandBuffer& graphicsCommandBuffer);
+        bool isComplete(std::uint64_t value) const;
+        void wait(std::uint64_t value) const;
+        bool hasPendingUploads() const;
+        const vk::Semaphore& getTimelineSemaphore() const noexcept;
+        std::uint64_t getSubmittedValue() const noexcept;
+        std::uint32_t getQueueFamilyIndex() const noexcept;
+        std::vector<std::uint32_t> getQueueFamilyIndices() const;
+    private:
+        struct StagingRange {
+            vk::Buffer buffer;
+            vk::DeviceSize offset;
+        };
+        struct BufferUpload {
+            vk::Buffer buffer;
+            vk::BufferCopy copy;
+            vk::Buffer stagingBuffer;
+            vk::PipelineStageFlags dstStage;
+            vk::AccessFlags dstAccess;
+            bool transferOwnership;
+        };
+        struct ImageUpload {
+            vk::Image image;
+            std::vector<std::pair<vk::Buffer, vk::BufferImageCopy>> copies;
+            vk::ImageLayout oldLayout;
+            vk::ImageLayout newLayout;
+            vk::PipelineStageFlags dstStage;
+            bool transferOwnership;
+        };
+        struct PendingAcquire {
+            std::uint64_t value;
+            vk::PipelineStageFlags dstStage;
+            std::vector<vk::BufferMemoryBarrier> bufferBarriers;
+            std::vector<vk::ImageMemoryBarrier> imageBarriers;
+        };
+    private:
+        StagingRange stage(const void* data, vk::DeviceSize size);
+        vk::CommandBuffer acquireCommandBuffer();
+        void releaseCompleted();
+        std::uint64_t getCompletedValue() const;
+    private:
+        vk::Device device;
+        MemoryAllocator& allocator;
+        std::uint32_t graphicsQueueFamilyIndex;
+        std::uint32_t transferQueueFamilyIndex;
+        vk::DeviceSize stagingAlignment;
+        mutable std::mutex mutex;
+        AllocatedBuffer stagingBuffer;
+        RingAllocator stagingRing;
+        vk::UniqueSemaphore timelineSemaphore;
+        std::uint64_t submittedValue;
+        vk::UniqueCommandPool commandPool;
+        std::deque<std::pair<std::uint64_t, vk::UniqueCommandBuffer>> commandBuffers;
+        std::deque<std::pair<std::uint64_t, AllocatedBuffer>> temporaryBuffers;
+        std::vector<AllocatedBuffer> pendingTemporaryBuffers;
+        std::vector<BufferUpload> pendingBufferUploads;
+        std::vector<ImageUpload> pendingImageUploads;
+        std::vector<PendingAcquire> pendingAcquires;
+    };
+}
+
+#endif
@@ -1,12 +1,18 @@
 #ifndef INCLUDE_FUJI_CORE_UTILITY_VERTEX_SHADER_INPUT_LAYOUT_HPP
 #define INCLUDE_FUJI_CORE_UTILITY_VERTEX_SHADER_INPUT_LAYOUT_HPP
 
+#include <array>
 #include <cstddef>
 #include <initializer_list>
+#include <type_traits>
+#include <vector>
 #include <vulkan/vulkan.hpp>
 
 #include <fuji/core/internal/utility/primitive_formats.hpp>
 
+#define FUJI_VERTEX_ATTRIBUTE(vertex_type, member) \
+    ::fuji::core::utility::StaticAttribute<decltype(vertex_type::member), static_cast<std::uint32_t>(offsetof(vertex_type, member))>
+
 namespace fuji::core::utility {
     struct AttributeDescription {
         vk::Format format;
@@ -19,12 +25,22 @@ namespace fuji::core::utility {
                 static_cast<std::uint32_t>(reinterpret_cast<std::size_t>(&((T*)nullptr->*member)))
             };
         }
+
+        template <class T, class U>
+        static void appendDescriptions(std::vector<AttributeDescription>& descriptions, U T::* member) {
+            AttributeDescription description = createDescription(member);
+            for(std::uint32_t column = 0; column < PrimitiveFormats<U>::columnCount; column++) {
+                descriptions.push_back({ description.format, description.offset + column * PrimitiveFormats<U>::columnStride });
+            }
+        }
     };
 
     class Binding {
     public:
         template <class T, class... U>
-        Binding(vk::VertexInputRate inputRate, U T::*... members) : inputRate(inputRate), attributeDescriptions({ AttributeDescription::createDescription(members)... }), stride(sizeof(T)) {}
+        Binding(vk::VertexInputRate inputRate, U T::*... members) : inputRate(inputRate), stride(sizeof(T)) {
+            (AttributeDescription::appendDescriptions(this->attributeDescriptions, members), ...);
+        }
         vk::VertexInputRate getInputRate() const noexcept;
         const std::vector<AttributeDescription>& getAttributeDescriptions() const noexcept;
         std::uint32_t getStride() const noexcept;
@@ -41,6 +57,91 @@ namespace fuji::core::utility {
     private:
         std::vector<Binding> bindings;
     };
+
+    template <class T, std::uint32_t Offset>
+    struct StaticAttribute {
+        static_assert(HasPrimitiveFormat<T>::value, "vertex attribute type has no PrimitiveFormats specialization");
+
+        using type = T;
+        inline static constexpr vk::Format format = primitiveFormatOf<T>();
+        inline static constexpr std::uint32_t offset = Offset;
+        inline static constexpr std::uint32_t columnCount = PrimitiveFormats<T>::columnCount;
+        inline static constexpr std::uint32_t columnStride = PrimitiveFormats<T>::columnStride;
+    };
+
+    namespace detail {
+        template <std::size_t N, class... Attributes>
+        constexpr std::array<vk::Format, N> expandFormats() {
+            std::array<vk::Format, N> formats {};
+            std::size_t index = 0;
+            ([&formats, &index] {
+                for(std::uint32_t column = 0; column < Attributes::columnCount; column++) {
+                    formats[index++] = Attributes::format;
+                }
+            }(), ...);
+            return formats;
+        }
+
+        template <std::size_t N, class... Attributes>
+        constexpr std::array<std::uint32_t, N> expandOffsets() {
+            std::array<std::uint32_t, N> offsets {};
+            std::size_t index = 0;
+            ([&offsets, &index] {
+                for(std::uint32_t column = 0; column < Attributes::columnCount; column++) {
+                    offsets[index++] = Attributes::offset + column * Attributes::columnStride;
+                }
+            }(), ...);
+            return offsets;
+        }
+    }
+
+    template <class Vertex, vk::VertexInputRate InputRate, class... Attributes>
+    struct StaticBinding {
+        static_assert(std::is_standard_layout_v<Vertex>, "vertex type must be standard layout");
+        static_assert((HasPrimitiveFormat<typename Attributes::type>::value && ...), "vertex attribute type has no PrimitiveFormats specialization");
+
+        using vertex_type = Vertex;
+        inline static constexpr vk::VertexInputRate inputRate = InputRate;
+        inline static constexpr std::uint32_t stride = sizeof(Vertex);
+        inline static constexpr std::size_t attributeCount = (std::size_t { 0 } + ... + Attributes::columnCount);
+        inline static constexpr std::array<vk::Format, attributeCount> formats = detail::expandFormats<attributeCount, Attributes...>();
+        inline static constexpr std::array<std::uint32_t, attributeCount> offsets = detail::expandOffsets<attributeCount, Attributes...>();
+    };
+
+    namespace detail {
+        template <class... Bindings>
+        constexpr std::array<vk::VertexInputBindingDescription, sizeof...(Bindings)> createBindingDescriptions() {
+            std::array<vk::VertexInputBindingDescription, sizeof...(Bindings)> descriptions {};
+            std::uint32_t binding = 0;
+            ((descriptions[binding] = vk::VertexInputBindingDescription { binding, Bindings::stride, Bindings::inputRate }, binding++), ...);
+            return descriptions;
+        }
+
+        template <class Binding, std::size_t N>
+        constexpr void appendAttributeDescriptions(std::array<vk::VertexInputAttributeDescription, N>& descriptions, std::size_t& index, std::uint32_t binding, std::uint32_t& location) {
+            for(std::size_t i = 0; i < Binding::attributeCount; i++) {
+                descriptions[index] = vk::VertexInputAttributeDescription { location, binding, Binding::formats[i], Binding::offsets[i] };
+                index++;
+                location++;
+            }
+        }
+
+        template <class... Bindings>
+        constexpr std::array<vk::VertexInputAttributeDescription, (std::size_t { 0 } + ... + Bindings::attributeCount)> createAttributeDescriptions() {
+            std::array<vk::VertexInputAttributeDescription, (std::size_t { 0 } + ... + Bindings::attributeCount)> descriptions {};
+            std::size_t index = 0;
+            std::uint32_t binding = 0;
+            std::uint32_t location = 0;
+            (appendAttributeDescriptions<Bindings>(descriptions, index, binding++, location), ...);
+            return descriptions;
+        }
+    }
+
+    template <class... Bindings>
+    struct StaticVertexShaderInputLayout {
+        inline static constexpr std::array<vk::VertexInputBindingDescription, sizeof...(Bindings)> bindingDescriptions = detail::createBindingDescriptions<Bindings...>();
+        inline static constexpr auto attributeDescriptions = detail::createAttributeDescriptions<Bindings...>();
+    };
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef INCLUDE_FUJI_CORE_UTILITY_WORK_STEALING_THREAD_POOL_HPP
+#define INCLUDE_FUJI_CORE_UTILITY_WORK_STEALING_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fuji::core::utility {
+    // Thread pool with one task deque per worker. Workers take their own newest tasks first and steal the
+    // oldest tasks of other workers when they run dry, so a large batch submitted at once spreads out
+    // without every task going through a shared queue.
+    class WorkStealingThreadPool {
+    public:
+        using Task = std::function<void()>;
+
+        explicit WorkStealingThreadPool(std::uint32_t workerCount = 0);
+        WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+        ~WorkStealingThreadPool();
+        void submit(Task task);
+        void submit(std::vector<Task> tasks);
+        void wait();
+        std::uint32_t getWorkerCount() const noexcept;
+        std::size_t getPendingTaskCount() const noexcept;
+        std::uint64_t getStealCount() const noexcept;
+    private:
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void work(std::size_t workerIndex);
+        bool pop(std::size_t workerIndex, Task& task);
+        bool steal(std::size_t workerIndex, Task& task);
+        void push(std::size_t queueIndex, Task task);
+        std::size_t selectQueue() noexcept;
+    private:
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        std::condition_variable tasksFinished;
+        std::atomic<std::size_t> queuedTaskCount;
+        std::atomic<std::size_t> pendingTaskCount;
+        std::atomic<std::size_t> nextQueue;
+        std::atomic<std::uint64_t> stealCount;
+        std::exception_ptr firstException;
+        bool stopping;
+    };
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef INCLUDE_FUJI_CORE_OFFSCREEN_RENDERER_HPP
+#define INCLUDE_FUJI_CORE_OFFSCREEN_RENDERER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/instance.hpp>
+#include <fuji/core/offscreen_target.hpp>
+#include <fuji/core/internal/utility/readback_buffer_pool.hpp>
+
+namespace fuji {
+    // Renders batches of OffscreenTargets with an Instance whose render pass ends in eTransferSrcOptimal
+    // (the render pass then carries the subpass-to-transfer dependency the copies rely on)
+    // and copies them into pooled host-visible buffers. Each batch is one submit of the Instance's frame ring.
+    class OffscreenRenderer {
+    public:
+        using Draw = std::function<void(vk::CommandBuffer& commandBuffer, std::size_t index)>;
+        using Consumer = std::function<void(std::size_t index, const std::uint8_t* pixels, vk::Extent2D extent)>;
+
+        OffscreenRenderer(const vk::PhysicalDevice& physicalDevice, Instance& instance, const vk::Queue& queue);
+        OffscreenRenderer(const OffscreenRenderer&) = delete;
+        ~OffscreenRenderer();
+        std::uint64_t submit(const std::vector<OffscreenTarget*>& targets, const Draw& draw = {});
+        bool isComplete(std::uint64_t batch) const;
+        void collect(std::uint64_t batch, const Consumer& consumer);
+        std::size_t getPendingBatchCount() const noexcept;
+    private:
+        struct Region {
+            vk::DeviceSize offset;
+            vk::Extent2D extent;
+        };
+        struct PendingBatch {
+            std::unique_ptr<core::utility::ReadbackBuffer> readbackBuffer;
+            std::vector<Region> regions;
+        };
+    private:
+        Instance& instance;
+        vk::Queue queue;
+        core::utility::ReadbackBufferPool readbackBufferPool;
+        std::map<std::uint64_t, PendingBatch> pendingBatches;
+    };
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef INCLUDE_FUJI_CORE_OFFSCREEN_TARGET_HPP
+#define INCLUDE_FUJI_CORE_OFFSCREEN_TARGET_HPP
+
+#include <cstdint>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+
+namespace fuji {
+    class OffscreenTarget {
+    public:
+        OffscreenTarget(core::utility::MemoryAllocator& allocator, const vk::RenderPass& renderPass, vk::Format format, vk::Extent2D extent);
+        OffscreenTarget(const OffscreenTarget&) = delete;
+        ~OffscreenTarget() = default;
+        const vk::Image& getImage() const;
+        vk::UniqueFramebuffer& getFramebuffer() noexcept;
+        vk::Format getFormat() const noexcept;
+        vk::Extent2D getExtent() const noexcept;
+        std::uint32_t getTexelSize() const noexcept;
+        vk::DeviceSize getByteSize() const noexcept;
+    private:
+        vk::Format format;
+        vk::Extent2D extent;
+        std::uint32_t texelSize;
+        core::utility::AllocatedImage image;
+        vk::UniqueImageView imageView;
+        vk::UniqueFramebuffer framebuffer;
+    };
+}
+
+#endif
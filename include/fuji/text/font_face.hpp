@@ -0,0 +1,96 @@
+#ifndef INCLUDE_FUJI_TEXT_FONT_FACE_HPP
+#define INCLUDE_FUJI_TEXT_FONT_FACE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <fuji/core/internal/utility/mapped_file.hpp>
+#include <fuji/text/outline.hpp>
+#include <fuji/text/internal/utility/codepoint_map.hpp>
+#include <fuji/text/internal/utility/pair_adjustment_table.hpp>
+#include <fuji/text/internal/utility/sfnt_reader.hpp>
+
+namespace fuji::text {
+    struct FontMetrics {
+        std::uint16_t unitsPerEm;
+        std::int16_t ascender;
+        std::int16_t descender;
+        std::int16_t lineGap;
+        std::uint32_t glyphCount;
+    };
+
+    struct GlyphMetrics {
+        std::uint16_t advanceWidth;
+        std::int16_t leftSideBearing;
+    };
+
+    // One face of a TTF/OTF/TTC file. The file is memory-mapped and only the table directory and the
+    // fixed-size head/hhea/maxp tables are read on construction; cmap, hmtx and loca/glyf are located on
+    // first use. Codepoint lookups go through a lazily filled page table, and GPOS (or kern) pair
+    // adjustments are flattened into a lookup table the first time kerning is requested. All accessors
+    // are safe to call from several threads at once. Outlines are returned in font units with y up.
+    class FontFace {
+    public:
+        explicit FontFace(const std::filesystem::path& filePath, std::uint32_t faceIndex = 0);
+        FontFace(std::shared_ptr<const core::utility::MappedFile> file, std::uint32_t faceIndex = 0);
+        FontFace(const FontFace&) = delete;
+        ~FontFace() = default;
+        static std::uint32_t getFaceCount(const core::utility::MappedFile& file);
+        std::uint32_t getFaceIndex() const noexcept;
+        const FontMetrics& getMetrics() const noexcept;
+        bool hasTable(std::uint32_t tag) const noexcept;
+        std::optional<utility::SfntReader> getTable(std::uint32_t tag) const;
+        std::uint32_t getGlyphIndex(char32_t codepoint) const;
+        void getGlyphIndices(const char32_t* codepoints, std::size_t count, std::uint32_t* glyphIndices) const;
+        std::vector<std::uint32_t> getGlyphIndices(std::u32string_view text) const;
+        GlyphMetrics getGlyphMetrics(std::uint32_t glyphIndex) const;
+        const utility::PairAdjustmentTable& getPairAdjustments() const;
+        void getKerning(const std::uint32_t* glyphIndices, std::size_t count, std::int32_t* adjustments) const;
+        Outline getOutline(std::uint32_t glyphIndex) const;
+    private:
+        struct TableRecord {
+            std::uint32_t tag;
+            std::uint32_t offset;
+            std::uint32_t length;
+        };
+
+        struct CharacterMap {
+            utility::SfntReader subtable;
+            std::uint16_t format;
+        };
+
+        struct GlyphData {
+            utility::SfntReader loca;
+            utility::SfntReader glyf;
+        };
+
+        void loadCharacterMap() const;
+        std::uint32_t lookupGlyphIndex(char32_t codepoint) const;
+        void loadGlyphData() const;
+        void loadPairAdjustments() const;
+        utility::SfntReader getGlyph(std::uint32_t glyphIndex) const;
+        void appendOutline(Outline& outline, std::uint32_t glyphIndex, const float transform[6], std::uint32_t depth) const;
+    private:
+        std::shared_ptr<const core::utility::MappedFile> file;
+        std::uint32_t faceIndex;
+        utility::SfntReader data;
+        std::vector<TableRecord> tables;
+        FontMetrics metrics;
+        std::int16_t indexToLocFormat;
+        std::uint16_t horizontalMetricCount;
+        mutable std::once_flag characterMapOnce;
+        mutable std::optional<CharacterMap> characterMap;
+        utility::CodepointMap codepointMap;
+        mutable std::once_flag glyphDataOnce;
+        mutable std::optional<GlyphData> glyphData;
+        mutable std::once_flag pairAdjustmentsOnce;
+        mutable utility::PairAdjustmentTable pairAdjustments;
+    };
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_ATLAS_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_ATLAS_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+#include <fuji/text/internal/utility/atlas_staging.hpp>
+#include <fuji/text/internal/utility/skyline_packer.hpp>
+
+namespace fuji::text {
+    struct AtlasRegion {
+        std::uint32_t x;
+        std::uint32_t y;
+        std::uint32_t width;
+        std::uint32_t height;
+        float u0;
+        float v0;
+        float u1;
+        float v1;
+    };
+
+    // Single-channel (R8Unorm) coverage atlas. Glyphs are packed with a skyline packer and only the
+    // rectangles added since the last commit() are uploaded, each with its own bufferOffset/imageOffset.
+    class GlyphAtlas {
+    public:
+        static constexpr vk::Format format = vk::Format::eR8Unorm;
+
+        GlyphAtlas(core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, std::uint32_t width, std::uint32_t height, std::uint32_t padding = 1);
+        GlyphAtlas(const GlyphAtlas&) = delete;
+        ~GlyphAtlas() = default;
+        std::optional<AtlasRegion> add(const std::uint8_t* coverage, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch = 0);
+        bool commit();
+        void clear();
+        const vk::Image& getImage() const;
+        const vk::ImageView& getImageView() const;
+        vk::Extent2D getExtent() const noexcept;
+        std::size_t getPendingRegionCount() const noexcept;
+        vk::DeviceSize getPendingUploadSize() const noexcept;
+        float getOccupancy() const noexcept;
+        static AtlasRegion getRegion(const utility::PackedRect& rect, std::uint32_t padding, vk::Extent2D extent) noexcept;
+    private:
+        core::utility::UploadScheduler& uploadScheduler;
+        std::uint32_t width;
+        std::uint32_t height;
+        vk::SharingMode sharingMode;
+        vk::ImageLayout layout;
+        core::utility::AllocatedImage image;
+        vk::UniqueImageView imageView;
+        utility::SkylinePacker packer;
+        utility::AtlasStaging staging;
+    };
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_CACHE_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_CACHE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+#include <fuji/text/glyph_atlas.hpp>
+#include <fuji/text/glyph_key.hpp>
+#include <fuji/text/internal/utility/atlas_staging.hpp>
+#include <fuji/text/internal/utility/paged_glyph_index.hpp>
+
+namespace fuji::text {
+    struct CachedGlyph {
+        std::uint32_t layer;
+        AtlasRegion region;
+    };
+
+    // R8Unorm 2D array glyph cache with one page per layer, all allocated up front from the memory budget.
+    // Full caches evict the least recently used page that no in-flight frame references; page 0 holds a blank placeholder.
+    class GlyphCache {
+    public:
+        static constexpr vk::Format format = vk::Format::eR8Unorm;
+
+        GlyphCache(const vk::PhysicalDevice& physicalDevice, core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, vk::DeviceSize memoryBudget, std::uint32_t pageSize = 1024, std::uint32_t padding = 1);
+        GlyphCache(const GlyphCache&) = delete;
+        ~GlyphCache() = default;
+        void beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber) noexcept;
+        std::optional<CachedGlyph> find(const GlyphKey& key);
+        std::optional<CachedGlyph> insert(const GlyphKey& key, const std::uint8_t* coverage, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch = 0);
+        bool commit();
+        bool canFit(std::uint32_t width, std::uint32_t height) const noexcept;
+        std::vector<GlyphKey> takeEvictedKeys();
+        const CachedGlyph& getPlaceholder() const noexcept;
+        const vk::Image& getImage() const;
+        const vk::ImageView& getImageView() const;
+        std::vector<vk::ImageView> getPageImageViews() const;
+        std::uint32_t getPageSize() const noexcept;
+        std::uint32_t getPageCount() const noexcept;
+        std::uint32_t getMaxPageCount() const noexcept;
+        std::size_t getGlyphCount() const noexcept;
+        std::uint64_t getEvictionCount() const noexcept;
+    private:
+        CachedGlyph toCachedGlyph(const utility::PagedGlyphIndex::Entry& entry) const noexcept;
+    private:
+        core::utility::UploadScheduler& uploadScheduler;
+        std::uint32_t pageSize;
+        vk::SharingMode sharingMode;
+        vk::ImageLayout layout;
+        std::uint64_t frameNumber;
+        std::uint64_t completedFrameNumber;
+        utility::PagedGlyphIndex index;
+        CachedGlyph placeholder;
+        std::vector<GlyphKey> evictedKeys;
+        core::utility::AllocatedImage image;
+        vk::UniqueImageView imageView;
+        std::vector<vk::UniqueImageView> pageImageViews;
+        utility::AtlasStaging staging;
+    };
+}
+
+#endif
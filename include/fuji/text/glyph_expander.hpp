@@ -0,0 +1,76 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_EXPANDER_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_EXPANDER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+#include <fuji/text/glyph_instance.hpp>
+#include <fuji/text/text_layout.hpp>
+
+namespace fuji::text {
+    struct PlacedGlyph {
+        glm::vec2 position;
+        std::uint32_t glyphIndex;
+        std::uint32_t colorIndex;
+    };
+
+    static_assert(sizeof(PlacedGlyph) == 16);
+
+    struct GlyphExpandPushConstants {
+        glm::vec2 scale;
+        glm::vec2 translation;
+        glm::vec2 viewport;
+        std::uint32_t glyphCount;
+        std::uint32_t glyphTableSize;
+    };
+
+    // Expands placed glyphs into GlyphInstances and a vk::DrawIndirectCommand on the GPU, culling glyphs outside
+    // the viewport. record() goes outside a render pass and draw() inside one, after GlyphRenderer::bind() with
+    // the same scale as quadScale. record() acquires the uploaded buffers and returns the timeline value its
+    // submission has to wait on.
+    class GlyphExpander {
+    public:
+        static constexpr std::uint32_t workgroupSize = 64;
+
+        GlyphExpander(core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, std::uint32_t maxGlyphCount, std::uint32_t glyphTableSize);
+        GlyphExpander(const GlyphExpander&) = delete;
+        ~GlyphExpander() = default;
+        void setPlacedGlyphs(const std::vector<PlacedGlyph>& placedGlyphs);
+        void setGlyph(std::uint32_t glyphIndex, const GlyphInstance& glyph);
+        void commit();
+        std::uint64_t record(vk::CommandBuffer& commandBuffer, vk::Extent2D viewport, glm::vec2 scale = glm::vec2(1.0f), glm::vec2 translation = glm::vec2(0.0f)) const;
+        void draw(vk::CommandBuffer& commandBuffer) const;
+        const vk::Buffer& getInstanceBuffer() const;
+        const vk::Buffer& getIndirectBuffer() const;
+        std::uint32_t getGlyphCount() const noexcept;
+        std::uint32_t getMaxGlyphCount() const noexcept;
+        std::uint32_t getGlyphTableSize() const noexcept;
+
+        static void appendPlacedGlyphs(const TextLayout& layout, float baseline, std::uint32_t colorIndex, std::vector<PlacedGlyph>& placedGlyphs);
+    private:
+        core::utility::UploadScheduler& uploadScheduler;
+        vk::Device device;
+        std::uint32_t maxGlyphCount;
+        std::uint32_t glyphCount;
+        std::vector<GlyphInstance> glyphTable;
+        std::uint32_t dirtyBegin;
+        std::uint32_t dirtyEnd;
+        std::uint64_t uploadValue;
+        core::utility::AllocatedBuffer placedGlyphBuffer;
+        core::utility::AllocatedBuffer glyphTableBuffer;
+        core::utility::AllocatedBuffer instanceBuffer;
+        core::utility::AllocatedBuffer indirectBuffer;
+        vk::UniqueDescriptorSetLayout descriptorSetLayout;
+        vk::UniqueDescriptorPool descriptorPool;
+        vk::DescriptorSet descriptorSet;
+        vk::UniquePipelineLayout pipelineLayout;
+        vk::UniquePipeline pipeline;
+    };
+}
+
+#endif
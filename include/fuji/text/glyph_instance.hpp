@@ -0,0 +1,40 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_INSTANCE_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_INSTANCE_HPP
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/vertex_shader_input_layout.hpp>
+
+namespace fuji::text {
+    // One record per glyph, read at eInstance rate. The vertex shader expands it to a 4-vertex strip,
+    // so a block of glyphs is a single draw(4, glyphCount, 0, 0).
+    struct GlyphInstance {
+        glm::vec2 position;
+        glm::u16vec4 atlasRect;
+        std::uint16_t layer;
+        std::uint16_t colorIndex;
+    };
+
+    static_assert(sizeof(GlyphInstance) == 20);
+
+    using GlyphInstanceBinding = core::utility::StaticBinding<
+        GlyphInstance, vk::VertexInputRate::eInstance,
+        FUJI_VERTEX_ATTRIBUTE(GlyphInstance, position),
+        FUJI_VERTEX_ATTRIBUTE(GlyphInstance, atlasRect),
+        FUJI_VERTEX_ATTRIBUTE(GlyphInstance, layer),
+        FUJI_VERTEX_ATTRIBUTE(GlyphInstance, colorIndex)>;
+
+    using GlyphInputLayout = core::utility::StaticVertexShaderInputLayout<GlyphInstanceBinding>;
+
+    struct GlyphPushConstants {
+        glm::vec2 viewportScale;
+        glm::vec2 atlasScale;
+        glm::vec2 origin;
+        glm::vec2 quadScale;
+    };
+}
+
+#endif
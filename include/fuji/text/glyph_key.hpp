@@ -0,0 +1,38 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_KEY_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_KEY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fuji::text {
+    struct GlyphKey {
+        static constexpr std::uint32_t sdfFlag = 1u << 0;
+
+        std::uint32_t fontId;
+        std::uint32_t glyphIndex;
+        std::uint32_t pixelSize;
+        std::uint32_t flags;
+
+        bool operator==(const GlyphKey& other) const noexcept {
+            return this->fontId == other.fontId
+                && this->glyphIndex == other.glyphIndex
+                && this->pixelSize == other.pixelSize
+                && this->flags == other.flags;
+        }
+
+        bool operator!=(const GlyphKey& other) const noexcept {
+            return !(*this == other);
+        }
+
+        struct Hash {
+            std::size_t operator()(const GlyphKey& key) const noexcept {
+                std::uint64_t value = (static_cast<std::uint64_t>(key.fontId) << 32) ^ key.glyphIndex;
+                value = value * 0x9e3779b97f4a7c15ull ^ ((static_cast<std::uint64_t>(key.pixelSize) << 32) | key.flags);
+                value ^= value >> 29;
+                return static_cast<std::size_t>(value * 0xbf58476d1ce4e5b9ull);
+            }
+        };
+    };
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_RASTERIZER_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_RASTERIZER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <fuji/core/internal/utility/work_stealing_thread_pool.hpp>
+#include <fuji/text/glyph_cache.hpp>
+#include <fuji/text/glyph_key.hpp>
+
+namespace fuji::text {
+    struct GlyphBitmap {
+        std::uint32_t width;
+        std::uint32_t height;
+        std::int32_t left;
+        std::int32_t top;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    struct GlyphLookup {
+        CachedGlyph glyph;
+        std::int32_t left;
+        std::int32_t top;
+        bool resident;
+    };
+
+    // Rasterizes missing glyphs on a work-stealing thread pool. Glyphs requested during a frame are
+    // batched and handed to the workers by dispatch(); until a glyph has been uploaded into the cache
+    // request() returns the cache's blank placeholder, so callers can lay out and draw without blocking. The
+    // rasterize callback runs concurrently on worker threads; everything else belongs to the render thread.
+    class GlyphRasterizer {
+    public:
+        using Rasterize = std::function<std::optional<GlyphBitmap>(const GlyphKey&)>;
+
+        GlyphRasterizer(GlyphCache& glyphCache, Rasterize rasterize, std::uint32_t threadCount = 0, std::size_t batchSize = 32);
+        GlyphRasterizer(const GlyphRasterizer&) = delete;
+        ~GlyphRasterizer();
+        void beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber);
+        GlyphLookup request(const GlyphKey& key);
+        void dispatch();
+        std::size_t upload(std::size_t byteBudget = std::numeric_limits<std::size_t>::max());
+        void wait();
+        std::uint32_t getThreadCount() const noexcept;
+        std::size_t getInFlightCount() const noexcept;
+        std::size_t getReadyCount();
+        std::size_t getFailedCount() const noexcept;
+    private:
+        struct Result {
+            GlyphKey key;
+            std::optional<GlyphBitmap> bitmap;
+        };
+
+        struct Bearing {
+            std::int32_t left;
+            std::int32_t top;
+        };
+
+        void rasterizeBatch(const std::vector<GlyphKey>& keys);
+        GlyphLookup getPlaceholder() const noexcept;
+    private:
+        GlyphCache& glyphCache;
+        Rasterize rasterize;
+        std::size_t batchSize;
+        std::vector<GlyphKey> batch;
+        std::unordered_set<GlyphKey, GlyphKey::Hash> inFlight;
+        std::unordered_set<GlyphKey, GlyphKey::Hash> failed;
+        std::unordered_map<GlyphKey, Bearing, GlyphKey::Hash> bearings;
+        std::deque<Result> ready;
+        std::mutex finishedMutex;
+        std::vector<Result> finished;
+        core::utility::WorkStealingThreadPool threadPool;
+    };
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef INCLUDE_FUJI_TEXT_GLYPH_RENDERER_HPP
+#define INCLUDE_FUJI_TEXT_GLYPH_RENDERER_HPP
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/bindless_image_table.hpp>
+#include <fuji/core/internal/utility/pipeline_cache.hpp>
+#include <fuji/text/glyph_cache.hpp>
+#include <fuji/text/glyph_instance.hpp>
+#include <fuji/text/glyph_rasterizer.hpp>
+
+namespace fuji::text {
+    // Draws GlyphInstances sampled from a GlyphCache. Set 0 holds the cache's 2D array image at binding 0
+    // and a uniform palette of paletteSize colours at binding 1; colorIndex selects the palette entry.
+    // Viewport and scissor are dynamic and set by bind().
+    //
+    // A bindless renderer instead holds only the sampler and the palette in set 0 and binds the
+    // BindlessImageTable as set 1; GlyphInstance::layer is then a table index, so text from any number of
+    // caches is drawn with the same bound sets. Register a cache with table.add(cache.getPageImageViews(),
+    // vk::ImageLayout::eGeneral) and pass the returned index to createInstance() as firstPage.
+    class GlyphRenderer {
+    public:
+        static constexpr std::uint32_t paletteSize = 256;
+        static constexpr vk::DeviceSize paletteByteSize = sizeof(float) * 4 * paletteSize;
+
+        GlyphRenderer(const vk::Device& device, core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, std::uint32_t subpass = 0);
+        GlyphRenderer(const vk::Device& device, core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, const core::utility::BindlessImageTable& imageTable, std::uint32_t subpass = 0);
+        GlyphRenderer(const GlyphRenderer&) = delete;
+        ~GlyphRenderer() = default;
+        const vk::DescriptorSetLayout& getDescriptorSetLayout() const;
+        const vk::PipelineLayout& getPipelineLayout() const;
+        const vk::Pipeline& getPipeline() const;
+        bool isBindless() const noexcept;
+        void writeDescriptorSet(const vk::DescriptorSet& descriptorSet, const GlyphCache& glyphCache, const vk::Buffer& palette, vk::DeviceSize paletteOffset = 0) const;
+        void writeDescriptorSet(const vk::DescriptorSet& descriptorSet, const vk::Buffer& palette, vk::DeviceSize paletteOffset = 0) const;
+        void bind(vk::CommandBuffer& commandBuffer, const vk::DescriptorSet& descriptorSet, vk::Extent2D extent, std::uint32_t atlasPageSize, glm::vec2 origin = glm::vec2(0.0f), glm::vec2 quadScale = glm::vec2(1.0f)) const;
+        void draw(vk::CommandBuffer& commandBuffer, const vk::Buffer& instanceBuffer, vk::DeviceSize offset, std::uint32_t glyphCount) const;
+
+        static GlyphInstance createInstance(glm::vec2 pen, const GlyphLookup& lookup, std::uint16_t colorIndex, std::uint32_t firstPage = 0) noexcept;
+    private:
+        void createSampler();
+        void createPipeline(core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, std::uint32_t subpass, vk::ArrayProxy<const vk::DescriptorSetLayout> setLayouts, vk::ArrayProxy<const std::uint32_t> fragmentCode);
+    private:
+        vk::Device device;
+        const core::utility::BindlessImageTable* imageTable;
+        vk::UniqueSampler sampler;
+        vk::UniqueDescriptorSetLayout descriptorSetLayout;
+        vk::UniquePipelineLayout pipelineLayout;
+        vk::UniquePipeline pipeline;
+    };
+}
+
+#endif
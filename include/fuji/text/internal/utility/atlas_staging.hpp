@@ -0,0 +1,36 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_ATLAS_STAGING_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_ATLAS_STAGING_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+#include <fuji/text/internal/utility/skyline_packer.hpp>
+
+namespace fuji::text::utility {
+    // padded coverage rectangles waiting for the next upload into an atlas image
+    class AtlasStaging {
+    public:
+        explicit AtlasStaging(std::uint32_t padding) noexcept;
+        void stage(std::uint32_t layer, const PackedRect& rect, const std::uint8_t* coverage, std::uint32_t rowPitch);
+        bool upload(core::utility::UploadScheduler& uploadScheduler, const vk::Image& image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, vk::SharingMode sharingMode);
+        void clear() noexcept;
+        std::uint32_t getPadding() const noexcept;
+        std::size_t getPendingRegionCount() const noexcept;
+        vk::DeviceSize getPendingUploadSize() const noexcept;
+    private:
+        struct DirtyRect {
+            std::uint32_t layer;
+            PackedRect rect;
+            vk::DeviceSize offset;
+        };
+    private:
+        std::uint32_t padding;
+        std::vector<std::uint8_t> pendingPixels;
+        std::vector<DirtyRect> dirtyRects;
+    };
+}
+
+#endif
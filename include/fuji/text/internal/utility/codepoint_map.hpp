@@ -0,0 +1,46 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_CODEPOINT_MAP_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_CODEPOINT_MAP_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fuji::text::utility {
+    // Two-level codepoint to glyph table. The first level has one slot per 256-codepoint page; a page is
+    // filled from the slow resolver the first time any of its codepoints is looked up, and pages without
+    // any mapped codepoint share a single empty page. Lookups are lock-free once a page exists.
+    class CodepointMap {
+    public:
+        using Resolve = std::function<std::uint32_t(char32_t)>;
+
+        static constexpr std::uint32_t pageSize = 256;
+        static constexpr std::uint32_t pageCount = 0x110000 / pageSize;
+
+        explicit CodepointMap(Resolve resolve);
+        CodepointMap(const CodepointMap&) = delete;
+        ~CodepointMap() = default;
+        std::uint32_t find(char32_t codepoint) const;
+        void find(const char32_t* codepoints, std::size_t count, std::uint32_t* glyphIndices) const;
+        std::size_t getBuiltPageCount() const;
+    private:
+        struct Page {
+            std::array<std::uint16_t, pageSize> glyphIndices;
+        };
+
+        const Page& getPage(std::uint32_t pageIndex) const;
+    private:
+        Resolve resolve;
+        Page emptyPage;
+        std::unique_ptr<std::atomic<const Page*>[]> directory;
+        mutable std::mutex mutex;
+        mutable std::vector<std::unique_ptr<Page>> pages;
+        mutable std::size_t builtPageCount;
+    };
+}
+
+#endif
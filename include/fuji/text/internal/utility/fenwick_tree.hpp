@@ -0,0 +1,35 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_FENWICK_TREE_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_FENWICK_TREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fuji::text::utility {
+    // Binary indexed tree over non-negative counts. Point updates, prefix sums, appends and searching
+    // for the element containing a given prefix position are O(log n); insert and erase in the middle
+    // rebuild the tree in O(n) without touching anything but the counts.
+    class FenwickTree {
+    public:
+        FenwickTree() = default;
+        explicit FenwickTree(const std::vector<std::int64_t>& values);
+        std::size_t size() const noexcept;
+        std::int64_t get(std::size_t index) const noexcept;
+        void set(std::size_t index, std::int64_t value) noexcept;
+        void add(std::size_t index, std::int64_t delta) noexcept;
+        void pushBack(std::int64_t value);
+        void insert(std::size_t index, std::int64_t value);
+        void erase(std::size_t index);
+        void clear() noexcept;
+        std::int64_t prefixSum(std::size_t count) const noexcept;
+        std::int64_t total() const noexcept;
+        std::size_t upperBound(std::int64_t position) const noexcept;
+    private:
+        void rebuild() noexcept;
+    private:
+        std::vector<std::int64_t> values;
+        std::vector<std::int64_t> tree;
+    };
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_PAGED_GLYPH_INDEX_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_PAGED_GLYPH_INDEX_HPP
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <fuji/text/glyph_key.hpp>
+#include <fuji/text/internal/utility/skyline_packer.hpp>
+
+namespace fuji::text::utility {
+    // Bookkeeping for a fixed number of atlas pages. Glyphs cannot be freed individually from a skyline,
+    // so the least recently used page is evicted as a whole once every page is full. A page is only
+    // evictable when none of its glyphs was used after completedFrame. reserve() sets aside a region at the
+    // origin of page 0 that is outside the LRU and packed again whenever page 0 is evicted.
+    class PagedGlyphIndex {
+    public:
+        struct Entry {
+            std::uint32_t page;
+            PackedRect rect;
+            std::uint64_t lastUsedFrame;
+        };
+        struct Insertion {
+            Entry entry;
+            std::optional<std::uint32_t> evictedPage;
+            std::vector<GlyphKey> evictedKeys;
+        };
+
+        PagedGlyphIndex(std::uint32_t pageWidth, std::uint32_t pageHeight, std::uint32_t maxPageCount);
+        const Entry* find(const GlyphKey& key, std::uint64_t frameNumber);
+        Entry reserve(std::uint32_t width, std::uint32_t height);
+        bool canFit(std::uint32_t width, std::uint32_t height) const noexcept;
+        std::optional<Insertion> insert(const GlyphKey& key, std::uint32_t width, std::uint32_t height, std::uint64_t frameNumber, std::uint64_t completedFrameNumber);
+        void clear();
+        std::uint32_t getPageCount() const noexcept;
+        std::uint32_t getMaxPageCount() const noexcept;
+        std::size_t getGlyphCount() const noexcept;
+        std::uint64_t getEvictionCount() const noexcept;
+    private:
+        struct Page {
+            SkylinePacker packer;
+            std::uint64_t lastUsedFrame;
+            std::vector<GlyphKey> keys;
+        };
+    private:
+        std::optional<std::uint32_t> findEvictablePage(std::uint32_t width, std::uint32_t height, std::uint64_t completedFrameNumber) const;
+        std::vector<GlyphKey> evict(std::uint32_t page);
+        bool fitsEmptyPage(std::uint32_t page, std::uint32_t width, std::uint32_t height) const noexcept;
+        void createPage();
+    private:
+        std::uint32_t pageWidth;
+        std::uint32_t pageHeight;
+        std::uint32_t maxPageCount;
+        std::vector<Page> pages;
+        std::optional<PackedRect> reservedRect;
+        std::unordered_map<GlyphKey, Entry, GlyphKey::Hash> entries;
+        std::uint64_t evictionCount;
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_PAIR_ADJUSTMENT_TABLE_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_PAIR_ADJUSTMENT_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <fuji/text/internal/utility/sfnt_reader.hpp>
+
+namespace fuji::text::utility {
+    // Horizontal pair adjustments flattened out of a face's kern or GPOS table. Glyph-specific pairs
+    // live in an open-addressing hash keyed by (left << 16 | right); class-based subtables keep dense
+    // class arrays and their class-pair matrix. Glyph pairs take precedence over class pairs, earlier
+    // subtables over later ones, and only the x advance of the first glyph is kept.
+    class PairAdjustmentTable {
+    public:
+        PairAdjustmentTable();
+        static PairAdjustmentTable fromKern(const SfntReader& kern);
+        static PairAdjustmentTable fromGpos(const SfntReader& gpos);
+        std::int16_t find(std::uint16_t left, std::uint16_t right) const noexcept;
+        void apply(const std::uint32_t* glyphIndices, std::size_t count, std::int32_t* adjustments) const noexcept;
+        bool empty() const noexcept;
+        std::size_t getPairCount() const noexcept;
+        std::size_t getClassSubtableCount() const noexcept;
+    private:
+        struct ClassSubtable {
+            std::uint16_t firstGlyph;
+            std::vector<std::uint16_t> firstClasses;
+            std::uint16_t secondFirstGlyph;
+            std::vector<std::uint16_t> secondClasses;
+            std::uint16_t secondClassCount;
+            std::vector<std::int16_t> adjustments;
+        };
+
+        static constexpr std::uint32_t emptyKey = 0xFFFFFFFF;
+        static constexpr std::uint16_t uncovered = 0xFFFF;
+
+        void addPairSubtable(const SfntReader& subtable);
+        void addClassSubtable(const SfntReader& subtable);
+        void insert(std::uint16_t left, std::uint16_t right, std::int16_t adjustment);
+        void rehash(std::size_t capacity);
+    private:
+        std::vector<std::uint32_t> keys;
+        std::vector<std::int16_t> values;
+        std::size_t pairCount;
+        std::vector<ClassSubtable> classSubtables;
+    };
+}
+
+#endif
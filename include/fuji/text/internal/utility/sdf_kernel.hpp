@@ -0,0 +1,21 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_SDF_KERNEL_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_SDF_KERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fuji::text::utility {
+    struct LineSegment {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+    };
+
+    // Lowers distances[i] to the squared distance between (i + 0.5, y) and the nearest segment.
+    void updateRowDistances(float* distances, std::uint32_t count, float y, const LineSegment* segments, std::size_t segmentCount);
+    void updateRowDistancesScalar(float* distances, std::uint32_t count, float y, const LineSegment* segments, std::size_t segmentCount);
+    const char* getSdfKernelName() noexcept;
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_SFNT_READER_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_SFNT_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fuji::text::utility {
+    constexpr std::uint32_t makeTag(char a, char b, char c, char d) noexcept {
+        return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(a)) << 24)
+            | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) << 16)
+            | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 8)
+            | static_cast<std::uint32_t>(static_cast<std::uint8_t>(d));
+    }
+
+    // Bounds-checked big-endian view over font data. Reads past the end throw std::runtime_error so a
+    // truncated or malicious font never reads outside the mapping.
+    class SfntReader {
+    public:
+        SfntReader() noexcept;
+        SfntReader(const std::uint8_t* data, std::size_t size) noexcept;
+        const std::uint8_t* getData() const noexcept;
+        std::size_t getSize() const noexcept;
+        bool empty() const noexcept;
+        bool contains(std::size_t offset, std::size_t length) const noexcept;
+        SfntReader subspan(std::size_t offset, std::size_t length) const;
+        SfntReader subspan(std::size_t offset) const;
+        std::uint8_t readU8(std::size_t offset) const;
+        std::int8_t readI8(std::size_t offset) const;
+        std::uint16_t readU16(std::size_t offset) const;
+        std::int16_t readI16(std::size_t offset) const;
+        std::uint32_t readU32(std::size_t offset) const;
+    private:
+        const std::uint8_t* data;
+        std::size_t size;
+    };
+}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef INCLUDE_FUJI_TEXT_UTILITY_SKYLINE_PACKER_HPP
+#define INCLUDE_FUJI_TEXT_UTILITY_SKYLINE_PACKER_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace fuji::text::utility {
+    struct PackedRect {
+        std::uint32_t x;
+        std::uint32_t y;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    class SkylinePacker {
+    public:
+        SkylinePacker(std::uint32_t width, std::uint32_t height);
+        std::optional<PackedRect> pack(std::uint32_t width, std::uint32_t height);
+        void reset();
+        std::uint32_t getWidth() const noexcept;
+        std::uint32_t getHeight() const noexcept;
+        std::uint64_t getUsedArea() const noexcept;
+        float getOccupancy() const noexcept;
+    private:
+        struct Node {
+            std::uint32_t x;
+            std::uint32_t y;
+            std::uint32_t width;
+        };
+    private:
+        std::optional<std::uint32_t> fit(std::size_t index, std::uint32_t width, std::uint32_t height) const;
+        void merge();
+    private:
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint64_t usedArea;
+        std::vector<Node> skyline;
+    };
+}
+
+#endif
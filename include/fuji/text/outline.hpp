@@ -0,0 +1,46 @@
+#ifndef INCLUDE_FUJI_TEXT_OUTLINE_HPP
+#define INCLUDE_FUJI_TEXT_OUTLINE_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace fuji::text {
+    struct OutlinePoint {
+        float x;
+        float y;
+    };
+
+    struct OutlineBounds {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+    };
+
+    class Outline {
+    public:
+        enum class Verb : std::uint8_t {
+            eMoveTo,
+            eLineTo,
+            eQuadTo,
+            eCubicTo,
+            eClose
+        };
+
+        void moveTo(float x, float y);
+        void lineTo(float x, float y);
+        void quadTo(float controlX, float controlY, float x, float y);
+        void cubicTo(float control1X, float control1Y, float control2X, float control2Y, float x, float y);
+        void close();
+        void clear() noexcept;
+        bool empty() const noexcept;
+        const std::vector<Verb>& getVerbs() const noexcept;
+        const std::vector<OutlinePoint>& getPoints() const noexcept;
+        OutlineBounds getBounds() const noexcept;
+    private:
+        std::vector<Verb> verbs;
+        std::vector<OutlinePoint> points;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef INCLUDE_FUJI_TEXT_SDF_GENERATOR_HPP
+#define INCLUDE_FUJI_TEXT_SDF_GENERATOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <fuji/text/outline.hpp>
+#include <fuji/text/internal/utility/sdf_kernel.hpp>
+
+namespace fuji::text {
+    struct SdfBitmap {
+        std::uint32_t width;
+        std::uint32_t height;
+        std::int32_t left;
+        std::int32_t top;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    // Generates single-channel signed distance fields directly from outlines. Curves are flattened to
+    // line segments and the nearest-segment search runs on SSE2/AVX2 when available. Pixels encode
+    // 0.5 + distance / (2 * spread), so 128 lies on the outline and the value grows towards the inside.
+    class SdfGenerator {
+    public:
+        explicit SdfGenerator(float spread = 4.0f, float flatness = 0.2f);
+        SdfBitmap generate(const Outline& outline, float scale) const;
+        float getSpread() const noexcept;
+        static const char* getKernelName() noexcept;
+    private:
+        std::vector<utility::LineSegment> flatten(const Outline& outline, float scale, float originX, float originY) const;
+    private:
+        float spread;
+        float flatness;
+    };
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef INCLUDE_FUJI_TEXT_SHAPED_RUN_CACHE_HPP
+#define INCLUDE_FUJI_TEXT_SHAPED_RUN_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fuji::text {
+    struct FontFeature {
+        std::uint32_t tag;
+        std::uint32_t value;
+
+        bool operator==(const FontFeature& other) const noexcept {
+            return this->tag == other.tag && this->value == other.value;
+        }
+    };
+
+    struct ShapedGlyph {
+        std::uint32_t glyphIndex;
+        std::uint32_t cluster;
+        float advance;
+        float offsetX;
+        float offsetY;
+    };
+
+    struct ShapedRun {
+        std::vector<ShapedGlyph> glyphs;
+        float advance;
+    };
+
+    // Features are compared in canonical form: sorted by tag, with a repeated tag keeping its last value.
+    struct ShapingKey {
+        std::uint32_t fontId;
+        float size;
+        std::vector<FontFeature> features;
+
+        static std::vector<FontFeature> canonicalizeFeatures(std::vector<FontFeature> features);
+        static std::uint64_t hashFeatures(const std::vector<FontFeature>& features);
+    };
+
+    // LRU cache of shaped runs keyed by font, size, feature set and the UTF-8 text. Runs are handed out
+    // as shared pointers so eviction never invalidates a run the caller still holds. With word splitting
+    // enabled, text is shaped per space-terminated word and the cached words are stitched together, so
+    // sentences that share words share cache entries; this ignores kerning across spaces.
+    class ShapedRunCache {
+    public:
+        using Shape = std::function<ShapedRun(const ShapingKey&, std::string_view)>;
+
+        explicit ShapedRunCache(std::size_t memoryBudget);
+        ShapedRunCache(const ShapedRunCache&) = delete;
+        ~ShapedRunCache() = default;
+        std::shared_ptr<const ShapedRun> find(const ShapingKey& key, std::string_view text);
+        std::shared_ptr<const ShapedRun> insert(const ShapingKey& key, std::string_view text, ShapedRun run);
+        std::shared_ptr<const ShapedRun> shape(const ShapingKey& key, std::string_view text, const Shape& shaper, bool splitWords = false);
+        void clear() noexcept;
+        std::size_t getMemoryBudget() const noexcept;
+        std::size_t getMemoryUsage() const noexcept;
+        std::size_t getEntryCount() const noexcept;
+        std::uint64_t getHitCount() const noexcept;
+        std::uint64_t getMissCount() const noexcept;
+        std::uint64_t getEvictionCount() const noexcept;
+    private:
+        struct Entry {
+            ShapingKey key;
+            std::string text;
+            std::size_t hash;
+            std::size_t memorySize;
+            std::shared_ptr<const ShapedRun> run;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        static std::size_t hash(const ShapingKey& key, std::string_view text) noexcept;
+        EntryList::iterator lookup(const ShapingKey& key, std::string_view text, std::size_t hash);
+        std::shared_ptr<const ShapedRun> findCanonical(const ShapingKey& key, std::string_view text);
+        std::shared_ptr<const ShapedRun> insertCanonical(const ShapingKey& key, std::string_view text, ShapedRun run);
+        std::shared_ptr<const ShapedRun> shapeWord(const ShapingKey& key, std::string_view text, const Shape& shaper);
+        void evict();
+    private:
+        std::size_t memoryBudget;
+        std::size_t memoryUsage;
+        std::uint64_t hitCount;
+        std::uint64_t missCount;
+        std::uint64_t evictionCount;
+        EntryList entries;
+        std::unordered_multimap<std::size_t, EntryList::iterator> index;
+    };
+}
+
+#endif
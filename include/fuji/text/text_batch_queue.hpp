@@ -0,0 +1,57 @@
+#ifndef INCLUDE_FUJI_TEXT_TEXT_BATCH_QUEUE_HPP
+#define INCLUDE_FUJI_TEXT_TEXT_BATCH_QUEUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/glyph_instance.hpp>
+
+namespace fuji::text {
+    // Blocks are drawn in ascending order; within one order value they are grouped by pipeline (which carries
+    // the blend state), descriptor set (which selects the atlas) and the atlas page size pushed by bind().
+    struct TextBatchKey {
+        std::int32_t order = 0;
+        vk::Pipeline pipeline;
+        vk::DescriptorSet descriptorSet;
+        std::uint32_t atlasPageSize = 0;
+    };
+
+    struct TextBatch {
+        TextBatchKey key;
+        std::uint32_t firstInstance;
+        std::uint32_t instanceCount;
+        std::uint32_t blockCount;
+    };
+
+    // Collects text blocks for one frame and merges blocks that share a pipeline, descriptor set and page size into
+    // contiguous instance ranges. Block origins are folded into the instance positions, so a merged batch
+    // is a single draw. Blocks keep their submission order within a key.
+    class TextBatchQueue {
+    public:
+        void add(const TextBatchKey& key, glm::vec2 origin, const GlyphInstance* instances, std::uint32_t instanceCount);
+        void add(const TextBatchKey& key, glm::vec2 origin, const std::vector<GlyphInstance>& instances);
+        void build();
+        void clear() noexcept;
+        bool empty() const noexcept;
+        std::size_t getBlockCount() const noexcept;
+        const std::vector<TextBatch>& getBatches() const noexcept;
+        const std::vector<GlyphInstance>& getInstances() const noexcept;
+    private:
+        struct Block {
+            TextBatchKey key;
+            std::uint32_t firstInstance;
+            std::uint32_t instanceCount;
+        };
+    private:
+        std::vector<Block> blocks;
+        std::vector<GlyphInstance> queuedInstances;
+        std::vector<GlyphInstance> instances;
+        std::vector<TextBatch> batches;
+    };
+}
+
+#endif
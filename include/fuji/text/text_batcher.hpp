@@ -0,0 +1,59 @@
+#ifndef INCLUDE_FUJI_TEXT_TEXT_BATCHER_HPP
+#define INCLUDE_FUJI_TEXT_TEXT_BATCHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/frame_ring.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/streaming_buffer.hpp>
+#include <fuji/text/glyph_instance.hpp>
+#include <fuji/text/text_batch_queue.hpp>
+
+namespace fuji::text {
+    struct TextBatchStatistics {
+        std::size_t blockCount = 0;
+        std::size_t batchCount = 0;
+        std::size_t drawCallCount = 0;
+        std::size_t instanceCount = 0;
+    };
+
+    // Draws a frame's worth of queued text blocks with one drawIndirect per batch. Merged instances and the
+    // vk::DrawIndirectCommand array are streamed into per-frame ring buffers. When the device has the
+    // drawIndirectFirstInstance feature enabled, the instance buffer is bound once and firstInstance addresses
+    // each batch; otherwise firstInstance stays 0 and binding 0 is rebound at each batch's byte offset. The bind
+    // callback binds the pipeline, descriptor set and push constants for a batch key and must leave binding 0 alone.
+    class TextBatcher {
+    public:
+        using Bind = std::function<void(vk::CommandBuffer&, const TextBatchKey&)>;
+
+        static constexpr vk::DeviceSize defaultInstanceCapacity = 4 * 1024 * 1024;
+
+        TextBatcher(core::utility::MemoryAllocator& allocator, core::utility::FrameRing& frameRing, vk::DeviceSize instanceCapacity = defaultInstanceCapacity, std::uint32_t maxBatchCount = 4096, bool drawIndirectFirstInstance = false);
+        TextBatcher(const TextBatcher&) = delete;
+        ~TextBatcher() = default;
+        void beginFrame();
+        void add(const TextBatchKey& key, glm::vec2 origin, const GlyphInstance* instances, std::uint32_t instanceCount);
+        void add(const TextBatchKey& key, glm::vec2 origin, const std::vector<GlyphInstance>& instances);
+        void record(vk::CommandBuffer& commandBuffer, const Bind& bind);
+        void endFrame();
+        const TextBatchStatistics& getStatistics() const noexcept;
+        const std::vector<vk::DrawIndirectCommand>& getDrawCommands() const noexcept;
+
+        static bool isFirstInstanceSupported(const vk::PhysicalDevice& physicalDevice);
+    private:
+        bool drawIndirectFirstInstance;
+        TextBatchQueue queue;
+        core::utility::StreamingBuffer instanceBuffer;
+        core::utility::StreamingBuffer indirectBuffer;
+        std::vector<vk::DrawIndirectCommand> commands;
+        TextBatchStatistics statistics;
+    };
+}
+
+#endif
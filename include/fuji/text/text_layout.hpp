@@ -0,0 +1,91 @@
+#ifndef INCLUDE_FUJI_TEXT_TEXT_LAYOUT_HPP
+#define INCLUDE_FUJI_TEXT_TEXT_LAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fuji/text/shaped_run_cache.hpp>
+#include <fuji/text/internal/utility/fenwick_tree.hpp>
+
+namespace fuji::text {
+    enum class TextAlignment {
+        eLeft,
+        eCenter,
+        eRight
+    };
+
+    struct LayoutLine {
+        std::uint32_t firstGlyph;
+        std::uint32_t glyphCount;
+        std::uint32_t textBegin;
+        std::uint32_t textEnd;
+        float width;
+        float x;
+    };
+
+    struct ParagraphLayout {
+        std::string text;
+        std::shared_ptr<const ShapedRun> run;
+        std::vector<LayoutLine> lines;
+        std::uint64_t generation;
+        std::uint64_t shapedGeneration;
+        std::uint64_t brokenGeneration;
+        std::uint64_t alignedGeneration;
+    };
+
+    // Paragraph-granular text layout. Every paragraph carries its own generation counter; update()
+    // re-shapes only paragraphs whose text changed, re-breaks lines only when the text or the wrapping
+    // width changed, and re-aligns otherwise. Line counts are kept in a Fenwick tree so the vertical
+    // offset of any paragraph is a prefix sum and edits never rewrite the offsets of later paragraphs.
+    class TextLayout {
+    public:
+        using Shape = std::function<std::shared_ptr<const ShapedRun>(std::string_view)>;
+
+        static constexpr float unlimitedWidth = std::numeric_limits<float>::infinity();
+
+        TextLayout(Shape shaper, float lineHeight, float width = unlimitedWidth, TextAlignment alignment = TextAlignment::eLeft);
+        void setText(std::string_view text);
+        void setParagraph(std::size_t index, std::string_view text);
+        void insertParagraph(std::size_t index, std::string_view text);
+        void appendParagraph(std::string_view text);
+        void eraseParagraph(std::size_t index);
+        void setWidth(float width);
+        void setAlignment(TextAlignment alignment);
+        std::size_t update();
+        std::size_t getParagraphCount() const noexcept;
+        const ParagraphLayout& getParagraph(std::size_t index) const;
+        float getParagraphTop(std::size_t index) const;
+        std::size_t findParagraph(float y) const noexcept;
+        std::size_t getLineCount() const noexcept;
+        float getHeight() const noexcept;
+        float getLineHeight() const noexcept;
+        float getWidth() const noexcept;
+        TextAlignment getAlignment() const noexcept;
+        bool isDirty() const noexcept;
+    private:
+        ParagraphLayout createParagraph(std::string_view text);
+        void markDirty(std::size_t index) noexcept;
+        void breakLines(ParagraphLayout& paragraph) const;
+        void alignLines(ParagraphLayout& paragraph) const;
+    private:
+        Shape shaper;
+        float lineHeight;
+        float width;
+        TextAlignment alignment;
+        std::uint64_t generation;
+        std::uint64_t widthGeneration;
+        std::uint64_t alignmentGeneration;
+        std::vector<ParagraphLayout> paragraphs;
+        std::vector<std::size_t> dirtyParagraphs;
+        bool allDirty;
+        utility::FenwickTree lineCounts;
+    };
+}
+
+#endif
@@ -1 +1,128 @@
-#include <fuji/core/instance.hpp>
\ No newline at end of file
+#include <fuji/core/instance.hpp>
+
+#include <vector>
+
+namespace {
+    vk::UniqueRenderPass createRenderPass(vk::Device device, vk::Format colorFormat, vk::ImageLayout finalLayout) {
+        vk::AttachmentDescription colorAttachment {};
+        colorAttachment.format = colorFormat;
+        colorAttachment.samples = vk::SampleCountFlagBits::e1;
+        colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+        colorAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+        colorAttachment.stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
+        colorAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+        colorAttachment.initialLayout = vk::ImageLayout::eUndefined;
+        colorAttachment.finalLayout = finalLayout;
+
+        vk::AttachmentReference colorAttachmentRef {};
+        colorAttachmentRef.attachment = 0;
+        colorAttachmentRef.layout = vk::ImageLayout::eColorAttachmentOptimal;
+
+        vk::SubpassDescription subpass {};
+        subpass.pipelineBindPoint = vk::PipelineBindPoint::eGraphics;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorAttachmentRef;
+
+        vk::SubpassDependency dependency {};
+        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependency.dstSubpass = 0;
+        dependency.srcStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+        dependency.srcAccessMask = vk::AccessFlags { 0 };
+        dependency.dstStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+        dependency.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+        std::vector<vk::SubpassDependency> dependencies { dependency };
+
+        // offscreen targets are copied out right after the pass, so make the attachment writes visible to transfer reads
+        if(finalLayout == vk::ImageLayout::eTransferSrcOptimal) {
+            vk::SubpassDependency outgoingDependency {};
+            outgoingDependency.srcSubpass = 0;
+            outgoingDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+            outgoingDependency.srcStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+            outgoingDependency.srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+            outgoingDependency.dstStageMask = vk::PipelineStageFlagBits::eTransfer;
+            outgoingDependency.dstAccessMask = vk::AccessFlagBits::eTransferRead;
+            dependencies.push_back(outgoingDependency);
+        }
+
+        vk::RenderPassCreateInfo renderPassInfo {};
+        renderPassInfo.attachmentCount = 1;
+        renderPassInfo.pAttachments = &colorAttachment;
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        renderPassInfo.dependencyCount = static_cast<std::uint32_t>(dependencies.size());
+        renderPassInfo.pDependencies = dependencies.data();
+
+        return device.createRenderPassUnique(renderPassInfo);
+    }
+}
+
+fuji::Instance::Instance(vk::UniqueDevice& device, std::uint32_t queueFamilyIndex, vk::Format colorFormat, std::uint32_t framesInFlight, core::utility::DynamicStateSupport dynamicStateSupport, vk::ImageLayout finalLayout)
+        : device(device), frameRing(device.get(), queueFamilyIndex, framesInFlight), dynamicStateRecorder(device.get(), dynamicStateSupport), clearColor { 0.0f, 0.0f, 0.0f, 1.0f }, finalLayout(finalLayout) {
+    this->renderPass = createRenderPass(this->device.get(), colorFormat, finalLayout);
+}
+
+const vk::RenderPass& fuji::Instance::getRenderPass() const {
+    return this->renderPass.get();
+}
+
+vk::ImageLayout fuji::Instance::getFinalLayout() const noexcept {
+    return this->finalLayout;
+}
+
+fuji::core::utility::DynamicStateValues& fuji::Instance::getDynamicStateValues() noexcept {
+    return this->dynamicStateValues;
+}
+
+fuji::core::utility::FrameRing& fuji::Instance::getFrameRing() noexcept {
+    return this->frameRing;
+}
+
+void fuji::Instance::setClearColor(const std::array<float, 4>& clearColor) noexcept {
+    this->clearColor = clearColor;
+}
+
+fuji::core::utility::FrameSlot& fuji::Instance::beginFrame() {
+    return this->frameRing.acquire();
+}
+
+void fuji::Instance::beginRenderPass(vk::CommandBuffer& commandBuffer, vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent) {
+    this->dynamicStateValues.setExtent(extent);
+
+    vk::ClearValue clearValue {
+        vk::ClearColorValue { this->clearColor }
+    };
+    vk::RenderPassBeginInfo renderPassInfo {};
+    renderPassInfo.renderPass = this->renderPass.get();
+    renderPassInfo.framebuffer = framebuffer.get();
+    renderPassInfo.renderArea.offset = vk::Offset2D { 0, 0 };
+    renderPassInfo.renderArea.extent = extent;
+    renderPassInfo.clearValueCount = 1;
+    renderPassInfo.pClearValues = &clearValue;
+
+    commandBuffer.beginRenderPass(renderPassInfo, vk::SubpassContents::eInline);
+}
+
+void fuji::Instance::bindPipeline(vk::CommandBuffer& commandBuffer, const vk::Pipeline& pipeline) const {
+    commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+    this->dynamicStateRecorder.record(commandBuffer, this->dynamicStateValues);
+}
+
+void fuji::Instance::endRenderPass(vk::CommandBuffer& commandBuffer) const {
+    commandBuffer.endRenderPass();
+}
+
+void fuji::Instance::draw(vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent, const Record& record) {
+    this->draw(this->frameRing.getCurrentSlot().commandBuffer.get(), framebuffer, extent, record);
+}
+
+void fuji::Instance::draw(vk::CommandBuffer& commandBuffer, vk::UniqueFramebuffer& framebuffer, vk::Extent2D extent, const Record& record) {
+    this->beginRenderPass(commandBuffer, framebuffer, extent);
+    if(record) {
+        record(commandBuffer);
+    }
+    this->endRenderPass(commandBuffer);
+}
+
+void fuji::Instance::endFrame(const vk::Queue& queue, vk::ArrayProxy<const vk::Semaphore> waitSemaphores, vk::ArrayProxy<const vk::PipelineStageFlags> waitStages, vk::ArrayProxy<const vk::Semaphore> signalSemaphores) {
+    this->frameRing.submit(queue, waitSemaphores, waitStages, signalSemaphores);
+}
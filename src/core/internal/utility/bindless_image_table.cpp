@@ -0,0 +1,161 @@
+#include <fuji/core/internal/utility/bindless_image_table.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+    // checked before the slot allocator is sized from the capacity
+    std::uint32_t checkCapacity(const vk::PhysicalDevice& physicalDevice, std::uint32_t capacity) {
+        if(capacity > fuji::core::utility::BindlessImageTable::getMaxCapacity(physicalDevice)) {
+            throw std::invalid_argument("BindlessImageTable capacity exceeds the update-after-bind sampled image limits");
+        }
+        return capacity;
+    }
+}
+
+fuji::core::utility::BindlessImageTable::BindlessImageTable(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, std::uint32_t capacity, vk::ShaderStageFlags stageFlags)
+        : device(device), capacity(checkCapacity(physicalDevice, capacity)), frameNumber(0), slotAllocator(capacity, 1) {
+    vk::DescriptorSetLayoutBinding binding {};
+    binding.binding = 0;
+    binding.descriptorType = vk::DescriptorType::eSampledImage;
+    binding.descriptorCount = capacity;
+    binding.stageFlags = stageFlags;
+
+    vk::DescriptorBindingFlags bindingFlags =
+        vk::DescriptorBindingFlagBits::ePartiallyBound
+      | vk::DescriptorBindingFlagBits::eUpdateAfterBind
+      | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+    vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo {};
+    bindingFlagsInfo.bindingCount = 1;
+    bindingFlagsInfo.pBindingFlags = &bindingFlags;
+
+    vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutInfo {};
+    descriptorSetLayoutInfo.pNext = &bindingFlagsInfo;
+    descriptorSetLayoutInfo.flags = vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool;
+    descriptorSetLayoutInfo.bindingCount = 1;
+    descriptorSetLayoutInfo.pBindings = &binding;
+    this->descriptorSetLayout = this->device.createDescriptorSetLayoutUnique(descriptorSetLayoutInfo);
+
+    vk::DescriptorPoolSize poolSize { vk::DescriptorType::eSampledImage, capacity };
+    vk::DescriptorPoolCreateInfo poolInfo {};
+    poolInfo.flags = vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    this->descriptorPool = this->device.createDescriptorPoolUnique(poolInfo);
+
+    vk::DescriptorSetAllocateInfo allocateInfo {};
+    allocateInfo.descriptorPool = this->descriptorPool.get();
+    allocateInfo.descriptorSetCount = 1;
+    allocateInfo.pSetLayouts = &this->descriptorSetLayout.get();
+    this->descriptorSet = this->device.allocateDescriptorSets(allocateInfo)[0];
+}
+
+void fuji::core::utility::BindlessImageTable::beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber) {
+    this->frameNumber = frameNumber;
+    auto completed = std::stable_partition(this->pendingRemovals.begin(), this->pendingRemovals.end(),
+        [completedFrameNumber](const PendingRemoval& removal) { return removal.frameNumber > completedFrameNumber; });
+    std::for_each(completed, this->pendingRemovals.end(), [this](const PendingRemoval& removal) { this->slotAllocator.free(removal.firstIndex); });
+    this->pendingRemovals.erase(completed, this->pendingRemovals.end());
+}
+
+std::uint32_t fuji::core::utility::BindlessImageTable::add(vk::ArrayProxy<const vk::ImageView> imageViews, vk::ImageLayout imageLayout) {
+    if(imageViews.empty()) {
+        throw std::invalid_argument("BindlessImageTable requires at least one image view");
+    }
+    auto firstIndex = this->slotAllocator.allocate(imageViews.size());
+    if(!firstIndex) {
+        throw std::runtime_error("BindlessImageTable has no free range for the image views");
+    }
+    this->write(static_cast<std::uint32_t>(firstIndex.value()), imageViews, imageLayout);
+    this->allocatedRanges.emplace(static_cast<std::uint32_t>(firstIndex.value()), imageViews.size());
+    return static_cast<std::uint32_t>(firstIndex.value());
+}
+
+void fuji::core::utility::BindlessImageTable::update(std::uint32_t index, const vk::ImageView& imageView, vk::ImageLayout imageLayout) {
+    if(index >= this->capacity) {
+        throw std::out_of_range("BindlessImageTable index is out of range");
+    }
+    // only slots inside a range returned by add() and not yet removed may be rewritten
+    auto range = this->allocatedRanges.upper_bound(index);
+    if(range == this->allocatedRanges.begin() || index >= std::prev(range)->first + std::prev(range)->second) {
+        throw std::invalid_argument("BindlessImageTable index is not in a range returned by add()");
+    }
+    this->write(index, imageView, imageLayout);
+}
+
+void fuji::core::utility::BindlessImageTable::remove(std::uint32_t firstIndex) {
+    // removing erases the index, so a second remove of the same range is rejected here as well
+    if(this->allocatedRanges.erase(firstIndex) == 0) {
+        throw std::invalid_argument("BindlessImageTable index was not returned by add() or is already removed");
+    }
+    this->pendingRemovals.push_back(PendingRemoval { firstIndex, this->frameNumber });
+}
+
+const vk::DescriptorSetLayout& fuji::core::utility::BindlessImageTable::getDescriptorSetLayout() const {
+    return this->descriptorSetLayout.get();
+}
+
+const vk::DescriptorSet& fuji::core::utility::BindlessImageTable::getDescriptorSet() const {
+    return this->descriptorSet;
+}
+
+std::uint32_t fuji::core::utility::BindlessImageTable::getCapacity() const noexcept {
+    return this->capacity;
+}
+
+std::uint32_t fuji::core::utility::BindlessImageTable::getUsedCount() const noexcept {
+    return static_cast<std::uint32_t>(this->slotAllocator.getRequestedBytes());
+}
+
+std::uint32_t fuji::core::utility::BindlessImageTable::getReservedCount() const noexcept {
+    return static_cast<std::uint32_t>(this->slotAllocator.getAllocatedBytes());
+}
+
+std::size_t fuji::core::utility::BindlessImageTable::getPendingRemovalCount() const noexcept {
+    return this->pendingRemovals.size();
+}
+
+bool fuji::core::utility::BindlessImageTable::isSupported(const vk::PhysicalDevice& physicalDevice) {
+    auto chain = physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures>();
+    auto& features = chain.get<vk::PhysicalDeviceDescriptorIndexingFeatures>();
+    return features.runtimeDescriptorArray
+        && features.shaderSampledImageArrayNonUniformIndexing
+        && features.descriptorBindingPartiallyBound
+        && features.descriptorBindingSampledImageUpdateAfterBind
+        && features.descriptorBindingUpdateUnusedWhilePending;
+}
+
+std::uint32_t fuji::core::utility::BindlessImageTable::getMaxCapacity(const vk::PhysicalDevice& physicalDevice) {
+    auto chain = physicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceDescriptorIndexingProperties>();
+    auto& properties = chain.get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+    return std::min(properties.maxPerStageDescriptorUpdateAfterBindSampledImages, properties.maxDescriptorSetUpdateAfterBindSampledImages);
+}
+
+vk::PhysicalDeviceDescriptorIndexingFeatures fuji::core::utility::BindlessImageTable::getRequiredFeatures() noexcept {
+    vk::PhysicalDeviceDescriptorIndexingFeatures features {};
+    features.runtimeDescriptorArray = VK_TRUE;
+    features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    features.descriptorBindingPartiallyBound = VK_TRUE;
+    features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    return features;
+}
+
+void fuji::core::utility::BindlessImageTable::write(std::uint32_t firstIndex, vk::ArrayProxy<const vk::ImageView> imageViews, vk::ImageLayout imageLayout) {
+    std::vector<vk::DescriptorImageInfo> imageInfos;
+    imageInfos.reserve(imageViews.size());
+    for(auto& imageView : imageViews) {
+        imageInfos.emplace_back(vk::Sampler {}, imageView, imageLayout);
+    }
+
+    vk::WriteDescriptorSet write {};
+    write.dstSet = this->descriptorSet;
+    write.dstBinding = 0;
+    write.dstArrayElement = firstIndex;
+    write.descriptorCount = static_cast<std::uint32_t>(imageInfos.size());
+    write.descriptorType = vk::DescriptorType::eSampledImage;
+    write.pImageInfo = imageInfos.data();
+    this->device.updateDescriptorSets(write, {});
+}
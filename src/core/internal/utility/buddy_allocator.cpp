@@ -0,0 +1,113 @@
+#include <fuji/core/internal/utility/buddy_allocator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    bool isPowerOfTwo(std::uint64_t value) {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+}
+
+// Level 0 is the whole range; level n holds blocks of size / 2^n.
+fuji::core::utility::BuddyAllocator::BuddyAllocator(std::uint64_t size, std::uint64_t minimumBlockSize)
+        : size(size), minimumBlockSize(minimumBlockSize), allocatedBytes(0), requestedBytes(0) {
+    if(!isPowerOfTwo(size) || !isPowerOfTwo(minimumBlockSize) || minimumBlockSize > size) {
+        throw std::invalid_argument("BuddyAllocator sizes must be powers of two");
+    }
+
+    std::uint32_t levelCount = 1;
+    for(std::uint64_t blockSize = size; blockSize > minimumBlockSize; blockSize >>= 1) {
+        levelCount++;
+    }
+    this->freeBlocks.resize(levelCount);
+    this->freeBlocks[0].insert(0);
+}
+
+std::optional<std::uint64_t> fuji::core::utility::BuddyAllocator::allocate(std::uint64_t size, std::uint64_t alignment) {
+    std::uint64_t required = std::max({ size, alignment, this->minimumBlockSize });
+    if(size == 0 || required > this->size) {
+        return std::nullopt;
+    }
+
+    std::uint32_t level = static_cast<std::uint32_t>(this->freeBlocks.size() - 1);
+    while(this->getBlockSize(level) < required) {
+        level--;
+    }
+
+    std::uint32_t sourceLevel = level;
+    while(this->freeBlocks[sourceLevel].empty()) {
+        if(sourceLevel == 0) {
+            return std::nullopt;
+        }
+        sourceLevel--;
+    }
+
+    std::uint64_t offset = *this->freeBlocks[sourceLevel].begin();
+    this->freeBlocks[sourceLevel].erase(this->freeBlocks[sourceLevel].begin());
+    for(; sourceLevel < level; sourceLevel++) {
+        this->freeBlocks[sourceLevel + 1].insert(offset + this->getBlockSize(sourceLevel + 1));
+    }
+
+    this->allocatedBlocks.emplace(offset, AllocatedBlock { level, size });
+    this->allocatedBytes += this->getBlockSize(level);
+    this->requestedBytes += size;
+    return offset;
+}
+
+void fuji::core::utility::BuddyAllocator::free(std::uint64_t offset) {
+    auto it = this->allocatedBlocks.find(offset);
+    if(it == this->allocatedBlocks.end()) {
+        throw std::invalid_argument("BuddyAllocator::free called with an unknown offset");
+    }
+
+    std::uint32_t level = it->second.level;
+    this->allocatedBytes -= this->getBlockSize(level);
+    this->requestedBytes -= it->second.requestedSize;
+    this->allocatedBlocks.erase(it);
+
+    while(level > 0) {
+        std::uint64_t buddy = offset ^ this->getBlockSize(level);
+        auto buddyIt = this->freeBlocks[level].find(buddy);
+        if(buddyIt == this->freeBlocks[level].end()) {
+            break;
+        }
+        this->freeBlocks[level].erase(buddyIt);
+        offset = std::min(offset, buddy);
+        level--;
+    }
+    this->freeBlocks[level].insert(offset);
+}
+
+std::uint64_t fuji::core::utility::BuddyAllocator::getSize() const noexcept {
+    return this->size;
+}
+
+std::uint64_t fuji::core::utility::BuddyAllocator::getAllocatedBytes() const noexcept {
+    return this->allocatedBytes;
+}
+
+std::uint64_t fuji::core::utility::BuddyAllocator::getRequestedBytes() const noexcept {
+    return this->requestedBytes;
+}
+
+std::uint64_t fuji::core::utility::BuddyAllocator::getLargestFreeBlock() const noexcept {
+    for(std::uint32_t level = 0; level < this->freeBlocks.size(); level++) {
+        if(!this->freeBlocks[level].empty()) {
+            return this->getBlockSize(level);
+        }
+    }
+    return 0;
+}
+
+std::size_t fuji::core::utility::BuddyAllocator::getAllocationCount() const noexcept {
+    return this->allocatedBlocks.size();
+}
+
+bool fuji::core::utility::BuddyAllocator::isEmpty() const noexcept {
+    return this->allocatedBlocks.empty();
+}
+
+std::uint64_t fuji::core::utility::BuddyAllocator::getBlockSize(std::uint32_t level) const noexcept {
+    return this->size >> level;
+}
@@ -0,0 +1,48 @@
+#include <fuji/core/internal/utility/compute_pipeline_create_info_template.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+fuji::core::utility::ComputePipelineCreateInfoTemplate::ComputePipelineCreateInfoTemplate(ShaderModule shaderModule, const vk::PipelineLayout& pipelineLayout)
+        : shaderModule(std::move(shaderModule)), pipelineLayout(pipelineLayout) {
+    if(this->shaderModule.getShaderStage() != vk::ShaderStageFlagBits::eCompute) {
+        throw std::invalid_argument("ComputePipelineCreateInfoTemplate requires a compute shader module");
+    }
+}
+
+vk::ComputePipelineCreateInfo fuji::core::utility::ComputePipelineCreateInfoTemplate::getCreateInfo() const noexcept {
+    vk::PipelineShaderStageCreateInfo stageCreateInfo {
+        {},
+        vk::ShaderStageFlagBits::eCompute,
+        this->shaderModule.getHandle(),
+        "main",
+        this->specializationConstants.empty() ? nullptr : &this->specializationInfo
+    };
+    return vk::ComputePipelineCreateInfo { {}, stageCreateInfo, this->pipelineLayout };
+}
+
+const fuji::core::utility::ShaderModule& fuji::core::utility::ComputePipelineCreateInfoTemplate::getShaderModule() const noexcept {
+    return this->shaderModule;
+}
+
+void fuji::core::utility::ComputePipelineCreateInfoTemplate::setSpecializationConstants(const SpecializationConstants& constants) {
+    this->specializationConstants = constants;
+    this->specializationInfo = this->specializationConstants.getSpecializationInfo();
+}
+
+const fuji::core::utility::SpecializationConstants& fuji::core::utility::ComputePipelineCreateInfoTemplate::getSpecializationConstants() const noexcept {
+    return this->specializationConstants;
+}
+
+std::vector<vk::UniquePipeline> fuji::core::utility::ComputePipelineCreateInfoTemplate::createComputePipeline(vk::Device& device, vk::ArrayProxy<std::unique_ptr<ComputePipelineCreateInfoTemplate>> computePipelineCreateInfos) {
+    std::vector<vk::ComputePipelineCreateInfo> createInfos;
+    std::transform(computePipelineCreateInfos.begin(), computePipelineCreateInfos.end(), std::back_inserter(createInfos), [](auto& info) { return info->getCreateInfo(); });
+    return PipelineCache::createUncachedPipelines(device, createInfos);
+}
+
+std::vector<vk::UniquePipeline> fuji::core::utility::ComputePipelineCreateInfoTemplate::createComputePipeline(vk::Device& device, PipelineCache& pipelineCache, vk::ArrayProxy<std::unique_ptr<ComputePipelineCreateInfoTemplate>> computePipelineCreateInfos) {
+    std::vector<vk::ComputePipelineCreateInfo> createInfos;
+    std::transform(computePipelineCreateInfos.begin(), computePipelineCreateInfos.end(), std::back_inserter(createInfos), [](auto& info) { return info->getCreateInfo(); });
+    return pipelineCache.createPipelines(device, createInfos);
+}
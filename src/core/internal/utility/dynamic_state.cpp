@@ -0,0 +1,80 @@
+#include <fuji/core/internal/utility/dynamic_state.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+    template <class T>
+    // Looks up the core name first and falls back to the EXT alias.
+    T loadDeviceFunction(const vk::Device& device, const std::string& name) {
+        PFN_vkVoidFunction function = device.getProcAddr(name);
+        if(function == nullptr) {
+            function = device.getProcAddr(name + "EXT");
+        }
+        if(function == nullptr) {
+            throw std::runtime_error("failed to load " + name);
+        }
+        return reinterpret_cast<T>(function);
+    }
+}
+
+void fuji::core::utility::DynamicStateValues::setExtent(vk::Extent2D extent) noexcept {
+    this->viewport = vk::Viewport {
+        0.0f, 0.0f,
+        static_cast<float>(extent.width),
+        static_cast<float>(extent.height),
+        0.0f, 1.0f
+    };
+    this->scissor = vk::Rect2D {
+        vk::Offset2D { 0, 0 },
+        extent
+    };
+}
+
+fuji::core::utility::DynamicStateRecorder::DynamicStateRecorder(const vk::Device& device, DynamicStateSupport support)
+        : support(support), cmdSetCullMode(nullptr), cmdSetFrontFace(nullptr), cmdSetPrimitiveTopology(nullptr), cmdSetColorBlendEnable(nullptr) {
+    if(this->support.extendedDynamicState) {
+        this->cmdSetCullMode = loadDeviceFunction<PFN_vkCmdSetCullMode>(device, "vkCmdSetCullMode");
+        this->cmdSetFrontFace = loadDeviceFunction<PFN_vkCmdSetFrontFace>(device, "vkCmdSetFrontFace");
+        this->cmdSetPrimitiveTopology = loadDeviceFunction<PFN_vkCmdSetPrimitiveTopology>(device, "vkCmdSetPrimitiveTopology");
+    }
+    if(this->support.colorBlendEnable) {
+        this->cmdSetColorBlendEnable = loadDeviceFunction<PFN_vkCmdSetColorBlendEnableEXT>(device, "vkCmdSetColorBlendEnable");
+    }
+}
+
+const fuji::core::utility::DynamicStateSupport& fuji::core::utility::DynamicStateRecorder::getSupport() const noexcept {
+    return this->support;
+}
+
+void fuji::core::utility::DynamicStateRecorder::record(vk::CommandBuffer& commandBuffer, const DynamicStateValues& values) const {
+    commandBuffer.setViewport(0, { values.viewport });
+    commandBuffer.setScissor(0, { values.scissor });
+
+    VkCommandBuffer handle = static_cast<VkCommandBuffer>(commandBuffer);
+    if(this->support.extendedDynamicState) {
+        this->cmdSetCullMode(handle, static_cast<VkCullModeFlags>(values.cullMode));
+        this->cmdSetFrontFace(handle, static_cast<VkFrontFace>(values.frontFace));
+        this->cmdSetPrimitiveTopology(handle, static_cast<VkPrimitiveTopology>(values.primitiveTopology));
+    }
+    if(this->support.colorBlendEnable) {
+        VkBool32 blendEnable = values.blendEnable ? VK_TRUE : VK_FALSE;
+        this->cmdSetColorBlendEnable(handle, 0, 1, &blendEnable);
+    }
+}
+
+std::vector<vk::DynamicState> fuji::core::utility::DynamicStateRecorder::getDynamicStates(const DynamicStateSupport& support) {
+    std::vector<vk::DynamicState> dynamicStates {
+        vk::DynamicState::eViewport,
+        vk::DynamicState::eScissor
+    };
+    if(support.extendedDynamicState) {
+        dynamicStates.push_back(vk::DynamicState::eCullMode);
+        dynamicStates.push_back(vk::DynamicState::eFrontFace);
+        dynamicStates.push_back(vk::DynamicState::ePrimitiveTopology);
+    }
+    if(support.colorBlendEnable) {
+        dynamicStates.push_back(vk::DynamicState::eColorBlendEnableEXT);
+    }
+    return dynamicStates;
+}
@@ -0,0 +1,152 @@
+#include <fuji/core/internal/utility/frame_ring.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+fuji::core::utility::FrameRing::FrameRing(const vk::Device& device, std::uint32_t queueFamilyIndex, std::uint32_t framesInFlight)
+        : device(device), slots(framesInFlight), currentIndex(framesInFlight - 1), frameNumber(0), completedFrameNumber(0) {
+    if(framesInFlight == 0) {
+        throw std::invalid_argument("FrameRing needs at least one frame in flight");
+    }
+
+    for(auto& slot : this->slots) {
+        vk::CommandPoolCreateInfo poolInfo {};
+        poolInfo.flags = vk::CommandPoolCreateFlagBits::eTransient;
+        poolInfo.queueFamilyIndex = queueFamilyIndex;
+        slot.commandPool = this->device.createCommandPoolUnique(poolInfo);
+
+        vk::CommandBufferAllocateInfo allocInfo {};
+        allocInfo.commandPool = slot.commandPool.get();
+        allocInfo.level = vk::CommandBufferLevel::ePrimary;
+        allocInfo.commandBufferCount = 1;
+        slot.commandBuffer = std::move(this->device.allocateCommandBuffersUnique(allocInfo)[0]);
+
+        vk::FenceCreateInfo fenceInfo {};
+        fenceInfo.flags = vk::FenceCreateFlagBits::eSignaled;
+        slot.inFlightFence = this->device.createFenceUnique(fenceInfo);
+
+        slot.imageAvailableSemaphore = this->device.createSemaphoreUnique(vk::SemaphoreCreateInfo {});
+        slot.renderFinishedSemaphore = this->device.createSemaphoreUnique(vk::SemaphoreCreateInfo {});
+    }
+}
+
+fuji::core::utility::FrameRing::~FrameRing() {
+    try {
+        this->waitIdle();
+    } catch(...) {
+    }
+}
+
+fuji::core::utility::FrameSlot& fuji::core::utility::FrameRing::acquire() {
+    this->currentIndex = (this->currentIndex + 1) % this->slots.size();
+    FrameSlot& slot = this->slots[this->currentIndex];
+
+    auto result = this->device.waitForFences({ slot.inFlightFence.get() }, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+    if(result != vk::Result::eSuccess) {
+        throw std::runtime_error("failed to wait fence");
+    }
+    this->completedFrameNumber = std::max(this->completedFrameNumber, slot.frameNumber);
+
+    slot.transientBuffers.clear();
+    slot.transientMemories.clear();
+    this->device.resetCommandPool(slot.commandPool.get(), vk::CommandPoolResetFlags {});
+    slot.frameNumber = ++this->frameNumber;
+
+    vk::CommandBufferBeginInfo beginInfo {};
+    beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+    slot.commandBuffer->begin(beginInfo);
+
+    return slot;
+}
+
+void fuji::core::utility::FrameRing::submit(const vk::Queue& queue, vk::ArrayProxy<const vk::Semaphore> waitSemaphores, vk::ArrayProxy<const vk::PipelineStageFlags> waitStages, vk::ArrayProxy<const vk::Semaphore> signalSemaphores) {
+    FrameSlot& slot = this->slots[this->currentIndex];
+    slot.commandBuffer->end();
+
+    vk::SubmitInfo submitInfo {};
+    submitInfo.waitSemaphoreCount = waitSemaphores.size();
+    submitInfo.pWaitSemaphores = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask = waitStages.data();
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &slot.commandBuffer.get();
+    submitInfo.signalSemaphoreCount = signalSemaphores.size();
+    submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+    // The fence is only reset once work is about to signal it again, so a slot that was acquired but never
+    // submitted stays signalled and never blocks acquire(), wait() or waitIdle().
+    this->device.resetFences({ slot.inFlightFence.get() });
+    try {
+        queue.submit({ submitInfo }, slot.inFlightFence.get());
+    } catch(...) {
+        slot.inFlightFence = this->device.createFenceUnique(vk::FenceCreateInfo { vk::FenceCreateFlagBits::eSignaled });
+        throw;
+    }
+}
+
+void fuji::core::utility::FrameRing::retain(vk::UniqueBuffer buffer) {
+    this->slots[this->currentIndex].transientBuffers.push_back(std::move(buffer));
+}
+
+void fuji::core::utility::FrameRing::retain(vk::UniqueDeviceMemory memory) {
+    this->slots[this->currentIndex].transientMemories.push_back(std::move(memory));
+}
+
+bool fuji::core::utility::FrameRing::isComplete(std::uint64_t frameNumber) const {
+    if(frameNumber <= this->completedFrameNumber) {
+        return true;
+    }
+    auto slot = std::find_if(this->slots.begin(), this->slots.end(), [frameNumber](auto& slot) { return slot.frameNumber == frameNumber; });
+    return slot == this->slots.end() || this->device.getFenceStatus(slot->inFlightFence.get()) == vk::Result::eSuccess;
+}
+
+void fuji::core::utility::FrameRing::wait(std::uint64_t frameNumber) {
+    if(frameNumber <= this->completedFrameNumber) {
+        return;
+    }
+    auto slot = std::find_if(this->slots.begin(), this->slots.end(), [frameNumber](auto& slot) { return slot.frameNumber == frameNumber; });
+    if(slot == this->slots.end()) {
+        return;
+    }
+    auto result = this->device.waitForFences({ slot->inFlightFence.get() }, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+    if(result != vk::Result::eSuccess) {
+        throw std::runtime_error("failed to wait fence");
+    }
+    this->completedFrameNumber = std::max(this->completedFrameNumber, frameNumber);
+}
+
+void fuji::core::utility::FrameRing::waitIdle() {
+    std::vector<vk::Fence> fences;
+    std::transform(this->slots.begin(), this->slots.end(), std::back_inserter(fences), [](auto& slot) { return slot.inFlightFence.get(); });
+    auto result = this->device.waitForFences(fences, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+    if(result != vk::Result::eSuccess) {
+        throw std::runtime_error("failed to wait fence");
+    }
+    this->completedFrameNumber = this->frameNumber;
+}
+
+const vk::Device& fuji::core::utility::FrameRing::getDevice() const noexcept {
+    return this->device;
+}
+
+fuji::core::utility::FrameSlot& fuji::core::utility::FrameRing::getCurrentSlot() noexcept {
+    return this->slots[this->currentIndex];
+}
+
+std::uint32_t fuji::core::utility::FrameRing::getCurrentIndex() const noexcept {
+    return this->currentIndex;
+}
+
+std::uint32_t fuji::core::utility::FrameRing::getFramesInFlight() const noexcept {
+    return static_cast<std::uint32_t>(this->slots.size());
+}
+
+std::uint64_t fuji::core::utility::FrameRing::getFrameNumber() const noexcept {
+    return this->frameNumber;
+}
+
+std::uint64_t fuji::core::utility::FrameRing::getCompletedFrameNumber() const noexcept {
+    return this->completedFrameNumber;
+}
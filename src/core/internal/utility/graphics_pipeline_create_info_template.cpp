@@ -9,32 +9,95 @@
 #include <vector>
 #include <vulkan/vulkan_core.h>
 
-fuji::core::utility::GraphicsPipelineCreateInfoTemplate::GraphicsPipelineCreateInfoTemplate(std::unique_ptr<ShaderStageFlow> shaderStageFlow) 
-        : shaderStageFlow(std::move(shaderStageFlow)) {
-    
+fuji::core::utility::GraphicsPipelineCreateInfoTemplate::GraphicsPipelineCreateInfoTemplate(std::unique_ptr<ShaderStageFlow> shaderStageFlow, DynamicStateSupport dynamicStateSupport) 
+        : shaderStageFlow(std::move(shaderStageFlow)), dynamicStateSupport(dynamicStateSupport), subpass(0) {
+    this->viewportStateCreateInfo = vk::PipelineViewportStateCreateInfo {
+        {},
+        1, nullptr,
+        1, nullptr
+    };
+
+    this->inputAssemblyStateCreateInfo.topology = vk::PrimitiveTopology::eTriangleList;
+    this->inputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
+
+    this->rasterizationStateCreateInfo.polygonMode = vk::PolygonMode::eFill;
+    this->rasterizationStateCreateInfo.cullMode = vk::CullModeFlagBits::eNone;
+    this->rasterizationStateCreateInfo.frontFace = vk::FrontFace::eCounterClockwise;
+    this->rasterizationStateCreateInfo.lineWidth = 1.0f;
+
+    this->multisampleStateCreateInfo.rasterizationSamples = vk::SampleCountFlagBits::e1;
+    this->multisampleStateCreateInfo.minSampleShading = 1.0f;
+
+    this->colorBlendAttachmentState.colorWriteMask =
+        vk::ColorComponentFlagBits::eR
+      | vk::ColorComponentFlagBits::eG
+      | vk::ColorComponentFlagBits::eB
+      | vk::ColorComponentFlagBits::eA;
+    this->colorBlendAttachmentState.blendEnable = VK_FALSE;
 }
 
-std::vector<vk::DynamicState> fuji::core::utility::GraphicsPipelineCreateInfoTemplate::getDynamicStates() const noexcept { 
-    return std::vector<vk::DynamicState> {};
+std::vector<vk::DynamicState> fuji::core::utility::GraphicsPipelineCreateInfoTemplate::getDynamicStates() const { 
+    return DynamicStateRecorder::getDynamicStates(this->dynamicStateSupport);
 }
 
-vk::GraphicsPipelineCreateInfo fuji::core::utility::GraphicsPipelineCreateInfoTemplate::getCreateInfo() const noexcept {
+vk::GraphicsPipelineCreateInfo fuji::core::utility::GraphicsPipelineCreateInfoTemplate::getCreateInfo() const {
+    this->dynamicStates = this->getDynamicStates();
+    this->dynamicStateCreateInfo = vk::PipelineDynamicStateCreateInfo {
+        {},
+        this->dynamicStates
+    };
+
     vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo {
         {}, 
         this->shaderStageFlow->getShaderStageCreateInfos(),
         &this->shaderStageFlow->getVertexInputStateCreateInfo()
     };
+    this->colorBlendStateCreateInfo.logicOpEnable = VK_FALSE;
+    this->colorBlendStateCreateInfo.attachmentCount = 1;
+    this->colorBlendStateCreateInfo.pAttachments = &this->colorBlendAttachmentState;
+
+    graphicsPipelineCreateInfo.pInputAssemblyState = &this->inputAssemblyStateCreateInfo;
+    graphicsPipelineCreateInfo.pViewportState = &this->viewportStateCreateInfo;
+    graphicsPipelineCreateInfo.pRasterizationState = &this->rasterizationStateCreateInfo;
+    graphicsPipelineCreateInfo.pMultisampleState = &this->multisampleStateCreateInfo;
+    graphicsPipelineCreateInfo.pColorBlendState = &this->colorBlendStateCreateInfo;
+    graphicsPipelineCreateInfo.pDynamicState = &this->dynamicStateCreateInfo;
+    graphicsPipelineCreateInfo.layout = this->pipelineLayout;
+    graphicsPipelineCreateInfo.renderPass = this->renderPass;
+    graphicsPipelineCreateInfo.subpass = this->subpass;
 
     return graphicsPipelineCreateInfo;
 }
 
+fuji::core::utility::ShaderStageFlow& fuji::core::utility::GraphicsPipelineCreateInfoTemplate::getShaderStageFlow() noexcept {
+    return *this->shaderStageFlow;
+}
+
+void fuji::core::utility::GraphicsPipelineCreateInfoTemplate::setPipelineLayout(const vk::PipelineLayout& pipelineLayout) noexcept {
+    this->pipelineLayout = pipelineLayout;
+}
+
+void fuji::core::utility::GraphicsPipelineCreateInfoTemplate::setRenderPass(const vk::RenderPass& renderPass, std::uint32_t subpass) noexcept {
+    this->renderPass = renderPass;
+    this->subpass = subpass;
+}
+
+void fuji::core::utility::GraphicsPipelineCreateInfoTemplate::setPrimitiveTopology(vk::PrimitiveTopology primitiveTopology) noexcept {
+    this->inputAssemblyStateCreateInfo.topology = primitiveTopology;
+}
+
+void fuji::core::utility::GraphicsPipelineCreateInfoTemplate::setColorBlendAttachmentState(const vk::PipelineColorBlendAttachmentState& colorBlendAttachmentState) noexcept {
+    this->colorBlendAttachmentState = colorBlendAttachmentState;
+}
+
 std::vector<vk::UniquePipeline> fuji::core::utility::GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(vk::Device &device, vk::ArrayProxy<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos) {
     std::vector<vk::GraphicsPipelineCreateInfo> createInfos;
     std::transform(graphicsPipelineCreateInfos.begin(), graphicsPipelineCreateInfos.end(), std::back_inserter(createInfos), [](auto& info) { return info->getCreateInfo(); });
+    return PipelineCache::createUncachedPipelines(device, createInfos);
+}
 
-    auto [result, value] = device.createGraphicsPipelinesUnique(VK_NULL_HANDLE, createInfos);
-    if(result != vk::Result::eSuccess) {
-        vk::throwResultException(result, "failed to create GraphicsPipelines");
-    }
-    return std::move(value);
-}
\ No newline at end of file
+std::vector<vk::UniquePipeline> fuji::core::utility::GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(vk::Device &device, PipelineCache& pipelineCache, vk::ArrayProxy<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos) {
+    std::vector<vk::GraphicsPipelineCreateInfo> createInfos;
+    std::transform(graphicsPipelineCreateInfos.begin(), graphicsPipelineCreateInfos.end(), std::back_inserter(createInfos), [](auto& info) { return info->getCreateInfo(); });
+    return pipelineCache.createPipelines(device, createInfos);
+}
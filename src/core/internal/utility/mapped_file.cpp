@@ -0,0 +1,83 @@
+#include <fuji/core/internal/utility/mapped_file.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FUJI_HAS_MMAP 1
+#endif
+
+fuji::core::utility::MappedFile::MappedFile(const std::filesystem::path& filePath) : address(nullptr), size(0) {
+#ifdef FUJI_HAS_MMAP
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if(fd < 0) {
+        throw std::runtime_error("failed to open " + filePath.string());
+    }
+    struct stat status;
+    if(::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw std::runtime_error("failed to stat " + filePath.string());
+    }
+    this->size = static_cast<std::size_t>(status.st_size);
+    if(this->size > 0) {
+        void* mapped = ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("failed to map " + filePath.string());
+        }
+        this->address = static_cast<const std::uint8_t*>(mapped);
+    }
+    ::close(fd);
+#else
+    std::ifstream fin { filePath, std::ios::in | std::ios::binary };
+    if(!fin) {
+        throw std::runtime_error("failed to open " + filePath.string());
+    }
+    this->fallback.assign(std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {});
+    this->address = this->fallback.data();
+    this->size = this->fallback.size();
+#endif
+}
+
+fuji::core::utility::MappedFile::MappedFile(MappedFile&& other) noexcept
+        : address(std::exchange(other.address, nullptr)), size(std::exchange(other.size, 0)), fallback(std::move(other.fallback)) {
+}
+
+fuji::core::utility::MappedFile& fuji::core::utility::MappedFile::operator=(MappedFile&& other) noexcept {
+    if(this != &other) {
+        this->unmap();
+        this->address = std::exchange(other.address, nullptr);
+        this->size = std::exchange(other.size, 0);
+        this->fallback = std::move(other.fallback);
+    }
+    return *this;
+}
+
+fuji::core::utility::MappedFile::~MappedFile() {
+    this->unmap();
+}
+
+const std::uint8_t* fuji::core::utility::MappedFile::getData() const noexcept {
+    return this->address;
+}
+
+std::size_t fuji::core::utility::MappedFile::getSize() const noexcept {
+    return this->size;
+}
+
+void fuji::core::utility::MappedFile::unmap() noexcept {
+#ifdef FUJI_HAS_MMAP
+    if(this->address != nullptr) {
+        ::munmap(const_cast<std::uint8_t*>(this->address), this->size);
+    }
+#endif
+    this->address = nullptr;
+    this->size = 0;
+    this->fallback.clear();
+}
@@ -0,0 +1,282 @@
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fuji/core/internal/utility/memory_type.hpp>
+
+namespace {
+    constexpr vk::DeviceSize minimumBlockSize = 256;
+
+    vk::DeviceSize alignDown(vk::DeviceSize value, vk::DeviceSize alignment) {
+        return value / alignment * alignment;
+    }
+
+    vk::DeviceSize alignUp(vk::DeviceSize value, vk::DeviceSize alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+double fuji::core::utility::MemoryStatistics::getFragmentation() const noexcept {
+    vk::DeviceSize freeBytes = this->reservedBytes - this->allocatedBytes;
+    if(freeBytes == 0) {
+        return 0.0;
+    }
+    return 1.0 - static_cast<double>(this->largestFreeBlock) / static_cast<double>(freeBytes);
+}
+
+fuji::core::utility::MemoryStatistics& fuji::core::utility::MemoryStatistics::operator+=(const MemoryStatistics& other) noexcept {
+    this->blockCount += other.blockCount;
+    this->allocationCount += other.allocationCount;
+    this->reservedBytes += other.reservedBytes;
+    this->allocatedBytes += other.allocatedBytes;
+    this->usedBytes += other.usedBytes;
+    this->largestFreeBlock = std::max(this->largestFreeBlock, other.largestFreeBlock);
+    return *this;
+}
+
+fuji::core::utility::UniqueAllocation::UniqueAllocation() noexcept : allocator(nullptr) {
+
+}
+
+fuji::core::utility::UniqueAllocation::UniqueAllocation(MemoryAllocator& allocator, const Allocation& allocation) noexcept
+        : allocator(&allocator), allocation(allocation) {
+
+}
+
+fuji::core::utility::UniqueAllocation::UniqueAllocation(UniqueAllocation&& other) noexcept
+        : allocator(other.allocator), allocation(other.allocation) {
+    other.allocator = nullptr;
+}
+
+fuji::core::utility::UniqueAllocation& fuji::core::utility::UniqueAllocation::operator=(UniqueAllocation&& other) noexcept {
+    if(this != &other) {
+        this->reset();
+        this->allocator = other.allocator;
+        this->allocation = other.allocation;
+        other.allocator = nullptr;
+    }
+    return *this;
+}
+
+fuji::core::utility::UniqueAllocation::~UniqueAllocation() {
+    this->reset();
+}
+
+const fuji::core::utility::Allocation& fuji::core::utility::UniqueAllocation::get() const noexcept {
+    return this->allocation;
+}
+
+const fuji::core::utility::Allocation* fuji::core::utility::UniqueAllocation::operator->() const noexcept {
+    return &this->allocation;
+}
+
+fuji::core::utility::UniqueAllocation::operator bool() const noexcept {
+    return this->allocator != nullptr;
+}
+
+void fuji::core::utility::UniqueAllocation::reset() noexcept {
+    if(this->allocator) {
+        this->allocator->free(this->allocation);
+        this->allocator = nullptr;
+    }
+}
+
+fuji::core::utility::MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, vk::DeviceSize blockSize)
+        : device(device), memoryProperties(physicalDevice.getMemoryProperties()), blockSize(blockSize),
+          nonCoherentAtomSize(physicalDevice.getProperties().limits.nonCoherentAtomSize) {
+    if(blockSize < minimumBlockSize || (blockSize & (blockSize - 1)) != 0) {
+        throw std::invalid_argument("MemoryAllocator block size must be a power of two of at least 256 bytes");
+    }
+}
+
+fuji::core::utility::Allocation fuji::core::utility::MemoryAllocator::allocate(const vk::MemoryRequirements& requirements, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties, ResourceTiling tiling) {
+    std::uint32_t memoryType = requireMemoryType(this->memoryProperties, requirements.memoryTypeBits, requiredProperties, preferredProperties);
+
+    Allocation allocation {};
+    allocation.size = requirements.size;
+    allocation.memoryType = memoryType;
+    allocation.tiling = tiling;
+
+    std::lock_guard<std::mutex> lock { this->mutex };
+    if(requirements.size > this->blockSize / 2 || requirements.alignment > this->blockSize) {
+        DedicatedAllocation dedicatedAllocation {};
+        dedicatedAllocation.memory = this->allocateDeviceMemory(requirements.size, memoryType, allocation.mappedData);
+        dedicatedAllocation.size = requirements.size;
+        dedicatedAllocation.memoryType = memoryType;
+        allocation.memory = dedicatedAllocation.memory.get();
+        allocation.dedicated = true;
+        this->dedicatedAllocations.emplace(static_cast<VkDeviceMemory>(allocation.memory), std::move(dedicatedAllocation));
+        return allocation;
+    }
+
+    Pool& pool = this->pools[{ memoryType, tiling }];
+    for(auto& block : pool.blocks) {
+        auto offset = block->allocator.allocate(requirements.size, requirements.alignment);
+        if(offset) {
+            allocation.memory = block->memory.get();
+            allocation.offset = *offset;
+            allocation.mappedData = block->mappedData ? block->mappedData + *offset : nullptr;
+            return allocation;
+        }
+    }
+
+    pool.blocks.push_back(this->createBlock(memoryType));
+    Block& block = *pool.blocks.back();
+    std::uint64_t offset = block.allocator.allocate(requirements.size, requirements.alignment).value();
+    allocation.memory = block.memory.get();
+    allocation.offset = offset;
+    allocation.mappedData = block.mappedData ? block.mappedData + offset : nullptr;
+    return allocation;
+}
+
+void fuji::core::utility::MemoryAllocator::free(const Allocation& allocation) {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    if(allocation.dedicated) {
+        this->dedicatedAllocations.erase(static_cast<VkDeviceMemory>(allocation.memory));
+        return;
+    }
+
+    auto poolIt = this->pools.find({ allocation.memoryType, allocation.tiling });
+    if(poolIt == this->pools.end()) {
+        return;
+    }
+    Pool& pool = poolIt->second;
+    auto block = std::find_if(pool.blocks.begin(), pool.blocks.end(), [&allocation](auto& block) { return block->memory.get() == allocation.memory; });
+    if(block == pool.blocks.end()) {
+        return;
+    }
+    (*block)->allocator.free(allocation.offset);
+
+    // keep one empty block per pool around so that alternating allocate/free does not thrash vkAllocateMemory
+    if((*block)->allocator.isEmpty()) {
+        auto emptyBlocks = std::count_if(pool.blocks.begin(), pool.blocks.end(), [](auto& block) { return block->allocator.isEmpty(); });
+        if(emptyBlocks > 1) {
+            pool.blocks.erase(block);
+        }
+    }
+}
+
+fuji::core::utility::AllocatedBuffer fuji::core::utility::MemoryAllocator::createBuffer(const vk::BufferCreateInfo& createInfo, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties) {
+    AllocatedBuffer result {};
+    result.buffer = this->device.createBufferUnique(createInfo);
+    vk::MemoryRequirements requirements = this->device.getBufferMemoryRequirements(result.buffer.get());
+    result.allocation = UniqueAllocation { *this, this->allocate(requirements, requiredProperties, preferredProperties, ResourceTiling::eLinear) };
+    this->device.bindBufferMemory(result.buffer.get(), result.allocation->memory, result.allocation->offset);
+    return result;
+}
+
+fuji::core::utility::AllocatedImage fuji::core::utility::MemoryAllocator::createImage(const vk::ImageCreateInfo& createInfo, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties) {
+    AllocatedImage result {};
+    result.image = this->device.createImageUnique(createInfo);
+    vk::MemoryRequirements requirements = this->device.getImageMemoryRequirements(result.image.get());
+    ResourceTiling tiling = createInfo.tiling == vk::ImageTiling::eLinear ? ResourceTiling::eLinear : ResourceTiling::eOptimal;
+    result.allocation = UniqueAllocation { *this, this->allocate(requirements, requiredProperties, preferredProperties, tiling) };
+    this->device.bindImageMemory(result.image.get(), result.allocation->memory, result.allocation->offset);
+    return result;
+}
+
+void fuji::core::utility::MemoryAllocator::flush(const Allocation& allocation) const {
+    if(!this->isCoherent(allocation)) {
+        this->device.flushMappedMemoryRanges({ this->getMappedRange(allocation) });
+    }
+}
+
+void fuji::core::utility::MemoryAllocator::flush(vk::ArrayProxy<const Allocation> ranges) const {
+    std::vector<vk::MappedMemoryRange> mappedRanges;
+    for(auto& range : ranges) {
+        if(!this->isCoherent(range)) {
+            mappedRanges.push_back(this->getMappedRange(range));
+        }
+    }
+    if(!mappedRanges.empty()) {
+        this->device.flushMappedMemoryRanges(mappedRanges);
+    }
+}
+
+void fuji::core::utility::MemoryAllocator::invalidate(const Allocation& allocation) const {
+    if(!this->isCoherent(allocation)) {
+        this->device.invalidateMappedMemoryRanges({ this->getMappedRange(allocation) });
+    }
+}
+
+bool fuji::core::utility::MemoryAllocator::isCoherent(const Allocation& allocation) const noexcept {
+    return static_cast<bool>(this->memoryProperties.memoryTypes[allocation.memoryType].propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+}
+
+fuji::core::utility::MemoryStatistics fuji::core::utility::MemoryAllocator::getStatistics() const {
+    MemoryStatistics statistics {};
+    for(std::uint32_t memoryType = 0; memoryType < this->memoryProperties.memoryTypeCount; memoryType++) {
+        statistics += this->getStatistics(memoryType);
+    }
+    return statistics;
+}
+
+fuji::core::utility::MemoryStatistics fuji::core::utility::MemoryAllocator::getStatistics(std::uint32_t memoryType) const {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    return this->collectStatistics(memoryType);
+}
+
+const vk::Device& fuji::core::utility::MemoryAllocator::getDevice() const noexcept {
+    return this->device;
+}
+
+const vk::PhysicalDeviceMemoryProperties& fuji::core::utility::MemoryAllocator::getMemoryProperties() const noexcept {
+    return this->memoryProperties;
+}
+
+std::unique_ptr<fuji::core::utility::MemoryAllocator::Block> fuji::core::utility::MemoryAllocator::createBlock(std::uint32_t memoryType) const {
+    std::uint8_t* mappedData = nullptr;
+    vk::UniqueDeviceMemory memory = this->allocateDeviceMemory(this->blockSize, memoryType, mappedData);
+    return std::unique_ptr<Block>(new Block { std::move(memory), BuddyAllocator { this->blockSize, minimumBlockSize }, mappedData });
+}
+
+vk::UniqueDeviceMemory fuji::core::utility::MemoryAllocator::allocateDeviceMemory(vk::DeviceSize size, std::uint32_t memoryType, std::uint8_t*& mappedData) const {
+    vk::MemoryAllocateInfo allocInfo {};
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryType;
+    vk::UniqueDeviceMemory memory = this->device.allocateMemoryUnique(allocInfo);
+
+    mappedData = nullptr;
+    if(this->memoryProperties.memoryTypes[memoryType].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible) {
+        mappedData = static_cast<std::uint8_t*>(this->device.mapMemory(memory.get(), 0, VK_WHOLE_SIZE));
+    }
+    return memory;
+}
+
+fuji::core::utility::MemoryStatistics fuji::core::utility::MemoryAllocator::collectStatistics(std::uint32_t memoryType) const {
+    MemoryStatistics statistics {};
+    for(auto& [key, pool] : this->pools) {
+        if(key.first != memoryType) {
+            continue;
+        }
+        for(auto& block : pool.blocks) {
+            statistics.blockCount++;
+            statistics.allocationCount += block->allocator.getAllocationCount();
+            statistics.reservedBytes += block->allocator.getSize();
+            statistics.allocatedBytes += block->allocator.getAllocatedBytes();
+            statistics.usedBytes += block->allocator.getRequestedBytes();
+            statistics.largestFreeBlock = std::max(statistics.largestFreeBlock, block->allocator.getLargestFreeBlock());
+        }
+    }
+    for(auto& [memory, dedicatedAllocation] : this->dedicatedAllocations) {
+        if(dedicatedAllocation.memoryType != memoryType) {
+            continue;
+        }
+        statistics.blockCount++;
+        statistics.allocationCount++;
+        statistics.reservedBytes += dedicatedAllocation.size;
+        statistics.allocatedBytes += dedicatedAllocation.size;
+        statistics.usedBytes += dedicatedAllocation.size;
+    }
+    return statistics;
+}
+
+vk::MappedMemoryRange fuji::core::utility::MemoryAllocator::getMappedRange(const Allocation& allocation) const noexcept {
+    vk::DeviceSize begin = alignDown(allocation.offset, this->nonCoherentAtomSize);
+    vk::DeviceSize end = alignUp(allocation.offset + allocation.size, this->nonCoherentAtomSize);
+    if(allocation.dedicated) {
+        return vk::MappedMemoryRange { allocation.memory, begin, VK_WHOLE_SIZE };
+    }
+    return vk::MappedMemoryRange { allocation.memory, begin, std::min(end, this->blockSize) - begin };
+}
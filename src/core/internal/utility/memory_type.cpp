@@ -0,0 +1,33 @@
+#include <fuji/core/internal/utility/memory_type.hpp>
+
+#include <stdexcept>
+
+namespace {
+    std::optional<std::uint32_t> findExactMemoryType(const vk::PhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t typeFilter, vk::MemoryPropertyFlags properties) {
+        for(std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+            if((typeFilter & (1u << i))
+                    && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+}
+
+std::optional<std::uint32_t> fuji::core::utility::findMemoryType(const vk::PhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t typeFilter, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties) {
+    if(preferredProperties) {
+        auto memoryType = findExactMemoryType(memoryProperties, typeFilter, requiredProperties | preferredProperties);
+        if(memoryType) {
+            return memoryType;
+        }
+    }
+    return findExactMemoryType(memoryProperties, typeFilter, requiredProperties);
+}
+
+std::uint32_t fuji::core::utility::requireMemoryType(const vk::PhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t typeFilter, vk::MemoryPropertyFlags requiredProperties, vk::MemoryPropertyFlags preferredProperties) {
+    auto memoryType = findMemoryType(memoryProperties, typeFilter, requiredProperties, preferredProperties);
+    if(!memoryType) {
+        throw std::runtime_error("failed to find suitable memory type");
+    }
+    return *memoryType;
+}
@@ -0,0 +1,85 @@
+#include <fuji/core/internal/utility/parallel_pipeline_compiler.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+
+fuji::core::utility::ParallelPipelineCompiler::ParallelPipelineCompiler(vk::Device& device, PipelineCache& pipelineCache, std::uint32_t workerCount)
+        : device(device), pipelineCache(pipelineCache), runningJobCount(0), stopping(false) {
+    if(workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for(std::uint32_t i = 0; i < workerCount; i++) {
+        this->workerCaches.push_back(this->pipelineCache.createWorkerCache());
+    }
+    for(std::uint32_t i = 0; i < workerCount; i++) {
+        this->workers.emplace_back(&ParallelPipelineCompiler::work, this, i);
+    }
+}
+
+fuji::core::utility::ParallelPipelineCompiler::~ParallelPipelineCompiler() {
+    try {
+        this->wait();
+    } catch(...) {
+    }
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+        this->stopping = true;
+    }
+    this->jobAvailable.notify_all();
+    std::for_each(this->workers.begin(), this->workers.end(), [](std::thread& worker) { worker.join(); });
+}
+
+std::vector<std::future<vk::UniquePipeline>> fuji::core::utility::ParallelPipelineCompiler::compile(std::vector<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> graphicsPipelineCreateInfos) {
+    std::vector<std::future<vk::UniquePipeline>> futures;
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+        for(auto& graphicsPipelineCreateInfo : graphicsPipelineCreateInfos) {
+            Job& job = this->jobs.emplace_back(Job { std::move(graphicsPipelineCreateInfo), std::promise<vk::UniquePipeline> {} });
+            futures.push_back(job.promise.get_future());
+        }
+    }
+    this->jobAvailable.notify_all();
+    return futures;
+}
+
+void fuji::core::utility::ParallelPipelineCompiler::wait() {
+    std::unique_lock<std::mutex> lock { this->mutex };
+    this->jobsFinished.wait(lock, [this] { return this->jobs.empty() && this->runningJobCount == 0; });
+    this->pipelineCache.merge(this->workerCaches);
+}
+
+std::uint32_t fuji::core::utility::ParallelPipelineCompiler::getWorkerCount() const noexcept {
+    return static_cast<std::uint32_t>(this->workers.size());
+}
+
+void fuji::core::utility::ParallelPipelineCompiler::work(std::size_t workerIndex) {
+    PipelineCache& workerCache = *this->workerCaches[workerIndex];
+    while(true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock { this->mutex };
+            this->jobAvailable.wait(lock, [this] { return this->stopping || !this->jobs.empty(); });
+            if(this->jobs.empty()) {
+                return;
+            }
+            job = std::move(this->jobs.front());
+            this->jobs.pop_front();
+            this->runningJobCount++;
+        }
+
+        try {
+            auto pipelines = GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(this->device, workerCache, job.graphicsPipelineCreateInfo);
+            job.graphicsPipelineCreateInfo.reset();
+            job.promise.set_value(std::move(pipelines[0]));
+        } catch(...) {
+            job.promise.set_exception(std::current_exception());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock { this->mutex };
+            this->runningJobCount--;
+        }
+        this->jobsFinished.notify_all();
+    }
+}
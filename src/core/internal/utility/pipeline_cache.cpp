@@ -0,0 +1,249 @@
+#include <fuji/core/internal/utility/pipeline_cache.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+    struct FileHeader {
+        std::array<char, 4> magic;
+        std::uint32_t version;
+        std::uint32_t driverVersion;
+        std::uint32_t reserved;
+        std::uint64_t dataSize;
+    };
+
+    static_assert(sizeof(FileHeader) == 24);
+
+    constexpr std::array<char, 4> fileMagic { 'F', 'J', 'P', 'C' };
+    constexpr std::uint32_t fileVersion = 2;
+
+    vk::UniquePipelineCache createPipelineCache(const vk::Device& device, const std::uint8_t* data, std::size_t size) {
+        vk::PipelineCacheCreateInfo createInfo {
+            {},
+            size,
+            data
+        };
+        return device.createPipelineCacheUnique(createInfo);
+    }
+
+    std::uint32_t getStageCount(const vk::GraphicsPipelineCreateInfo& createInfo) noexcept {
+        return createInfo.stageCount;
+    }
+
+    std::uint32_t getStageCount(const vk::ComputePipelineCreateInfo&) noexcept {
+        return 1;
+    }
+
+    auto createPipelinesUnique(const vk::Device& device, const vk::PipelineCache& pipelineCache, const std::vector<vk::GraphicsPipelineCreateInfo>& createInfos) {
+        return device.createGraphicsPipelinesUnique(pipelineCache, createInfos);
+    }
+
+    auto createPipelinesUnique(const vk::Device& device, const vk::PipelineCache& pipelineCache, const std::vector<vk::ComputePipelineCreateInfo>& createInfos) {
+        return device.createComputePipelinesUnique(pipelineCache, createInfos);
+    }
+}
+
+fuji::core::utility::PipelineCache::PipelineCache(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, std::filesystem::path filePath, bool creationFeedbackEnabled)
+        : device(device), properties(physicalDevice.getProperties()), filePath(std::move(filePath)),
+          loadedFromFile(false), creationFeedbackEnabled(creationFeedbackEnabled), hitCount(0), missCount(0) {
+    std::vector<std::uint8_t> data = this->filePath.empty() ? std::vector<std::uint8_t> {} : this->load();
+    if(this->validate(data)) {
+        try {
+            this->pipelineCache = createPipelineCache(this->device, data.data() + sizeof(FileHeader), data.size() - sizeof(FileHeader));
+            this->loadedFromFile = true;
+        } catch(const vk::SystemError&) {
+            this->pipelineCache.reset();
+        }
+    }
+    if(!this->pipelineCache) {
+        this->pipelineCache = createPipelineCache(this->device, nullptr, 0);
+    }
+}
+
+fuji::core::utility::PipelineCache::PipelineCache(const vk::Device& device, bool creationFeedbackEnabled)
+        : PipelineCache(device, vk::PhysicalDeviceProperties {}, std::vector<std::uint8_t> {}, creationFeedbackEnabled) {
+}
+
+fuji::core::utility::PipelineCache::PipelineCache(const vk::Device& device, const vk::PhysicalDeviceProperties& properties, const std::vector<std::uint8_t>& initialData, bool creationFeedbackEnabled)
+        : device(device), properties(properties), loadedFromFile(false), creationFeedbackEnabled(creationFeedbackEnabled), hitCount(0), missCount(0) {
+    this->pipelineCache = createPipelineCache(this->device, initialData.data(), initialData.size());
+}
+
+const vk::PipelineCache& fuji::core::utility::PipelineCache::getHandle() const {
+    return this->pipelineCache.get();
+}
+
+const std::filesystem::path& fuji::core::utility::PipelineCache::getFilePath() const noexcept {
+    return this->filePath;
+}
+
+bool fuji::core::utility::PipelineCache::isLoadedFromFile() const noexcept {
+    return this->loadedFromFile;
+}
+
+bool fuji::core::utility::PipelineCache::isCreationFeedbackEnabled() const noexcept {
+    return this->creationFeedbackEnabled;
+}
+
+std::size_t fuji::core::utility::PipelineCache::getDataSize() const {
+    std::size_t size = 0;
+    vk::Result result = this->device.getPipelineCacheData(this->pipelineCache.get(), &size, nullptr);
+    if(result != vk::Result::eSuccess) {
+        vk::throwResultException(result, "failed to query PipelineCache size");
+    }
+    return size;
+}
+
+std::uint64_t fuji::core::utility::PipelineCache::getHitCount() const noexcept {
+    return this->hitCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t fuji::core::utility::PipelineCache::getMissCount() const noexcept {
+    return this->missCount.load(std::memory_order_relaxed);
+}
+
+void fuji::core::utility::PipelineCache::recordCreationFeedback(const vk::PipelineCreationFeedback& feedback) noexcept {
+    if(!(feedback.flags & vk::PipelineCreationFeedbackFlagBits::eValid)) {
+        return;
+    }
+    if(feedback.flags & vk::PipelineCreationFeedbackFlagBits::eApplicationPipelineCacheHit) {
+        this->hitCount.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        this->missCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void fuji::core::utility::PipelineCache::recordDataGrowth(std::size_t dataSizeBefore, std::uint32_t pipelineCount) {
+    if(this->getDataSize() > dataSizeBefore) {
+        this->missCount.fetch_add(pipelineCount, std::memory_order_relaxed);
+    } else {
+        this->hitCount.fetch_add(pipelineCount, std::memory_order_relaxed);
+    }
+}
+
+template <typename CreateInfo>
+std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createPipelines(const vk::Device& device, std::vector<CreateInfo>& createInfos) {
+    std::vector<vk::PipelineCreationFeedback> feedbacks(createInfos.size());
+    std::vector<std::vector<vk::PipelineCreationFeedback>> stageFeedbacks(createInfos.size());
+    std::vector<vk::PipelineCreationFeedbackCreateInfo> feedbackCreateInfos;
+    if(this->creationFeedbackEnabled) {
+        feedbackCreateInfos.reserve(createInfos.size());
+        for(std::size_t i = 0; i < createInfos.size(); i++) {
+            stageFeedbacks[i].resize(getStageCount(createInfos[i]));
+            feedbackCreateInfos.emplace_back(&feedbacks[i], static_cast<std::uint32_t>(stageFeedbacks[i].size()), stageFeedbacks[i].data());
+            feedbackCreateInfos[i].pNext = createInfos[i].pNext;
+            createInfos[i].pNext = &feedbackCreateInfos[i];
+        }
+    }
+
+    std::size_t dataSizeBefore = this->creationFeedbackEnabled ? 0 : this->getDataSize();
+    auto [result, value] = createPipelinesUnique(device, this->pipelineCache.get(), createInfos);
+    if(result != vk::Result::eSuccess) {
+        vk::throwResultException(result, "failed to create Pipelines");
+    }
+
+    if(this->creationFeedbackEnabled) {
+        std::for_each(feedbacks.begin(), feedbacks.end(), [this](auto& feedback) { this->recordCreationFeedback(feedback); });
+        for(std::size_t i = 0; i < createInfos.size(); i++) {
+            createInfos[i].pNext = feedbackCreateInfos[i].pNext;
+        }
+    } else {
+        this->recordDataGrowth(dataSizeBefore, static_cast<std::uint32_t>(createInfos.size()));
+    }
+    return std::move(value);
+}
+
+template std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createPipelines(const vk::Device& device, std::vector<vk::GraphicsPipelineCreateInfo>& createInfos);
+template std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createPipelines(const vk::Device& device, std::vector<vk::ComputePipelineCreateInfo>& createInfos);
+
+template <typename CreateInfo>
+std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createUncachedPipelines(const vk::Device& device, const std::vector<CreateInfo>& createInfos) {
+    auto [result, value] = createPipelinesUnique(device, VK_NULL_HANDLE, createInfos);
+    if(result != vk::Result::eSuccess) {
+        vk::throwResultException(result, "failed to create Pipelines");
+    }
+    return std::move(value);
+}
+
+template std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createUncachedPipelines(const vk::Device& device, const std::vector<vk::GraphicsPipelineCreateInfo>& createInfos);
+template std::vector<vk::UniquePipeline> fuji::core::utility::PipelineCache::createUncachedPipelines(const vk::Device& device, const std::vector<vk::ComputePipelineCreateInfo>& createInfos);
+
+void fuji::core::utility::PipelineCache::save() const {
+    if(this->filePath.empty()) {
+        throw std::logic_error("PipelineCache has no file path to save to");
+    }
+
+    std::vector<std::uint8_t> data = this->device.getPipelineCacheData(this->pipelineCache.get());
+    FileHeader header { fileMagic, fileVersion, this->properties.driverVersion, 0, static_cast<std::uint64_t>(data.size()) };
+
+    if(this->filePath.has_parent_path()) {
+        std::filesystem::create_directories(this->filePath.parent_path());
+    }
+    std::filesystem::path temporaryPath = this->filePath;
+    temporaryPath += ".tmp";
+    {
+        std::ofstream fout { temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc };
+        fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        fout.write(reinterpret_cast<const char*>(data.data()), data.size());
+        if(!fout) {
+            throw std::runtime_error("failed to write PipelineCache to " + temporaryPath.string());
+        }
+    }
+    std::filesystem::rename(temporaryPath, this->filePath);
+}
+
+std::unique_ptr<fuji::core::utility::PipelineCache> fuji::core::utility::PipelineCache::createWorkerCache() const {
+    std::vector<std::uint8_t> data = this->device.getPipelineCacheData(this->pipelineCache.get());
+    return std::unique_ptr<PipelineCache>(new PipelineCache(this->device, this->properties, data, this->creationFeedbackEnabled));
+}
+
+void fuji::core::utility::PipelineCache::merge(const std::vector<std::unique_ptr<PipelineCache>>& sourceCaches) {
+    if(sourceCaches.empty()) {
+        return;
+    }
+
+    std::vector<vk::PipelineCache> sourceHandles;
+    std::transform(sourceCaches.begin(), sourceCaches.end(), std::back_inserter(sourceHandles), [](auto& cache) { return cache->getHandle(); });
+    this->device.mergePipelineCaches(this->pipelineCache.get(), sourceHandles);
+
+    for(auto& sourceCache : sourceCaches) {
+        this->hitCount.fetch_add(sourceCache->hitCount.exchange(0), std::memory_order_relaxed);
+        this->missCount.fetch_add(sourceCache->missCount.exchange(0), std::memory_order_relaxed);
+    }
+}
+
+std::vector<std::uint8_t> fuji::core::utility::PipelineCache::load() const {
+    std::ifstream fin { this->filePath, std::ios::in | std::ios::binary };
+    if(!fin) {
+        return std::vector<std::uint8_t> {};
+    }
+    return std::vector<std::uint8_t> { std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {} };
+}
+
+bool fuji::core::utility::PipelineCache::validate(const std::vector<std::uint8_t>& data) const noexcept {
+    if(data.size() < sizeof(FileHeader) + sizeof(VkPipelineCacheHeaderVersionOne)) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if(header.magic != fileMagic
+            || header.version != fileVersion
+            || header.driverVersion != this->properties.driverVersion
+            || header.dataSize != data.size() - sizeof(FileHeader)) {
+        return false;
+    }
+
+    VkPipelineCacheHeaderVersionOne cacheHeader;
+    std::memcpy(&cacheHeader, data.data() + sizeof(FileHeader), sizeof(cacheHeader));
+    return cacheHeader.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)
+        && cacheHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && cacheHeader.vendorID == this->properties.vendorID
+        && cacheHeader.deviceID == this->properties.deviceID
+        && std::equal(std::begin(cacheHeader.pipelineCacheUUID), std::end(cacheHeader.pipelineCacheUUID), this->properties.pipelineCacheUUID.begin());
+}
@@ -0,0 +1,57 @@
+#include <fuji/core/internal/utility/pipeline_variant_cache.hpp>
+
+fuji::core::utility::PipelineVariantCache::PipelineVariantCache(vk::Device& device, PipelineCache& pipelineCache, TemplateFactory templateFactory)
+        : device(device), pipelineCache(pipelineCache), templateFactory(std::move(templateFactory)), hitCount(0), missCount(0) {
+
+}
+
+vk::Pipeline fuji::core::utility::PipelineVariantCache::get(const SpecializationConstants& constants) {
+    std::promise<vk::Pipeline> promise;
+    {
+        std::unique_lock<std::mutex> lock { this->mutex };
+        if(auto it = this->pipelines.find(constants); it != this->pipelines.end()) {
+            this->hitCount.fetch_add(1, std::memory_order_relaxed);
+            std::shared_future<vk::Pipeline> pipeline = it->second;
+            lock.unlock();
+            return pipeline.get();
+        }
+        this->missCount.fetch_add(1, std::memory_order_relaxed);
+        this->pipelines.emplace(constants, promise.get_future().share());
+    }
+
+    // compiled outside the lock; other callers asking for the same variant wait on the shared future
+    std::vector<vk::UniquePipeline> pipelines;
+    try {
+        std::unique_ptr<GraphicsPipelineCreateInfoTemplate> createInfoTemplate = this->templateFactory();
+        createInfoTemplate->getShaderStageFlow().setSpecializationConstants(constants);
+        pipelines = GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(this->device, this->pipelineCache, createInfoTemplate);
+    } catch(...) {
+        {
+            std::lock_guard<std::mutex> lock { this->mutex };
+            this->pipelines.erase(constants);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    vk::Pipeline pipeline = pipelines[0].get();
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+        this->ownedPipelines.push_back(std::move(pipelines[0]));
+    }
+    promise.set_value(pipeline);
+    return pipeline;
+}
+
+std::size_t fuji::core::utility::PipelineVariantCache::size() {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    return this->pipelines.size();
+}
+
+std::uint64_t fuji::core::utility::PipelineVariantCache::getHitCount() const noexcept {
+    return this->hitCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t fuji::core::utility::PipelineVariantCache::getMissCount() const noexcept {
+    return this->missCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,82 @@
+#include <fuji/core/internal/utility/readback_buffer_pool.hpp>
+
+#include <algorithm>
+
+#include <fuji/core/internal/utility/memory_type.hpp>
+
+namespace {
+    constexpr vk::DeviceSize minimumCapacity = 64 * 1024;
+
+    vk::DeviceSize roundUpCapacity(vk::DeviceSize size) {
+        vk::DeviceSize capacity = minimumCapacity;
+        while(capacity < size) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+}
+
+fuji::core::utility::ReadbackBufferPool::ReadbackBufferPool(const vk::PhysicalDevice& physicalDevice, const vk::Device& device)
+        : device(device), memoryProperties(physicalDevice.getMemoryProperties()) {
+
+}
+
+std::unique_ptr<fuji::core::utility::ReadbackBuffer> fuji::core::utility::ReadbackBufferPool::acquire(vk::DeviceSize size) {
+    auto best = this->freeBuffers.end();
+    for(auto it = this->freeBuffers.begin(); it != this->freeBuffers.end(); ++it) {
+        if((*it)->capacity >= size && (best == this->freeBuffers.end() || (*it)->capacity < (*best)->capacity)) {
+            best = it;
+        }
+    }
+    if(best == this->freeBuffers.end()) {
+        return this->create(roundUpCapacity(size));
+    }
+
+    std::unique_ptr<ReadbackBuffer> buffer = std::move(*best);
+    this->freeBuffers.erase(best);
+    return buffer;
+}
+
+void fuji::core::utility::ReadbackBufferPool::release(std::unique_ptr<ReadbackBuffer> buffer) {
+    if(buffer) {
+        this->freeBuffers.push_back(std::move(buffer));
+    }
+}
+
+void fuji::core::utility::ReadbackBufferPool::invalidate(const ReadbackBuffer& buffer) const {
+    if(!buffer.coherent) {
+        this->device.invalidateMappedMemoryRanges({ vk::MappedMemoryRange { buffer.memory.get(), 0, VK_WHOLE_SIZE } });
+    }
+}
+
+std::size_t fuji::core::utility::ReadbackBufferPool::getPooledCount() const noexcept {
+    return this->freeBuffers.size();
+}
+
+std::unique_ptr<fuji::core::utility::ReadbackBuffer> fuji::core::utility::ReadbackBufferPool::create(vk::DeviceSize capacity) const {
+    auto buffer = std::make_unique<ReadbackBuffer>();
+
+    vk::BufferCreateInfo bufferInfo {};
+    bufferInfo.size = capacity;
+    bufferInfo.usage = vk::BufferUsageFlagBits::eTransferDst;
+    bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+    buffer->buffer = this->device.createBufferUnique(bufferInfo);
+
+    vk::MemoryRequirements requirements = this->device.getBufferMemoryRequirements(buffer->buffer.get());
+    std::uint32_t memoryType = requireMemoryType(
+        this->memoryProperties,
+        requirements.memoryTypeBits,
+        vk::MemoryPropertyFlagBits::eHostVisible,
+        vk::MemoryPropertyFlagBits::eHostCached);
+
+    vk::MemoryAllocateInfo allocInfo {};
+    allocInfo.allocationSize = requirements.size;
+    allocInfo.memoryTypeIndex = memoryType;
+    buffer->memory = this->device.allocateMemoryUnique(allocInfo);
+    this->device.bindBufferMemory(buffer->buffer.get(), buffer->memory.get(), 0);
+
+    buffer->mappedData = static_cast<const std::uint8_t*>(this->device.mapMemory(buffer->memory.get(), 0, VK_WHOLE_SIZE));
+    buffer->capacity = capacity;
+    buffer->coherent = static_cast<bool>(this->memoryProperties.memoryTypes[memoryType].propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent);
+    return buffer;
+}
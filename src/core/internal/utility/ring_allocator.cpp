@@ -0,0 +1,73 @@
+#include <fuji/core/internal/utility/ring_allocator.hpp>
+
+namespace {
+    std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+fuji::core::utility::RingAllocator::RingAllocator(std::uint64_t capacity)
+        : capacity(capacity), head(0), tail(0), totalAllocated(0), totalReleased(0) {
+
+}
+
+std::optional<std::uint64_t> fuji::core::utility::RingAllocator::allocate(std::uint64_t size, std::uint64_t alignment) {
+    if(size == 0 || size > this->capacity) {
+        return std::nullopt;
+    }
+    if(this->getUsedBytes() == 0) {
+        this->head = 0;
+        this->tail = 0;
+    } else if(this->head == this->tail) {
+        return std::nullopt;
+    }
+
+    std::uint64_t offset = alignUp(this->head, alignment);
+    if(this->head > this->tail || this->getUsedBytes() == 0) {
+        if(offset + size <= this->capacity) {
+            this->totalAllocated += offset + size - this->head;
+            this->head = offset + size;
+            return offset;
+        }
+        if(size > this->tail) {
+            return std::nullopt;
+        }
+        this->totalAllocated += this->capacity - this->head + size;
+        this->head = size;
+        return 0;
+    }
+
+    if(offset + size > this->tail) {
+        return std::nullopt;
+    }
+    this->totalAllocated += offset + size - this->head;
+    this->head = offset + size;
+    return offset;
+}
+
+void fuji::core::utility::RingAllocator::endFrame(std::uint64_t frameNumber) {
+    this->frames.push_back(FrameMarker { frameNumber, this->head, this->totalAllocated });
+}
+
+void fuji::core::utility::RingAllocator::release(std::uint64_t completedFrameNumber) {
+    while(!this->frames.empty() && this->frames.front().frameNumber <= completedFrameNumber) {
+        this->tail = this->frames.front().head;
+        this->totalReleased = this->frames.front().totalAllocated;
+        this->frames.pop_front();
+    }
+}
+
+std::uint64_t fuji::core::utility::RingAllocator::getCapacity() const noexcept {
+    return this->capacity;
+}
+
+std::uint64_t fuji::core::utility::RingAllocator::getUsedBytes() const noexcept {
+    return this->totalAllocated - this->totalReleased;
+}
+
+std::optional<std::uint64_t> fuji::core::utility::RingAllocator::getOldestFrameNumber() const noexcept {
+    if(this->frames.empty()) {
+        return std::nullopt;
+    }
+    return this->frames.front().frameNumber;
+}
@@ -1,24 +1,63 @@
 #include <fuji/core/internal/utility/shader_module.hpp>
 
 #include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    constexpr std::uint32_t spirvMagicNumber = 0x07230203;
+}
 
 fuji::core::utility::ShaderModule::ShaderModule(const vk::Device& device, const std::vector<char>& code, vk::ShaderStageFlagBits shaderStage)
         : shaderStage(shaderStage) {
-    std::vector<std::uint32_t> data(code.size() / 4 + (code.size() % 4 ? 1 : 0));
-    std::memcpy(data.data(), code.data(), code.size());
-    vk::ShaderModuleCreateInfo createInfo {
-        {},
-        data.size() * sizeof(std::uint32_t),
-        data.data()
-    };
-    this->shaderModule = device.createShaderModuleUnique(createInfo);
+    if(reinterpret_cast<std::uintptr_t>(code.data()) % alignof(std::uint32_t) == 0) {
+        this->shaderModule = createHandle(device, asSpirv(reinterpret_cast<const std::uint8_t*>(code.data()), code.size()));
+    } else {
+        std::vector<std::uint32_t> data(code.size() / 4 + (code.size() % 4 ? 1 : 0));
+        std::memcpy(data.data(), code.data(), code.size());
+        this->shaderModule = createHandle(device, asSpirv(reinterpret_cast<const std::uint8_t*>(data.data()), code.size()));
+    }
+}
+
+fuji::core::utility::ShaderModule::ShaderModule(const vk::Device& device, vk::ArrayProxy<const std::uint32_t> code, vk::ShaderStageFlagBits shaderStage)
+        : shaderModule(createHandle(device, code)), shaderStage(shaderStage) {
+}
+
+fuji::core::utility::ShaderModule::ShaderModule(const vk::Device& device, const MappedFile& file, vk::ShaderStageFlagBits shaderStage)
+        : shaderModule(createHandle(device, asSpirv(file.getData(), file.getSize()))), shaderStage(shaderStage) {
 }
 
+fuji::core::utility::ShaderModule::ShaderModule(std::shared_ptr<const vk::UniqueShaderModule> shaderModule, vk::ShaderStageFlagBits shaderStage)
+        : shaderModule(std::move(shaderModule)), shaderStage(shaderStage) {
+}
 
 const vk::ShaderModule& fuji::core::utility::ShaderModule::getHandle() const {
-    return this->shaderModule.get();
+    return this->shaderModule->get();
 }
 
 vk::ShaderStageFlagBits fuji::core::utility::ShaderModule::getShaderStage() const {
     return this->shaderStage;
-}
\ No newline at end of file
+}
+
+vk::ArrayProxy<const std::uint32_t> fuji::core::utility::ShaderModule::asSpirv(const std::uint8_t* data, std::size_t size) {
+    if(size % sizeof(std::uint32_t) != 0) {
+        throw std::runtime_error("SPIR-V code size is not a multiple of 4");
+    }
+    if(reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint32_t) != 0) {
+        throw std::runtime_error("SPIR-V code is not aligned to 4 bytes");
+    }
+    return vk::ArrayProxy<const std::uint32_t>(static_cast<std::uint32_t>(size / sizeof(std::uint32_t)), reinterpret_cast<const std::uint32_t*>(data));
+}
+
+std::shared_ptr<const vk::UniqueShaderModule> fuji::core::utility::ShaderModule::createHandle(const vk::Device& device, vk::ArrayProxy<const std::uint32_t> code) {
+    if(code.empty() || code.front() != spirvMagicNumber) {
+        throw std::runtime_error("invalid SPIR-V code");
+    }
+    vk::ShaderModuleCreateInfo createInfo {
+        {},
+        code.size() * sizeof(std::uint32_t),
+        code.data()
+    };
+    return std::make_shared<vk::UniqueShaderModule>(device.createShaderModuleUnique(createInfo));
+}
@@ -0,0 +1,65 @@
+#include <fuji/core/internal/utility/shader_module_registry.hpp>
+
+#include <algorithm>
+
+#include <fuji/core/internal/utility/mapped_file.hpp>
+
+fuji::core::utility::ShaderModuleRegistry::ShaderModuleRegistry(const vk::Device& device) : device(device) {
+
+}
+
+fuji::core::utility::ShaderModule fuji::core::utility::ShaderModuleRegistry::acquire(vk::ArrayProxy<const std::uint32_t> code, vk::ShaderStageFlagBits shaderStage) {
+    std::uint64_t key = hash(code);
+
+    std::lock_guard<std::mutex> lock { this->mutex };
+    this->purgeExpired();
+    auto& entries = this->shaderModules[key];
+    auto entry = std::find_if(entries.begin(), entries.end(), [&code](const Entry& entry) {
+        return entry.code.size() == code.size() && std::equal(entry.code.begin(), entry.code.end(), code.begin());
+    });
+    if(entry != entries.end()) {
+        if(std::shared_ptr<const vk::UniqueShaderModule> shaderModule = entry->shaderModule.lock()) {
+            return ShaderModule { std::move(shaderModule), shaderStage };
+        }
+    } else {
+        entry = entries.insert(entries.end(), Entry { std::vector<std::uint32_t>(code.begin(), code.end()), {} });
+    }
+    std::shared_ptr<const vk::UniqueShaderModule> shaderModule = ShaderModule::createHandle(this->device, code);
+    entry->shaderModule = shaderModule;
+    return ShaderModule { std::move(shaderModule), shaderStage };
+}
+
+fuji::core::utility::ShaderModule fuji::core::utility::ShaderModuleRegistry::acquire(const std::filesystem::path& filePath, vk::ShaderStageFlagBits shaderStage) {
+    MappedFile file { filePath };
+    return this->acquire(ShaderModule::asSpirv(file.getData(), file.getSize()), shaderStage);
+}
+
+std::size_t fuji::core::utility::ShaderModuleRegistry::size() {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    this->purgeExpired();
+    std::size_t count = 0;
+    for(auto& [key, entries] : this->shaderModules) {
+        count += entries.size();
+    }
+    return count;
+}
+
+void fuji::core::utility::ShaderModuleRegistry::purgeExpired() {
+    for(auto it = this->shaderModules.begin(); it != this->shaderModules.end();) {
+        auto& entries = it->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) { return entry.shaderModule.expired(); }), entries.end());
+        if(entries.empty()) {
+            it = this->shaderModules.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::uint64_t fuji::core::utility::ShaderModuleRegistry::hash(vk::ArrayProxy<const std::uint32_t> code) noexcept {
+    std::uint64_t value = (14695981039346656037ull ^ code.size()) * 1099511628211ull;
+    for(std::uint32_t word : code) {
+        value = (value ^ word) * 1099511628211ull;
+    }
+    return value;
+}
@@ -6,14 +6,7 @@
 fuji::core::utility::ShaderStageFlow::ShaderStageFlow(std::vector<ShaderModule> shaderModules, VertexShaderInputLayout inputLayout)
         : shaderModules(std::make_move_iterator(shaderModules.begin()), std::make_move_iterator(shaderModules.end())),
           inputLayout(std::move(inputLayout)) {
-    std::transform(this->shaderModules.begin(), this->shaderModules.end(), std::back_inserter(this->shaderStageCreateInfos), [](ShaderModule& module) {
-        return vk::PipelineShaderStageCreateInfo {
-            {},
-            module.getShaderStage(),
-            module.getHandle(),
-            "main"
-        };
-    });
+    this->createShaderStageCreateInfos();
     for(std::uint32_t binding = 0, location = 0; binding < this->inputLayout.getBindings().size(); binding++) {
         auto& bindingDescription = this->inputLayout.getBindings()[binding];
         this->bindingDescriptions.emplace_back(
@@ -40,4 +33,38 @@ const vk::PipelineVertexInputStateCreateInfo& fuji::core::utility::ShaderStageFl
 
 const std::vector<vk::PipelineShaderStageCreateInfo>& fuji::core::utility::ShaderStageFlow::getShaderStageCreateInfos() const noexcept {
     return this->shaderStageCreateInfos;
+}
+
+void fuji::core::utility::ShaderStageFlow::setSpecializationConstants(const SpecializationConstants& constants) {
+    for(auto& module : this->shaderModules) {
+        this->setSpecializationConstants(module.getShaderStage(), constants);
+    }
+}
+
+void fuji::core::utility::ShaderStageFlow::setSpecializationConstants(vk::ShaderStageFlagBits shaderStage, const SpecializationConstants& constants) {
+    Specialization& specialization = this->specializations[shaderStage];
+    specialization.constants = constants;
+    specialization.specializationInfo = specialization.constants.getSpecializationInfo();
+
+    for(auto& shaderStageCreateInfo : this->shaderStageCreateInfos) {
+        if(shaderStageCreateInfo.stage == shaderStage) {
+            shaderStageCreateInfo.pSpecializationInfo = specialization.constants.empty() ? nullptr : &specialization.specializationInfo;
+        }
+    }
+}
+
+const fuji::core::utility::SpecializationConstants* fuji::core::utility::ShaderStageFlow::getSpecializationConstants(vk::ShaderStageFlagBits shaderStage) const noexcept {
+    auto it = this->specializations.find(shaderStage);
+    return it == this->specializations.end() ? nullptr : &it->second.constants;
+}
+
+void fuji::core::utility::ShaderStageFlow::createShaderStageCreateInfos() {
+    std::transform(this->shaderModules.begin(), this->shaderModules.end(), std::back_inserter(this->shaderStageCreateInfos), [](ShaderModule& module) {
+        return vk::PipelineShaderStageCreateInfo {
+            {},
+            module.getShaderStage(),
+            module.getHandle(),
+            "main"
+        };
+    });
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <fuji/core/internal/utility/specialization_constants.hpp>
+
+#include <algorithm>
+
+bool fuji::core::utility::SpecializationConstants::empty() const noexcept {
+    return this->mapEntries.empty();
+}
+
+vk::SpecializationInfo fuji::core::utility::SpecializationConstants::getSpecializationInfo() const noexcept {
+    return vk::SpecializationInfo {
+        static_cast<std::uint32_t>(this->mapEntries.size()),
+        this->mapEntries.data(),
+        this->data.size(),
+        this->data.data()
+    };
+}
+
+bool fuji::core::utility::SpecializationConstants::operator==(const SpecializationConstants& other) const noexcept {
+    return std::equal(this->mapEntries.begin(), this->mapEntries.end(), other.mapEntries.begin(), other.mapEntries.end(), [this, &other](auto& lhs, auto& rhs) {
+        return lhs.constantID == rhs.constantID
+            && lhs.size == rhs.size
+            && std::memcmp(this->data.data() + lhs.offset, other.data.data() + rhs.offset, lhs.size) == 0;
+    });
+}
+
+bool fuji::core::utility::SpecializationConstants::operator!=(const SpecializationConstants& other) const noexcept {
+    return !(*this == other);
+}
+
+fuji::core::utility::SpecializationConstants& fuji::core::utility::SpecializationConstants::setBytes(std::uint32_t constantID, const void* value, std::size_t size) {
+    auto it = std::lower_bound(this->mapEntries.begin(), this->mapEntries.end(), constantID, [](auto& entry, std::uint32_t id) { return entry.constantID < id; });
+    if(it != this->mapEntries.end() && it->constantID == constantID) {
+        if(it->size == size) {
+            std::memcpy(this->data.data() + it->offset, value, size);
+            return *this;
+        }
+        std::uint32_t removedOffset = it->offset;
+        std::size_t removedSize = it->size;
+        this->data.erase(this->data.begin() + removedOffset, this->data.begin() + removedOffset + removedSize);
+        it = this->mapEntries.erase(it);
+        for(auto& entry : this->mapEntries) {
+            if(entry.offset > removedOffset) {
+                entry.offset -= static_cast<std::uint32_t>(removedSize);
+            }
+        }
+    }
+
+    std::uint32_t offset = static_cast<std::uint32_t>(this->data.size());
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(value);
+    this->data.insert(this->data.end(), bytes, bytes + size);
+    this->mapEntries.insert(it, vk::SpecializationMapEntry { constantID, offset, size });
+    return *this;
+}
+
+std::size_t fuji::core::utility::SpecializationConstants::Hash::operator()(const SpecializationConstants& constants) const noexcept {
+    std::uint64_t value = 14695981039346656037ull;
+    for(auto& entry : constants.mapEntries) {
+        value = (value ^ entry.constantID) * 1099511628211ull;
+        for(std::size_t i = 0; i < entry.size; i++) {
+            value = (value ^ constants.data[entry.offset + i]) * 1099511628211ull;
+        }
+    }
+    return static_cast<std::size_t>(value);
+}
@@ -0,0 +1,93 @@
+#include <fuji/core/internal/utility/streaming_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+fuji::core::utility::StreamingBuffer::StreamingBuffer(MemoryAllocator& allocator, FrameRing& frameRing, vk::DeviceSize capacity, vk::BufferUsageFlags usage, vk::DeviceSize alignment)
+        : allocator(allocator), frameRing(frameRing), alignment(std::max<vk::DeviceSize>(1, alignment)), ring(capacity), flushCount(0), stallCount(0) {
+    vk::BufferCreateInfo bufferInfo {};
+    bufferInfo.size = capacity;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+    this->buffer = this->allocator.createBuffer(bufferInfo, vk::MemoryPropertyFlagBits::eHostVisible, vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eHostCoherent);
+    this->coherent = this->allocator.isCoherent(this->buffer.allocation.get());
+}
+
+void fuji::core::utility::StreamingBuffer::beginFrame() {
+    this->ring.release(this->frameRing.getCompletedFrameNumber());
+}
+
+std::optional<fuji::core::utility::StreamingRange> fuji::core::utility::StreamingBuffer::allocate(vk::DeviceSize size, vk::DeviceSize alignment) {
+    alignment = std::max(alignment, this->alignment);
+    auto offset = this->ring.allocate(size, alignment);
+    while(!offset) {
+        auto oldestFrame = this->ring.getOldestFrameNumber();
+        if(!oldestFrame) {
+            return std::nullopt;
+        }
+        this->frameRing.wait(*oldestFrame);
+        this->ring.release(*oldestFrame);
+        this->stallCount++;
+        offset = this->ring.allocate(size, alignment);
+    }
+
+    const Allocation& allocation = this->buffer.allocation.get();
+    if(!this->coherent) {
+        Allocation range = allocation;
+        range.offset = allocation.offset + *offset;
+        range.size = size;
+        if(!this->pendingFlushes.empty() && this->pendingFlushes.back().offset + this->pendingFlushes.back().size <= range.offset
+                && range.offset - (this->pendingFlushes.back().offset + this->pendingFlushes.back().size) < alignment) {
+            this->pendingFlushes.back().size = range.offset + range.size - this->pendingFlushes.back().offset;
+        } else {
+            this->pendingFlushes.push_back(range);
+        }
+    }
+    return StreamingRange { this->buffer.buffer.get(), *offset, size, allocation.mappedData + *offset };
+}
+
+std::optional<fuji::core::utility::StreamingRange> fuji::core::utility::StreamingBuffer::write(const void* data, vk::DeviceSize size, vk::DeviceSize alignment) {
+    auto range = this->allocate(size, alignment);
+    if(range) {
+        std::memcpy(range->data, data, size);
+    }
+    return range;
+}
+
+void fuji::core::utility::StreamingBuffer::flush() {
+    if(this->pendingFlushes.empty()) {
+        return;
+    }
+    this->allocator.flush(this->pendingFlushes);
+    this->pendingFlushes.clear();
+    this->flushCount++;
+}
+
+void fuji::core::utility::StreamingBuffer::endFrame() {
+    this->flush();
+    this->ring.endFrame(this->frameRing.getFrameNumber());
+}
+
+const vk::Buffer& fuji::core::utility::StreamingBuffer::getBuffer() const {
+    return this->buffer.buffer.get();
+}
+
+vk::DeviceSize fuji::core::utility::StreamingBuffer::getCapacity() const noexcept {
+    return this->ring.getCapacity();
+}
+
+vk::DeviceSize fuji::core::utility::StreamingBuffer::getUsedBytes() const noexcept {
+    return this->ring.getUsedBytes();
+}
+
+bool fuji::core::utility::StreamingBuffer::isCoherent() const noexcept {
+    return this->coherent;
+}
+
+std::uint64_t fuji::core::utility::StreamingBuffer::getFlushCount() const noexcept {
+    return this->flushCount;
+}
+
+std::uint64_t fuji::core::utility::StreamingBuffer::getStallCount() const noexcept {
+    return this->stallCount;
+}
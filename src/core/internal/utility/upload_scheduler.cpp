@@ -0,0 +1,373 @@
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    vk::ImageSubresourceRange createSubresourceRange() {
+        vk::ImageSubresourceRange range {};
+        range.aspectMask = vk::ImageAspectFlagBits::eColor;
+        range.baseMipLevel = 0;
+        range.levelCount = VK_REMAINING_MIP_LEVELS;
+        range.baseArrayLayer = 0;
+        range.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        return range;
+    }
+
+    // images kept in eGeneral are written in place so that untouched texels stay readable by in-flight frames
+    vk::ImageLayout getTransferLayout(vk::ImageLayout newLayout) {
+        return newLayout == vk::ImageLayout::eGeneral ? vk::ImageLayout::eGeneral : vk::ImageLayout::eTransferDstOptimal;
+    }
+
+    vk::AccessFlags getShaderAccess(vk::PipelineStageFlags stage) {
+        return stage & vk::PipelineStageFlagBits::eTransfer ? vk::AccessFlagBits::eTransferRead : vk::AccessFlagBits::eShaderRead;
+    }
+}
+
+fuji::core::utility::UploadScheduler::UploadScheduler(const vk::PhysicalDevice& physicalDevice, MemoryAllocator& allocator, std::uint32_t graphicsQueueFamilyIndex, std::uint32_t transferQueueFamilyIndex, vk::DeviceSize stagingSize)
+        : device(allocator.getDevice()), allocator(allocator),
+          graphicsQueueFamilyIndex(graphicsQueueFamilyIndex), transferQueueFamilyIndex(transferQueueFamilyIndex),
+          stagingAlignment(std::max<vk::DeviceSize>(16, physicalDevice.getProperties().limits.optimalBufferCopyOffsetAlignment)),
+          stagingRing(stagingSize), submittedValue(0) {
+    vk::BufferCreateInfo stagingInfo {};
+    stagingInfo.size = stagingSize;
+    stagingInfo.usage = vk::BufferUsageFlagBits::eTransferSrc;
+    stagingInfo.sharingMode = vk::SharingMode::eExclusive;
+    this->stagingBuffer = this->allocator.createBuffer(stagingInfo, vk::MemoryPropertyFlagBits::eHostVisible, vk::MemoryPropertyFlagBits::eHostCoherent);
+
+    vk::SemaphoreTypeCreateInfo semaphoreTypeInfo {};
+    semaphoreTypeInfo.semaphoreType = vk::SemaphoreType::eTimeline;
+    semaphoreTypeInfo.initialValue = 0;
+    vk::SemaphoreCreateInfo semaphoreInfo {};
+    semaphoreInfo.pNext = &semaphoreTypeInfo;
+    this->timelineSemaphore = this->device.createSemaphoreUnique(semaphoreInfo);
+
+    vk::CommandPoolCreateInfo poolInfo {};
+    poolInfo.flags = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+    poolInfo.queueFamilyIndex = transferQueueFamilyIndex;
+    this->commandPool = this->device.createCommandPoolUnique(poolInfo);
+}
+
+fuji::core::utility::UploadScheduler::~UploadScheduler() {
+    try {
+        this->wait(this->submittedValue);
+    } catch(...) {
+    }
+}
+
+std::uint32_t fuji::core::utility::UploadScheduler::findTransferQueueFamily(const vk::PhysicalDevice& physicalDevice, std::uint32_t graphicsQueueFamilyIndex) {
+    auto queueFamilies = physicalDevice.getQueueFamilyProperties();
+    auto isTransferOnly = [](const vk::QueueFamilyProperties& family) {
+        return (family.queueFlags & vk::QueueFlagBits::eTransfer) && !(family.queueFlags & (vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute));
+    };
+    auto isTransferWithoutGraphics = [](const vk::QueueFamilyProperties& family) {
+        return (family.queueFlags & (vk::QueueFlagBits::eTransfer | vk::QueueFlagBits::eCompute)) && !(family.queueFlags & vk::QueueFlagBits::eGraphics);
+    };
+
+    for(auto predicate : { +isTransferOnly, +isTransferWithoutGraphics }) {
+        auto family = std::find_if(queueFamilies.begin(), queueFamilies.end(), predicate);
+        if(family != queueFamilies.end()) {
+            return static_cast<std::uint32_t>(std::distance(queueFamilies.begin(), family));
+        }
+    }
+    return graphicsQueueFamilyIndex;
+}
+
+void fuji::core::utility::UploadScheduler::uploadBuffer(const vk::Buffer& buffer, vk::DeviceSize offset, const void* data, vk::DeviceSize size, vk::SharingMode sharingMode, vk::PipelineStageFlags dstStage, vk::AccessFlags dstAccess) {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    StagingRange range = this->stage(data, size);
+
+    BufferUpload upload {};
+    upload.buffer = buffer;
+    upload.copy = vk::BufferCopy { range.offset, offset, size };
+    upload.stagingBuffer = range.buffer;
+    upload.dstStage = dstStage;
+    upload.dstAccess = dstAccess;
+    upload.transferOwnership = sharingMode == vk::SharingMode::eExclusive && this->transferQueueFamilyIndex != this->graphicsQueueFamilyIndex;
+    this->pendingBufferUploads.push_back(upload);
+}
+
+void fuji::core::utility::UploadScheduler::uploadImage(const vk::Image& image, vk::ArrayProxy<const ImageUploadRegion> regions, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, vk::SharingMode sharingMode, vk::PipelineStageFlags dstStage) {
+    bool transferOwnership = sharingMode == vk::SharingMode::eExclusive && this->transferQueueFamilyIndex != this->graphicsQueueFamilyIndex;
+
+    std::lock_guard<std::mutex> lock { this->mutex };
+    // uploads to an image already pending in this flush are merged so that it gets one transition each way
+    auto pending = std::find_if(this->pendingImageUploads.begin(), this->pendingImageUploads.end(), [&image](const ImageUpload& upload) { return upload.image == image; });
+    if(pending != this->pendingImageUploads.end()) {
+        if(pending->newLayout != newLayout || pending->transferOwnership != transferOwnership) {
+            throw std::logic_error("uploads to one image within a flush must share the new layout and sharing mode");
+        }
+    } else if(transferOwnership && oldLayout != vk::ImageLayout::eUndefined) {
+        throw std::logic_error("exclusive images can only be uploaded from eUndefined on a dedicated transfer queue");
+    }
+
+    std::vector<std::pair<vk::Buffer, vk::BufferImageCopy>> copies;
+    for(auto& region : regions) {
+        StagingRange range = this->stage(region.data, region.size);
+
+        vk::BufferImageCopy copy {};
+        copy.bufferOffset = range.offset;
+        copy.bufferRowLength = region.rowLength;
+        copy.bufferImageHeight = 0;
+        copy.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
+        copy.imageSubresource.mipLevel = 0;
+        copy.imageSubresource.baseArrayLayer = region.arrayLayer;
+        copy.imageSubresource.layerCount = 1;
+        copy.imageOffset = region.offset;
+        copy.imageExtent = region.extent;
+        copies.emplace_back(range.buffer, copy);
+    }
+
+    if(pending != this->pendingImageUploads.end()) {
+        pending->copies.insert(pending->copies.end(), copies.begin(), copies.end());
+        pending->dstStage |= dstStage;
+        return;
+    }
+
+    ImageUpload upload {};
+    upload.image = image;
+    upload.copies = std::move(copies);
+    upload.oldLayout = oldLayout;
+    upload.newLayout = newLayout;
+    upload.dstStage = dstStage;
+    upload.transferOwnership = transferOwnership;
+    this->pendingImageUploads.push_back(std::move(upload));
+}
+
+std::uint64_t fuji::core::utility::UploadScheduler::flush(const vk::Queue& transferQueue) {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    if(this->pendingBufferUploads.empty() && this->pendingImageUploads.empty()) {
+        return this->submittedValue;
+    }
+
+    std::uint64_t value = this->submittedValue + 1;
+    bool sameFamily = this->transferQueueFamilyIndex == this->graphicsQueueFamilyIndex;
+    PendingAcquire acquire { value, vk::PipelineStageFlags {}, {}, {} };
+
+    vk::CommandBuffer commandBuffer = this->acquireCommandBuffer();
+    vk::CommandBufferBeginInfo beginInfo {};
+    beginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+    commandBuffer.begin(beginInfo);
+
+    std::vector<vk::ImageMemoryBarrier> preBarriers;
+    for(auto& upload : this->pendingImageUploads) {
+        if(upload.oldLayout == getTransferLayout(upload.newLayout)) {
+            continue;
+        }
+        vk::ImageMemoryBarrier barrier {};
+        barrier.srcAccessMask = vk::AccessFlags {};
+        barrier.dstAccessMask = vk::AccessFlagBits::eTransferWrite;
+        barrier.oldLayout = upload.oldLayout;
+        barrier.newLayout = getTransferLayout(upload.newLayout);
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = upload.image;
+        barrier.subresourceRange = createSubresourceRange();
+        preBarriers.push_back(barrier);
+    }
+    if(!preBarriers.empty()) {
+        commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eAllCommands, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags {}, {}, {}, preBarriers);
+    }
+
+    for(auto& upload : this->pendingBufferUploads) {
+        commandBuffer.copyBuffer(upload.stagingBuffer, upload.buffer, { upload.copy });
+    }
+    for(auto& upload : this->pendingImageUploads) {
+        for(auto& [source, copy] : upload.copies) {
+            commandBuffer.copyBufferToImage(source, upload.image, getTransferLayout(upload.newLayout), { copy });
+        }
+    }
+
+    vk::PipelineStageFlags postStage = vk::PipelineStageFlagBits::eBottomOfPipe;
+    std::vector<vk::BufferMemoryBarrier> bufferBarriers;
+    std::vector<vk::ImageMemoryBarrier> imageBarriers;
+    for(auto& upload : this->pendingBufferUploads) {
+        vk::BufferMemoryBarrier barrier {};
+        barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+        barrier.dstAccessMask = sameFamily ? upload.dstAccess : vk::AccessFlags {};
+        barrier.srcQueueFamilyIndex = upload.transferOwnership ? this->transferQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = upload.transferOwnership ? this->graphicsQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = upload.buffer;
+        barrier.offset = upload.copy.dstOffset;
+        barrier.size = upload.copy.size;
+        if(sameFamily) {
+            postStage |= upload.dstStage;
+        }
+        if(sameFamily || upload.transferOwnership) {
+            bufferBarriers.push_back(barrier);
+        }
+        if(upload.transferOwnership) {
+            barrier.srcAccessMask = vk::AccessFlags {};
+            barrier.dstAccessMask = upload.dstAccess;
+            acquire.bufferBarriers.push_back(barrier);
+            acquire.dstStage |= upload.dstStage;
+        }
+    }
+    for(auto& upload : this->pendingImageUploads) {
+        vk::ImageMemoryBarrier barrier {};
+        barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+        barrier.dstAccessMask = sameFamily ? getShaderAccess(upload.dstStage) : vk::AccessFlags {};
+        barrier.oldLayout = getTransferLayout(upload.newLayout);
+        barrier.newLayout = upload.newLayout;
+        barrier.srcQueueFamilyIndex = upload.transferOwnership ? this->transferQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = upload.transferOwnership ? this->graphicsQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = upload.image;
+        barrier.subresourceRange = createSubresourceRange();
+        if(sameFamily) {
+            postStage |= upload.dstStage;
+        }
+        imageBarriers.push_back(barrier);
+        if(upload.transferOwnership) {
+            barrier.srcAccessMask = vk::AccessFlags {};
+            barrier.dstAccessMask = getShaderAccess(upload.dstStage);
+            acquire.imageBarriers.push_back(barrier);
+            acquire.dstStage |= upload.dstStage;
+        }
+    }
+    if(!bufferBarriers.empty() || !imageBarriers.empty()) {
+        commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, postStage, vk::DependencyFlags {}, {}, bufferBarriers, imageBarriers);
+    }
+    commandBuffer.end();
+
+    this->allocator.flush(this->stagingBuffer.allocation.get());
+
+    vk::TimelineSemaphoreSubmitInfo timelineInfo {};
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &value;
+    vk::SubmitInfo submitInfo {};
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &this->timelineSemaphore.get();
+    transferQueue.submit({ submitInfo }, VK_NULL_HANDLE);
+
+    this->submittedValue = value;
+    this->stagingRing.endFrame(value);
+    for(auto& buffer : this->pendingTemporaryBuffers) {
+        this->temporaryBuffers.emplace_back(value, std::move(buffer));
+    }
+    this->pendingTemporaryBuffers.clear();
+    this->pendingBufferUploads.clear();
+    this->pendingImageUploads.clear();
+    if(!acquire.bufferBarriers.empty() || !acquire.imageBarriers.empty()) {
+        this->pendingAcquires.push_back(std::move(acquire));
+    }
+    return value;
+}
+
+std::uint64_t fuji::core::utility::UploadScheduler::recordAcquireBarriers(vk::CommandBuffer& graphicsCommandBuffer) {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    std::uint64_t waitValue = 0;
+    for(auto& acquire : this->pendingAcquires) {
+        graphicsCommandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, acquire.dstStage, vk::DependencyFlags {}, {}, acquire.bufferBarriers, acquire.imageBarriers);
+        waitValue = std::max(waitValue, acquire.value);
+    }
+    this->pendingAcquires.clear();
+    return waitValue;
+}
+
+bool fuji::core::utility::UploadScheduler::isComplete(std::uint64_t value) const {
+    return this->getCompletedValue() >= value;
+}
+
+void fuji::core::utility::UploadScheduler::wait(std::uint64_t value) const {
+    if(value == 0) {
+        return;
+    }
+    vk::SemaphoreWaitInfo waitInfo {};
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &this->timelineSemaphore.get();
+    waitInfo.pValues = &value;
+    auto result = this->device.waitSemaphores(waitInfo, std::numeric_limits<std::uint64_t>::max());
+    if(result != vk::Result::eSuccess) {
+        throw std::runtime_error("failed to wait timeline semaphore");
+    }
+}
+
+bool fuji::core::utility::UploadScheduler::hasPendingUploads() const {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    return !this->pendingBufferUploads.empty() || !this->pendingImageUploads.empty();
+}
+
+const vk::Semaphore& fuji::core::utility::UploadScheduler::getTimelineSemaphore() const noexcept {
+    return this->timelineSemaphore.get();
+}
+
+std::uint64_t fuji::core::utility::UploadScheduler::getSubmittedValue() const noexcept {
+    return this->submittedValue;
+}
+
+std::uint32_t fuji::core::utility::UploadScheduler::getQueueFamilyIndex() const noexcept {
+    return this->transferQueueFamilyIndex;
+}
+
+std::vector<std::uint32_t> fuji::core::utility::UploadScheduler::getQueueFamilyIndices() const {
+    if(this->transferQueueFamilyIndex == this->graphicsQueueFamilyIndex) {
+        return { this->graphicsQueueFamilyIndex };
+    }
+    return { this->graphicsQueueFamilyIndex, this->transferQueueFamilyIndex };
+}
+
+fuji::core::utility::UploadScheduler::StagingRange fuji::core::utility::UploadScheduler::stage(const void* data, vk::DeviceSize size) {
+    this->releaseCompleted();
+    auto offset = this->stagingRing.allocate(size, this->stagingAlignment);
+    if(!offset && !this->commandBuffers.empty()) {
+        this->wait(this->commandBuffers.front().first);
+        this->releaseCompleted();
+        offset = this->stagingRing.allocate(size, this->stagingAlignment);
+    }
+
+    if(offset) {
+        std::memcpy(this->stagingBuffer.allocation->mappedData + *offset, data, size);
+        return StagingRange { this->stagingBuffer.buffer.get(), *offset };
+    }
+
+    vk::BufferCreateInfo bufferInfo {};
+    bufferInfo.size = size;
+    bufferInfo.usage = vk::BufferUsageFlagBits::eTransferSrc;
+    bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+    AllocatedBuffer temporaryBuffer = this->allocator.createBuffer(bufferInfo, vk::MemoryPropertyFlagBits::eHostVisible, vk::MemoryPropertyFlagBits::eHostCoherent);
+    std::memcpy(temporaryBuffer.allocation->mappedData, data, size);
+    this->allocator.flush(temporaryBuffer.allocation.get());
+
+    StagingRange range { temporaryBuffer.buffer.get(), 0 };
+    this->pendingTemporaryBuffers.push_back(std::move(temporaryBuffer));
+    return range;
+}
+
+vk::CommandBuffer fuji::core::utility::UploadScheduler::acquireCommandBuffer() {
+    this->releaseCompleted();
+
+    std::uint64_t completedValue = this->getCompletedValue();
+    if(!this->commandBuffers.empty() && this->commandBuffers.front().first <= completedValue) {
+        auto entry = std::move(this->commandBuffers.front());
+        this->commandBuffers.pop_front();
+        entry.second->reset(vk::CommandBufferResetFlags {});
+        entry.first = this->submittedValue + 1;
+        this->commandBuffers.push_back(std::move(entry));
+        return this->commandBuffers.back().second.get();
+    }
+
+    vk::CommandBufferAllocateInfo allocInfo {};
+    allocInfo.commandPool = this->commandPool.get();
+    allocInfo.level = vk::CommandBufferLevel::ePrimary;
+    allocInfo.commandBufferCount = 1;
+    this->commandBuffers.emplace_back(this->submittedValue + 1, std::move(this->device.allocateCommandBuffersUnique(allocInfo)[0]));
+    return this->commandBuffers.back().second.get();
+}
+
+void fuji::core::utility::UploadScheduler::releaseCompleted() {
+    std::uint64_t completedValue = this->getCompletedValue();
+    this->stagingRing.release(completedValue);
+    while(!this->temporaryBuffers.empty() && this->temporaryBuffers.front().first <= completedValue) {
+        this->temporaryBuffers.pop_front();
+    }
+}
+
+std::uint64_t fuji::core::utility::UploadScheduler::getCompletedValue() const {
+    return this->device.getSemaphoreCounterValue(this->timelineSemaphore.get());
+}
@@ -0,0 +1,152 @@
+#include <fuji/core/internal/utility/work_stealing_thread_pool.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    thread_local const fuji::core::utility::WorkStealingThreadPool* currentPool = nullptr;
+    thread_local std::size_t currentWorkerIndex = 0;
+}
+
+fuji::core::utility::WorkStealingThreadPool::WorkStealingThreadPool(std::uint32_t workerCount)
+        : queuedTaskCount(0), pendingTaskCount(0), nextQueue(0), stealCount(0), stopping(false) {
+    if(workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for(std::uint32_t i = 0; i < workerCount; i++) {
+        this->queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for(std::uint32_t i = 0; i < workerCount; i++) {
+        this->workers.emplace_back(&WorkStealingThreadPool::work, this, i);
+    }
+}
+
+fuji::core::utility::WorkStealingThreadPool::~WorkStealingThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+        this->stopping = true;
+    }
+    this->taskAvailable.notify_all();
+    std::for_each(this->workers.begin(), this->workers.end(), [](std::thread& worker) { worker.join(); });
+}
+
+void fuji::core::utility::WorkStealingThreadPool::submit(Task task) {
+    std::size_t queueIndex = currentPool == this ? currentWorkerIndex : this->selectQueue();
+    this->push(queueIndex, std::move(task));
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+    }
+    this->taskAvailable.notify_one();
+}
+
+void fuji::core::utility::WorkStealingThreadPool::submit(std::vector<Task> tasks) {
+    if(tasks.empty()) {
+        return;
+    }
+    for(auto& task : tasks) {
+        std::size_t queueIndex = currentPool == this ? currentWorkerIndex : this->selectQueue();
+        this->push(queueIndex, std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock { this->mutex };
+    }
+    this->taskAvailable.notify_all();
+}
+
+void fuji::core::utility::WorkStealingThreadPool::wait() {
+    if(currentPool == this) {
+        throw std::logic_error("WorkStealingThreadPool::wait must not be called from a worker thread");
+    }
+    std::unique_lock<std::mutex> lock { this->mutex };
+    this->tasksFinished.wait(lock, [this] { return this->pendingTaskCount.load() == 0; });
+    if(this->firstException) {
+        std::exception_ptr exception = this->firstException;
+        this->firstException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+std::uint32_t fuji::core::utility::WorkStealingThreadPool::getWorkerCount() const noexcept {
+    return static_cast<std::uint32_t>(this->workers.size());
+}
+
+std::size_t fuji::core::utility::WorkStealingThreadPool::getPendingTaskCount() const noexcept {
+    return this->pendingTaskCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t fuji::core::utility::WorkStealingThreadPool::getStealCount() const noexcept {
+    return this->stealCount.load(std::memory_order_relaxed);
+}
+
+void fuji::core::utility::WorkStealingThreadPool::work(std::size_t workerIndex) {
+    currentPool = this;
+    currentWorkerIndex = workerIndex;
+    while(true) {
+        Task task;
+        if(!this->pop(workerIndex, task) && !this->steal(workerIndex, task)) {
+            std::unique_lock<std::mutex> lock { this->mutex };
+            this->taskAvailable.wait(lock, [this] { return this->stopping || this->queuedTaskCount.load() > 0; });
+            if(this->stopping && this->queuedTaskCount.load() == 0) {
+                return;
+            }
+            continue;
+        }
+
+        try {
+            task();
+        } catch(...) {
+            std::lock_guard<std::mutex> lock { this->mutex };
+            if(!this->firstException) {
+                this->firstException = std::current_exception();
+            }
+        }
+        task = nullptr;
+
+        if(this->pendingTaskCount.fetch_sub(1) == 1) {
+            {
+                std::lock_guard<std::mutex> lock { this->mutex };
+            }
+            this->tasksFinished.notify_all();
+        }
+    }
+}
+
+bool fuji::core::utility::WorkStealingThreadPool::pop(std::size_t workerIndex, Task& task) {
+    WorkerQueue& queue = *this->queues[workerIndex];
+    std::lock_guard<std::mutex> lock { queue.mutex };
+    if(queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    this->queuedTaskCount.fetch_sub(1);
+    return true;
+}
+
+bool fuji::core::utility::WorkStealingThreadPool::steal(std::size_t workerIndex, Task& task) {
+    for(std::size_t i = 1; i < this->queues.size(); i++) {
+        WorkerQueue& queue = *this->queues[(workerIndex + i) % this->queues.size()];
+        std::lock_guard<std::mutex> lock { queue.mutex };
+        if(queue.tasks.empty()) {
+            continue;
+        }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        this->queuedTaskCount.fetch_sub(1);
+        this->stealCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void fuji::core::utility::WorkStealingThreadPool::push(std::size_t queueIndex, Task task) {
+    this->pendingTaskCount.fetch_add(1);
+    WorkerQueue& queue = *this->queues[queueIndex];
+    std::lock_guard<std::mutex> lock { queue.mutex };
+    queue.tasks.push_back(std::move(task));
+    this->queuedTaskCount.fetch_add(1);
+}
+
+std::size_t fuji::core::utility::WorkStealingThreadPool::selectQueue() noexcept {
+    return this->nextQueue.fetch_add(1, std::memory_order_relaxed) % this->queues.size();
+}
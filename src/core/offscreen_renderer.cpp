@@ -0,0 +1,100 @@
+#include <fuji/core/offscreen_renderer.hpp>
+
+#include <stdexcept>
+
+namespace {
+    constexpr vk::DeviceSize regionAlignment = 16;
+
+    vk::DeviceSize alignUp(vk::DeviceSize value, vk::DeviceSize alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+fuji::OffscreenRenderer::OffscreenRenderer(const vk::PhysicalDevice& physicalDevice, Instance& instance, const vk::Queue& queue)
+        : instance(instance), queue(queue), readbackBufferPool(physicalDevice, instance.getFrameRing().getDevice()) {
+    if(instance.getFinalLayout() != vk::ImageLayout::eTransferSrcOptimal) {
+        throw std::invalid_argument("OffscreenRenderer requires an Instance whose final layout is eTransferSrcOptimal");
+    }
+}
+
+fuji::OffscreenRenderer::~OffscreenRenderer() {
+    try {
+        this->instance.getFrameRing().waitIdle();
+    } catch(...) {
+    }
+}
+
+std::uint64_t fuji::OffscreenRenderer::submit(const std::vector<OffscreenTarget*>& targets, const Draw& draw) {
+    PendingBatch batch {};
+    vk::DeviceSize totalSize = 0;
+    for(auto target : targets) {
+        batch.regions.push_back(Region { totalSize, target->getExtent() });
+        totalSize = alignUp(totalSize + target->getByteSize(), regionAlignment);
+    }
+    batch.readbackBuffer = this->readbackBufferPool.acquire(totalSize);
+
+    core::utility::FrameSlot& slot = this->instance.beginFrame();
+    vk::CommandBuffer& commandBuffer = slot.commandBuffer.get();
+    for(std::size_t i = 0; i < targets.size(); i++) {
+        this->instance.draw(commandBuffer, targets[i]->getFramebuffer(), targets[i]->getExtent(), [&draw, i](vk::CommandBuffer& commandBuffer) {
+            if(draw) {
+                draw(commandBuffer, i);
+            }
+        });
+    }
+
+    for(std::size_t i = 0; i < targets.size(); i++) {
+        vk::BufferImageCopy region {};
+        region.bufferOffset = batch.regions[i].offset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = vk::Offset3D { 0, 0, 0 };
+        region.imageExtent = vk::Extent3D { batch.regions[i].extent.width, batch.regions[i].extent.height, 1 };
+        commandBuffer.copyImageToBuffer(targets[i]->getImage(), vk::ImageLayout::eTransferSrcOptimal, batch.readbackBuffer->buffer.get(), { region });
+    }
+
+    vk::MemoryBarrier readbackBarrier {
+        vk::AccessFlagBits::eTransferWrite,
+        vk::AccessFlagBits::eHostRead
+    };
+    commandBuffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTransfer,
+        vk::PipelineStageFlagBits::eHost,
+        vk::DependencyFlags {},
+        { readbackBarrier }, {}, {});
+
+    this->instance.endFrame(this->queue);
+
+    std::uint64_t batchId = slot.frameNumber;
+    this->pendingBatches.emplace(batchId, std::move(batch));
+    return batchId;
+}
+
+bool fuji::OffscreenRenderer::isComplete(std::uint64_t batch) const {
+    return this->instance.getFrameRing().isComplete(batch);
+}
+
+void fuji::OffscreenRenderer::collect(std::uint64_t batch, const Consumer& consumer) {
+    auto it = this->pendingBatches.find(batch);
+    if(it == this->pendingBatches.end()) {
+        throw std::out_of_range("unknown offscreen batch");
+    }
+
+    this->instance.getFrameRing().wait(batch);
+    PendingBatch pendingBatch = std::move(it->second);
+    this->pendingBatches.erase(it);
+
+    this->readbackBufferPool.invalidate(*pendingBatch.readbackBuffer);
+    for(std::size_t i = 0; i < pendingBatch.regions.size(); i++) {
+        consumer(i, pendingBatch.readbackBuffer->mappedData + pendingBatch.regions[i].offset, pendingBatch.regions[i].extent);
+    }
+    this->readbackBufferPool.release(std::move(pendingBatch.readbackBuffer));
+}
+
+std::size_t fuji::OffscreenRenderer::getPendingBatchCount() const noexcept {
+    return this->pendingBatches.size();
+}
@@ -0,0 +1,86 @@
+#include <fuji/core/offscreen_target.hpp>
+
+#include <stdexcept>
+
+namespace {
+    std::uint32_t texelSizeOf(vk::Format format) {
+        switch(format) {
+            case vk::Format::eR8Unorm:
+                return 1;
+            case vk::Format::eR8G8Unorm:
+                return 2;
+            case vk::Format::eR8G8B8A8Unorm:
+            case vk::Format::eR8G8B8A8Srgb:
+            case vk::Format::eB8G8R8A8Unorm:
+            case vk::Format::eB8G8R8A8Srgb:
+                return 4;
+            case vk::Format::eR16G16B16A16Sfloat:
+                return 8;
+            case vk::Format::eR32G32B32A32Sfloat:
+                return 16;
+            default:
+                throw std::invalid_argument("unsupported OffscreenTarget format");
+        }
+    }
+}
+
+fuji::OffscreenTarget::OffscreenTarget(core::utility::MemoryAllocator& allocator, const vk::RenderPass& renderPass, vk::Format format, vk::Extent2D extent)
+        : format(format), extent(extent), texelSize(texelSizeOf(format)) {
+    vk::ImageCreateInfo imageInfo {};
+    imageInfo.imageType = vk::ImageType::e2D;
+    imageInfo.format = format;
+    imageInfo.extent = vk::Extent3D { extent.width, extent.height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = vk::SampleCountFlagBits::e1;
+    imageInfo.tiling = vk::ImageTiling::eOptimal;
+    imageInfo.usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc;
+    imageInfo.sharingMode = vk::SharingMode::eExclusive;
+    imageInfo.initialLayout = vk::ImageLayout::eUndefined;
+    this->image = allocator.createImage(imageInfo, vk::MemoryPropertyFlags {}, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+    const vk::Device& device = allocator.getDevice();
+    vk::ImageViewCreateInfo viewInfo {};
+    viewInfo.image = this->image.image.get();
+    viewInfo.viewType = vk::ImageViewType::e2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+    this->imageView = device.createImageViewUnique(viewInfo);
+
+    vk::FramebufferCreateInfo framebufferInfo {};
+    framebufferInfo.renderPass = renderPass;
+    framebufferInfo.attachmentCount = 1;
+    framebufferInfo.pAttachments = &this->imageView.get();
+    framebufferInfo.width = extent.width;
+    framebufferInfo.height = extent.height;
+    framebufferInfo.layers = 1;
+    this->framebuffer = device.createFramebufferUnique(framebufferInfo);
+}
+
+const vk::Image& fuji::OffscreenTarget::getImage() const {
+    return this->image.image.get();
+}
+
+vk::UniqueFramebuffer& fuji::OffscreenTarget::getFramebuffer() noexcept {
+    return this->framebuffer;
+}
+
+vk::Format fuji::OffscreenTarget::getFormat() const noexcept {
+    return this->format;
+}
+
+vk::Extent2D fuji::OffscreenTarget::getExtent() const noexcept {
+    return this->extent;
+}
+
+std::uint32_t fuji::OffscreenTarget::getTexelSize() const noexcept {
+    return this->texelSize;
+}
+
+vk::DeviceSize fuji::OffscreenTarget::getByteSize() const noexcept {
+    return static_cast<vk::DeviceSize>(this->extent.width) * this->extent.height * this->texelSize;
+}
@@ -0,0 +1,488 @@
+#include <fuji/text/font_face.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    using fuji::text::utility::makeTag;
+    using fuji::text::utility::SfntReader;
+
+    constexpr std::uint32_t collectionTag = makeTag('t', 't', 'c', 'f');
+    constexpr std::uint32_t maxCompositeDepth = 8;
+
+    enum SimpleGlyphFlag : std::uint8_t {
+        eOnCurve = 0x01,
+        eXShort = 0x02,
+        eYShort = 0x04,
+        eRepeat = 0x08,
+        eXSameOrPositive = 0x10,
+        eYSameOrPositive = 0x20
+    };
+
+    enum CompositeGlyphFlag : std::uint16_t {
+        eArgsAreWords = 0x0001,
+        eArgsAreXYValues = 0x0002,
+        eHaveScale = 0x0008,
+        eMoreComponents = 0x0020,
+        eHaveXYScale = 0x0040,
+        eHaveTwoByTwo = 0x0080
+    };
+
+    bool isSupportedVersion(std::uint32_t version) noexcept {
+        return version == 0x00010000 || version == makeTag('O', 'T', 'T', 'O') || version == makeTag('t', 'r', 'u', 'e');
+    }
+
+    std::size_t getFaceOffset(const SfntReader& data, std::uint32_t faceIndex) {
+        if(data.readU32(0) != collectionTag) {
+            if(faceIndex != 0) {
+                throw std::invalid_argument("font file contains a single face");
+            }
+            return 0;
+        }
+        std::uint32_t faceCount = data.readU32(8);
+        if(faceIndex >= faceCount) {
+            throw std::invalid_argument("font collection face index out of range");
+        }
+        return data.readU32(12 + static_cast<std::size_t>(faceIndex) * 4);
+    }
+
+    float toF2Dot14(std::int16_t value) noexcept {
+        return static_cast<float>(value) / 16384.0f;
+    }
+
+    fuji::text::OutlinePoint transformPoint(const float transform[6], float x, float y) noexcept {
+        return fuji::text::OutlinePoint {
+            transform[0] * x + transform[2] * y + transform[4],
+            transform[1] * x + transform[3] * y + transform[5]
+        };
+    }
+
+    fuji::text::OutlinePoint midpoint(const fuji::text::OutlinePoint& a, const fuji::text::OutlinePoint& b) noexcept {
+        return fuji::text::OutlinePoint { (a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f };
+    }
+
+    void appendContour(fuji::text::Outline& outline, const std::vector<fuji::text::OutlinePoint>& points, const std::vector<bool>& onCurve, std::size_t first, std::size_t last) {
+        std::size_t count = last - first + 1;
+        if(count < 2) {
+            return;
+        }
+
+        fuji::text::OutlinePoint start;
+        std::size_t begin = 0;
+        std::size_t end = count;
+        if(onCurve[first]) {
+            start = points[first];
+            begin = 1;
+        } else if(onCurve[last]) {
+            start = points[last];
+            end = count - 1;
+        } else {
+            start = midpoint(points[last], points[first]);
+        }
+        outline.moveTo(start.x, start.y);
+
+        std::optional<fuji::text::OutlinePoint> control;
+        for(std::size_t i = begin; i < end; i++) {
+            const fuji::text::OutlinePoint& point = points[first + i];
+            if(onCurve[first + i]) {
+                if(control) {
+                    outline.quadTo(control->x, control->y, point.x, point.y);
+                    control.reset();
+                } else {
+                    outline.lineTo(point.x, point.y);
+                }
+            } else {
+                if(control) {
+                    fuji::text::OutlinePoint middle = midpoint(*control, point);
+                    outline.quadTo(control->x, control->y, middle.x, middle.y);
+                }
+                control = point;
+            }
+        }
+        if(control) {
+            outline.quadTo(control->x, control->y, start.x, start.y);
+        } else {
+            outline.lineTo(start.x, start.y);
+        }
+        outline.close();
+    }
+}
+
+fuji::text::FontFace::FontFace(const std::filesystem::path& filePath, std::uint32_t faceIndex)
+        : FontFace(std::make_shared<const core::utility::MappedFile>(filePath), faceIndex) {
+}
+
+fuji::text::FontFace::FontFace(std::shared_ptr<const core::utility::MappedFile> file, std::uint32_t faceIndex)
+        : file(std::move(file)), faceIndex(faceIndex), metrics(), indexToLocFormat(0), horizontalMetricCount(0),
+          codepointMap([this](char32_t codepoint) { return this->lookupGlyphIndex(codepoint); }) {
+    this->data = SfntReader { this->file->getData(), this->file->getSize() };
+
+    std::size_t faceOffset = getFaceOffset(this->data, faceIndex);
+    if(!isSupportedVersion(this->data.readU32(faceOffset))) {
+        throw std::runtime_error("unsupported font format");
+    }
+    std::uint16_t tableCount = this->data.readU16(faceOffset + 4);
+    SfntReader directory = this->data.subspan(faceOffset + 12, static_cast<std::size_t>(tableCount) * 16);
+    this->tables.reserve(tableCount);
+    for(std::uint16_t i = 0; i < tableCount; i++) {
+        std::size_t record = static_cast<std::size_t>(i) * 16;
+        TableRecord table { directory.readU32(record), directory.readU32(record + 8), directory.readU32(record + 12) };
+        if(this->data.contains(table.offset, table.length)) {
+            this->tables.push_back(table);
+        }
+    }
+    std::sort(this->tables.begin(), this->tables.end(), [](auto& a, auto& b) { return a.tag < b.tag; });
+
+    auto head = this->getTable(makeTag('h', 'e', 'a', 'd'));
+    auto hhea = this->getTable(makeTag('h', 'h', 'e', 'a'));
+    auto maxp = this->getTable(makeTag('m', 'a', 'x', 'p'));
+    if(!head || !hhea || !maxp) {
+        throw std::runtime_error("font is missing a required head, hhea or maxp table");
+    }
+    this->metrics.unitsPerEm = head->readU16(18);
+    this->indexToLocFormat = head->readI16(50);
+    this->metrics.ascender = hhea->readI16(4);
+    this->metrics.descender = hhea->readI16(6);
+    this->metrics.lineGap = hhea->readI16(8);
+    this->horizontalMetricCount = hhea->readU16(34);
+    this->metrics.glyphCount = maxp->readU16(4);
+}
+
+std::uint32_t fuji::text::FontFace::getFaceCount(const core::utility::MappedFile& file) {
+    SfntReader data { file.getData(), file.getSize() };
+    return data.readU32(0) == collectionTag ? data.readU32(8) : 1;
+}
+
+std::uint32_t fuji::text::FontFace::getFaceIndex() const noexcept {
+    return this->faceIndex;
+}
+
+const fuji::text::FontMetrics& fuji::text::FontFace::getMetrics() const noexcept {
+    return this->metrics;
+}
+
+bool fuji::text::FontFace::hasTable(std::uint32_t tag) const noexcept {
+    return std::binary_search(this->tables.begin(), this->tables.end(), TableRecord { tag, 0, 0 }, [](auto& a, auto& b) { return a.tag < b.tag; });
+}
+
+std::optional<fuji::text::utility::SfntReader> fuji::text::FontFace::getTable(std::uint32_t tag) const {
+    auto table = std::lower_bound(this->tables.begin(), this->tables.end(), tag, [](const TableRecord& record, std::uint32_t tag) { return record.tag < tag; });
+    if(table == this->tables.end() || table->tag != tag) {
+        return std::nullopt;
+    }
+    return this->data.subspan(table->offset, table->length);
+}
+
+std::uint32_t fuji::text::FontFace::getGlyphIndex(char32_t codepoint) const {
+    return this->codepointMap.find(codepoint);
+}
+
+void fuji::text::FontFace::getGlyphIndices(const char32_t* codepoints, std::size_t count, std::uint32_t* glyphIndices) const {
+    this->codepointMap.find(codepoints, count, glyphIndices);
+}
+
+std::vector<std::uint32_t> fuji::text::FontFace::getGlyphIndices(std::u32string_view text) const {
+    std::vector<std::uint32_t> glyphIndices(text.size());
+    this->codepointMap.find(text.data(), text.size(), glyphIndices.data());
+    return glyphIndices;
+}
+
+std::uint32_t fuji::text::FontFace::lookupGlyphIndex(char32_t codepoint) const {
+    std::call_once(this->characterMapOnce, [this] { this->loadCharacterMap(); });
+    if(!this->characterMap) {
+        return 0;
+    }
+
+    const SfntReader& subtable = this->characterMap->subtable;
+    std::uint32_t code = static_cast<std::uint32_t>(codepoint);
+    if(this->characterMap->format == 12) {
+        std::uint32_t groupCount = subtable.readU32(12);
+        std::uint32_t low = 0;
+        std::uint32_t high = groupCount;
+        while(low < high) {
+            std::uint32_t middle = (low + high) / 2;
+            std::size_t group = 16 + static_cast<std::size_t>(middle) * 12;
+            std::uint32_t startCode = subtable.readU32(group);
+            std::uint32_t endCode = subtable.readU32(group + 4);
+            if(code < startCode) {
+                high = middle;
+            } else if(code > endCode) {
+                low = middle + 1;
+            } else {
+                return subtable.readU32(group + 8) + (code - startCode);
+            }
+        }
+        return 0;
+    }
+
+    if(code > 0xFFFF) {
+        return 0;
+    }
+    std::size_t segmentCount = subtable.readU16(6) / 2;
+    std::size_t endCodes = 14;
+    std::size_t startCodes = endCodes + segmentCount * 2 + 2;
+    std::size_t idDeltas = startCodes + segmentCount * 2;
+    std::size_t idRangeOffsets = idDeltas + segmentCount * 2;
+    std::size_t low = 0;
+    std::size_t high = segmentCount;
+    while(low < high) {
+        std::size_t middle = (low + high) / 2;
+        if(subtable.readU16(endCodes + middle * 2) < code) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if(low == segmentCount) {
+        return 0;
+    }
+    std::uint16_t startCode = subtable.readU16(startCodes + low * 2);
+    if(code < startCode) {
+        return 0;
+    }
+    std::uint16_t idDelta = subtable.readU16(idDeltas + low * 2);
+    std::size_t idRangeOffsetPosition = idRangeOffsets + low * 2;
+    std::uint16_t idRangeOffset = subtable.readU16(idRangeOffsetPosition);
+    if(idRangeOffset == 0) {
+        return static_cast<std::uint16_t>(code + idDelta);
+    }
+    std::uint16_t glyph = subtable.readU16(idRangeOffsetPosition + idRangeOffset + (code - startCode) * 2);
+    return glyph == 0 ? 0 : static_cast<std::uint16_t>(glyph + idDelta);
+}
+
+fuji::text::GlyphMetrics fuji::text::FontFace::getGlyphMetrics(std::uint32_t glyphIndex) const {
+    auto hmtx = this->getTable(makeTag('h', 'm', 't', 'x'));
+    if(!hmtx || this->horizontalMetricCount == 0 || glyphIndex >= this->metrics.glyphCount) {
+        return GlyphMetrics { 0, 0 };
+    }
+    if(glyphIndex < this->horizontalMetricCount) {
+        std::size_t record = static_cast<std::size_t>(glyphIndex) * 4;
+        return GlyphMetrics { hmtx->readU16(record), hmtx->readI16(record + 2) };
+    }
+    std::size_t lastRecord = static_cast<std::size_t>(this->horizontalMetricCount - 1) * 4;
+    std::size_t bearing = static_cast<std::size_t>(this->horizontalMetricCount) * 4 + static_cast<std::size_t>(glyphIndex - this->horizontalMetricCount) * 2;
+    return GlyphMetrics { hmtx->readU16(lastRecord), hmtx->readI16(bearing) };
+}
+
+const fuji::text::utility::PairAdjustmentTable& fuji::text::FontFace::getPairAdjustments() const {
+    std::call_once(this->pairAdjustmentsOnce, [this] { this->loadPairAdjustments(); });
+    return this->pairAdjustments;
+}
+
+void fuji::text::FontFace::getKerning(const std::uint32_t* glyphIndices, std::size_t count, std::int32_t* adjustments) const {
+    this->getPairAdjustments().apply(glyphIndices, count, adjustments);
+}
+
+fuji::text::Outline fuji::text::FontFace::getOutline(std::uint32_t glyphIndex) const {
+    std::call_once(this->glyphDataOnce, [this] { this->loadGlyphData(); });
+    if(!this->glyphData) {
+        throw std::runtime_error("font has no TrueType glyph outlines");
+    }
+    const float identity[6] { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+    Outline outline;
+    this->appendOutline(outline, glyphIndex, identity, 0);
+    return outline;
+}
+
+void fuji::text::FontFace::loadCharacterMap() const {
+    auto cmap = this->getTable(makeTag('c', 'm', 'a', 'p'));
+    if(!cmap) {
+        return;
+    }
+
+    std::uint16_t subtableCount = cmap->readU16(2);
+    int bestRank = 0;
+    for(std::uint16_t i = 0; i < subtableCount; i++) {
+        std::size_t record = 4 + static_cast<std::size_t>(i) * 8;
+        std::uint16_t platformId = cmap->readU16(record);
+        std::uint16_t encodingId = cmap->readU16(record + 2);
+        SfntReader subtable = cmap->subspan(cmap->readU32(record + 4));
+        std::uint16_t format = subtable.readU16(0);
+
+        int rank = 0;
+        if(format == 12 && (platformId == 0 || (platformId == 3 && encodingId == 10))) {
+            rank = 2;
+        } else if(format == 4 && (platformId == 0 || (platformId == 3 && (encodingId == 1 || encodingId == 0)))) {
+            rank = 1;
+        }
+        if(rank > bestRank) {
+            std::size_t length = format == 12 ? subtable.readU32(4) : subtable.readU16(2);
+            this->characterMap = CharacterMap { subtable.subspan(0, std::min(length, subtable.getSize())), format };
+            bestRank = rank;
+        }
+    }
+}
+
+void fuji::text::FontFace::loadGlyphData() const {
+    auto loca = this->getTable(makeTag('l', 'o', 'c', 'a'));
+    auto glyf = this->getTable(makeTag('g', 'l', 'y', 'f'));
+    if(loca && glyf) {
+        this->glyphData = GlyphData { *loca, *glyf };
+    }
+}
+
+void fuji::text::FontFace::loadPairAdjustments() const {
+    if(auto gpos = this->getTable(makeTag('G', 'P', 'O', 'S'))) {
+        try {
+            this->pairAdjustments = utility::PairAdjustmentTable::fromGpos(*gpos);
+        } catch(const std::runtime_error&) {
+            this->pairAdjustments = utility::PairAdjustmentTable {};
+        }
+        if(!this->pairAdjustments.empty()) {
+            return;
+        }
+    }
+    if(auto kern = this->getTable(makeTag('k', 'e', 'r', 'n'))) {
+        try {
+            this->pairAdjustments = utility::PairAdjustmentTable::fromKern(*kern);
+        } catch(const std::runtime_error&) {
+            this->pairAdjustments = utility::PairAdjustmentTable {};
+        }
+    }
+}
+
+fuji::text::utility::SfntReader fuji::text::FontFace::getGlyph(std::uint32_t glyphIndex) const {
+    if(glyphIndex >= this->metrics.glyphCount) {
+        throw std::out_of_range("glyph index out of range");
+    }
+    const SfntReader& loca = this->glyphData->loca;
+    std::size_t begin;
+    std::size_t end;
+    if(this->indexToLocFormat == 0) {
+        begin = static_cast<std::size_t>(loca.readU16(static_cast<std::size_t>(glyphIndex) * 2)) * 2;
+        end = static_cast<std::size_t>(loca.readU16(static_cast<std::size_t>(glyphIndex) * 2 + 2)) * 2;
+    } else {
+        begin = loca.readU32(static_cast<std::size_t>(glyphIndex) * 4);
+        end = loca.readU32(static_cast<std::size_t>(glyphIndex) * 4 + 4);
+    }
+    if(end <= begin) {
+        return SfntReader {};
+    }
+    return this->glyphData->glyf.subspan(begin, end - begin);
+}
+
+void fuji::text::FontFace::appendOutline(Outline& outline, std::uint32_t glyphIndex, const float transform[6], std::uint32_t depth) const {
+    SfntReader glyph = this->getGlyph(glyphIndex);
+    if(glyph.empty()) {
+        return;
+    }
+
+    std::int16_t contourCount = glyph.readI16(0);
+    if(contourCount < 0) {
+        if(depth >= maxCompositeDepth) {
+            throw std::runtime_error("composite glyph nesting is too deep");
+        }
+        std::size_t offset = 10;
+        std::uint16_t flags;
+        do {
+            flags = glyph.readU16(offset);
+            std::uint16_t componentIndex = glyph.readU16(offset + 2);
+            offset += 4;
+
+            float dx = 0.0f;
+            float dy = 0.0f;
+            if(flags & eArgsAreWords) {
+                if(flags & eArgsAreXYValues) {
+                    dx = glyph.readI16(offset);
+                    dy = glyph.readI16(offset + 2);
+                }
+                offset += 4;
+            } else {
+                if(flags & eArgsAreXYValues) {
+                    dx = glyph.readI8(offset);
+                    dy = glyph.readI8(offset + 1);
+                }
+                offset += 2;
+            }
+
+            float matrix[4] { 1.0f, 0.0f, 0.0f, 1.0f };
+            if(flags & eHaveScale) {
+                matrix[0] = matrix[3] = toF2Dot14(glyph.readI16(offset));
+                offset += 2;
+            } else if(flags & eHaveXYScale) {
+                matrix[0] = toF2Dot14(glyph.readI16(offset));
+                matrix[3] = toF2Dot14(glyph.readI16(offset + 2));
+                offset += 4;
+            } else if(flags & eHaveTwoByTwo) {
+                matrix[0] = toF2Dot14(glyph.readI16(offset));
+                matrix[1] = toF2Dot14(glyph.readI16(offset + 2));
+                matrix[2] = toF2Dot14(glyph.readI16(offset + 4));
+                matrix[3] = toF2Dot14(glyph.readI16(offset + 6));
+                offset += 8;
+            }
+
+            OutlinePoint origin = transformPoint(transform, dx, dy);
+            const float componentTransform[6] {
+                transform[0] * matrix[0] + transform[2] * matrix[1],
+                transform[1] * matrix[0] + transform[3] * matrix[1],
+                transform[0] * matrix[2] + transform[2] * matrix[3],
+                transform[1] * matrix[2] + transform[3] * matrix[3],
+                origin.x,
+                origin.y
+            };
+            this->appendOutline(outline, componentIndex, componentTransform, depth + 1);
+        } while(flags & eMoreComponents);
+        return;
+    }
+
+    std::vector<std::uint16_t> endPoints(contourCount);
+    for(std::int16_t i = 0; i < contourCount; i++) {
+        endPoints[i] = glyph.readU16(10 + static_cast<std::size_t>(i) * 2);
+    }
+    if(contourCount == 0) {
+        return;
+    }
+    std::size_t pointCount = static_cast<std::size_t>(endPoints.back()) + 1;
+    std::size_t instructionLength = glyph.readU16(10 + static_cast<std::size_t>(contourCount) * 2);
+    std::size_t offset = 12 + static_cast<std::size_t>(contourCount) * 2 + instructionLength;
+
+    std::vector<std::uint8_t> flags;
+    flags.reserve(pointCount);
+    while(flags.size() < pointCount) {
+        std::uint8_t flag = glyph.readU8(offset++);
+        flags.push_back(flag);
+        if(flag & eRepeat) {
+            std::uint8_t repeatCount = glyph.readU8(offset++);
+            for(std::uint8_t i = 0; i < repeatCount && flags.size() < pointCount; i++) {
+                flags.push_back(flag);
+            }
+        }
+    }
+
+    std::vector<std::int32_t> xs(pointCount);
+    std::int32_t x = 0;
+    for(std::size_t i = 0; i < pointCount; i++) {
+        if(flags[i] & eXShort) {
+            std::int32_t delta = glyph.readU8(offset++);
+            x += (flags[i] & eXSameOrPositive) ? delta : -delta;
+        } else if(!(flags[i] & eXSameOrPositive)) {
+            x += glyph.readI16(offset);
+            offset += 2;
+        }
+        xs[i] = x;
+    }
+
+    std::vector<OutlinePoint> points(pointCount);
+    std::vector<bool> onCurve(pointCount);
+    std::int32_t y = 0;
+    for(std::size_t i = 0; i < pointCount; i++) {
+        if(flags[i] & eYShort) {
+            std::int32_t delta = glyph.readU8(offset++);
+            y += (flags[i] & eYSameOrPositive) ? delta : -delta;
+        } else if(!(flags[i] & eYSameOrPositive)) {
+            y += glyph.readI16(offset);
+            offset += 2;
+        }
+        points[i] = transformPoint(transform, static_cast<float>(xs[i]), static_cast<float>(y));
+        onCurve[i] = (flags[i] & eOnCurve) != 0;
+    }
+
+    std::size_t first = 0;
+    for(std::uint16_t endPoint : endPoints) {
+        if(endPoint < first || endPoint >= pointCount) {
+            throw std::runtime_error("glyph contour end points are malformed");
+        }
+        appendContour(outline, points, onCurve, first, endPoint);
+        first = static_cast<std::size_t>(endPoint) + 1;
+    }
+}
@@ -0,0 +1,96 @@
+#include <fuji/text/glyph_atlas.hpp>
+
+fuji::text::GlyphAtlas::GlyphAtlas(core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, std::uint32_t width, std::uint32_t height, std::uint32_t padding)
+        : uploadScheduler(uploadScheduler), width(width), height(height),
+          layout(vk::ImageLayout::eUndefined), packer(width, height), staging(padding) {
+    std::vector<std::uint32_t> queueFamilyIndices = uploadScheduler.getQueueFamilyIndices();
+    this->sharingMode = queueFamilyIndices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+
+    vk::ImageCreateInfo imageInfo {};
+    imageInfo.imageType = vk::ImageType::e2D;
+    imageInfo.extent = vk::Extent3D { width, height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = format;
+    imageInfo.tiling = vk::ImageTiling::eOptimal;
+    imageInfo.initialLayout = vk::ImageLayout::eUndefined;
+    imageInfo.usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eSampled;
+    imageInfo.sharingMode = this->sharingMode;
+    if(this->sharingMode == vk::SharingMode::eConcurrent) {
+        imageInfo.queueFamilyIndexCount = static_cast<std::uint32_t>(queueFamilyIndices.size());
+        imageInfo.pQueueFamilyIndices = queueFamilyIndices.data();
+    }
+    imageInfo.samples = vk::SampleCountFlagBits::e1;
+    this->image = allocator.createImage(imageInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+    vk::ImageViewCreateInfo viewInfo {};
+    viewInfo.image = this->image.image.get();
+    viewInfo.viewType = vk::ImageViewType::e2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+    this->imageView = allocator.getDevice().createImageViewUnique(viewInfo);
+}
+
+std::optional<fuji::text::AtlasRegion> fuji::text::GlyphAtlas::add(const std::uint8_t* coverage, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch) {
+    std::uint32_t padding = this->staging.getPadding();
+    auto rect = this->packer.pack(width + padding * 2, height + padding * 2);
+    if(!rect) {
+        return std::nullopt;
+    }
+    this->staging.stage(0, *rect, coverage, rowPitch);
+    return GlyphAtlas::getRegion(*rect, padding, this->getExtent());
+}
+
+bool fuji::text::GlyphAtlas::commit() {
+    if(!this->staging.upload(this->uploadScheduler, this->image.image.get(), this->layout, vk::ImageLayout::eShaderReadOnlyOptimal, this->sharingMode)) {
+        return false;
+    }
+    this->layout = vk::ImageLayout::eShaderReadOnlyOptimal;
+    return true;
+}
+
+void fuji::text::GlyphAtlas::clear() {
+    this->packer.reset();
+    this->staging.clear();
+}
+
+const vk::Image& fuji::text::GlyphAtlas::getImage() const {
+    return this->image.image.get();
+}
+
+const vk::ImageView& fuji::text::GlyphAtlas::getImageView() const {
+    return this->imageView.get();
+}
+
+vk::Extent2D fuji::text::GlyphAtlas::getExtent() const noexcept {
+    return vk::Extent2D { this->width, this->height };
+}
+
+std::size_t fuji::text::GlyphAtlas::getPendingRegionCount() const noexcept {
+    return this->staging.getPendingRegionCount();
+}
+
+vk::DeviceSize fuji::text::GlyphAtlas::getPendingUploadSize() const noexcept {
+    return this->staging.getPendingUploadSize();
+}
+
+float fuji::text::GlyphAtlas::getOccupancy() const noexcept {
+    return this->packer.getOccupancy();
+}
+
+fuji::text::AtlasRegion fuji::text::GlyphAtlas::getRegion(const utility::PackedRect& rect, std::uint32_t padding, vk::Extent2D extent) noexcept {
+    AtlasRegion region {};
+    region.x = rect.x + padding;
+    region.y = rect.y + padding;
+    region.width = rect.width - padding * 2;
+    region.height = rect.height - padding * 2;
+    region.u0 = static_cast<float>(region.x) / extent.width;
+    region.v0 = static_cast<float>(region.y) / extent.height;
+    region.u1 = static_cast<float>(region.x + region.width) / extent.width;
+    region.v1 = static_cast<float>(region.y + region.height) / extent.height;
+    return region;
+}
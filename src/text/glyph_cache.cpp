@@ -0,0 +1,154 @@
+#include <fuji/text/glyph_cache.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    std::uint32_t getMaxPageCount(const vk::PhysicalDeviceLimits& limits, vk::DeviceSize memoryBudget, std::uint32_t pageSize) {
+        if(pageSize == 0 || pageSize > limits.maxImageDimension2D) {
+            throw std::invalid_argument("GlyphCache page size exceeds maxImageDimension2D");
+        }
+        vk::DeviceSize pageBytes = static_cast<vk::DeviceSize>(pageSize) * pageSize;
+        return static_cast<std::uint32_t>(std::clamp<vk::DeviceSize>(memoryBudget / pageBytes, 1, limits.maxImageArrayLayers));
+    }
+}
+
+fuji::text::GlyphCache::GlyphCache(const vk::PhysicalDevice& physicalDevice, core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, vk::DeviceSize memoryBudget, std::uint32_t pageSize, std::uint32_t padding)
+        : uploadScheduler(uploadScheduler), pageSize(pageSize), layout(vk::ImageLayout::eUndefined),
+          frameNumber(1), completedFrameNumber(0), index(pageSize, pageSize, ::getMaxPageCount(physicalDevice.getProperties().limits, memoryBudget, pageSize)),
+          staging(padding) {
+    std::vector<std::uint32_t> queueFamilyIndices = uploadScheduler.getQueueFamilyIndices();
+    this->sharingMode = queueFamilyIndices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+
+    vk::ImageCreateInfo imageInfo {};
+    imageInfo.imageType = vk::ImageType::e2D;
+    imageInfo.extent = vk::Extent3D { pageSize, pageSize, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = this->index.getMaxPageCount();
+    imageInfo.format = format;
+    imageInfo.tiling = vk::ImageTiling::eOptimal;
+    imageInfo.initialLayout = vk::ImageLayout::eUndefined;
+    imageInfo.usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled;
+    imageInfo.sharingMode = this->sharingMode;
+    if(this->sharingMode == vk::SharingMode::eConcurrent) {
+        imageInfo.queueFamilyIndexCount = static_cast<std::uint32_t>(queueFamilyIndices.size());
+        imageInfo.pQueueFamilyIndices = queueFamilyIndices.data();
+    }
+    imageInfo.samples = vk::SampleCountFlagBits::e1;
+    this->image = allocator.createImage(imageInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+    vk::ImageViewCreateInfo viewInfo {};
+    viewInfo.image = this->image.image.get();
+    viewInfo.viewType = vk::ImageViewType::e2DArray;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = imageInfo.arrayLayers;
+    this->imageView = allocator.getDevice().createImageViewUnique(viewInfo);
+
+    viewInfo.viewType = vk::ImageViewType::e2D;
+    viewInfo.subresourceRange.layerCount = 1;
+    this->pageImageViews.reserve(imageInfo.arrayLayers);
+    for(std::uint32_t layer = 0; layer < imageInfo.arrayLayers; layer++) {
+        viewInfo.subresourceRange.baseArrayLayer = layer;
+        this->pageImageViews.push_back(allocator.getDevice().createImageViewUnique(viewInfo));
+    }
+
+    std::uint32_t placeholderSize = 1 + padding * 2;
+    auto placeholderEntry = this->index.reserve(placeholderSize, placeholderSize);
+    this->placeholder = this->toCachedGlyph(placeholderEntry);
+    this->staging.stage(placeholderEntry.page, placeholderEntry.rect, nullptr, 0);
+}
+
+void fuji::text::GlyphCache::beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber) noexcept {
+    this->frameNumber = frameNumber;
+    this->completedFrameNumber = completedFrameNumber;
+    this->evictedKeys.clear();
+}
+
+std::optional<fuji::text::CachedGlyph> fuji::text::GlyphCache::find(const GlyphKey& key) {
+    auto entry = this->index.find(key, this->frameNumber);
+    if(!entry) {
+        return std::nullopt;
+    }
+    return this->toCachedGlyph(*entry);
+}
+
+std::optional<fuji::text::CachedGlyph> fuji::text::GlyphCache::insert(const GlyphKey& key, const std::uint8_t* coverage, std::uint32_t width, std::uint32_t height, std::uint32_t rowPitch) {
+    if(auto entry = this->index.find(key, this->frameNumber)) {
+        return this->toCachedGlyph(*entry);
+    }
+    std::uint32_t padding = this->staging.getPadding();
+    auto insertion = this->index.insert(key, width + padding * 2, height + padding * 2, this->frameNumber, this->completedFrameNumber);
+    if(!insertion) {
+        return std::nullopt;
+    }
+    this->evictedKeys.insert(this->evictedKeys.end(), insertion->evictedKeys.begin(), insertion->evictedKeys.end());
+
+    this->staging.stage(insertion->entry.page, insertion->entry.rect, coverage, rowPitch);
+    return this->toCachedGlyph(insertion->entry);
+}
+
+bool fuji::text::GlyphCache::commit() {
+    if(!this->staging.upload(this->uploadScheduler, this->image.image.get(), this->layout, vk::ImageLayout::eGeneral, this->sharingMode)) {
+        return false;
+    }
+    this->layout = vk::ImageLayout::eGeneral;
+    return true;
+}
+
+bool fuji::text::GlyphCache::canFit(std::uint32_t width, std::uint32_t height) const noexcept {
+    std::uint32_t padding = this->staging.getPadding();
+    return this->index.canFit(width + padding * 2, height + padding * 2);
+}
+
+std::vector<fuji::text::GlyphKey> fuji::text::GlyphCache::takeEvictedKeys() {
+    return std::exchange(this->evictedKeys, {});
+}
+
+const fuji::text::CachedGlyph& fuji::text::GlyphCache::getPlaceholder() const noexcept {
+    return this->placeholder;
+}
+
+const vk::Image& fuji::text::GlyphCache::getImage() const {
+    return this->image.image.get();
+}
+
+const vk::ImageView& fuji::text::GlyphCache::getImageView() const {
+    return this->imageView.get();
+}
+
+std::vector<vk::ImageView> fuji::text::GlyphCache::getPageImageViews() const {
+    std::vector<vk::ImageView> imageViews;
+    imageViews.reserve(this->pageImageViews.size());
+    std::transform(this->pageImageViews.begin(), this->pageImageViews.end(), std::back_inserter(imageViews), [](auto& imageView) { return imageView.get(); });
+    return imageViews;
+}
+
+std::uint32_t fuji::text::GlyphCache::getPageSize() const noexcept {
+    return this->pageSize;
+}
+
+std::uint32_t fuji::text::GlyphCache::getPageCount() const noexcept {
+    return this->index.getPageCount();
+}
+
+std::uint32_t fuji::text::GlyphCache::getMaxPageCount() const noexcept {
+    return this->index.getMaxPageCount();
+}
+
+std::size_t fuji::text::GlyphCache::getGlyphCount() const noexcept {
+    return this->index.getGlyphCount();
+}
+
+std::uint64_t fuji::text::GlyphCache::getEvictionCount() const noexcept {
+    return this->index.getEvictionCount();
+}
+
+fuji::text::CachedGlyph fuji::text::GlyphCache::toCachedGlyph(const utility::PagedGlyphIndex::Entry& entry) const noexcept {
+    return CachedGlyph { entry.page, GlyphAtlas::getRegion(entry.rect, this->staging.getPadding(), vk::Extent2D { this->pageSize, this->pageSize }) };
+}
@@ -0,0 +1,218 @@
+#include <fuji/text/glyph_expander.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+#include <fuji/core/internal/utility/compute_pipeline_create_info_template.hpp>
+#include <fuji/core/internal/utility/shader_module.hpp>
+
+#include <fuji/shader/glyph_expand_comp.h>
+
+namespace {
+    constexpr std::uint32_t descriptorCount = 4;
+
+    template <std::size_t N>
+    vk::ArrayProxy<const std::uint32_t> asCode(const std::uint32_t (&code)[N]) {
+        return vk::ArrayProxy<const std::uint32_t> { static_cast<std::uint32_t>(N), code };
+    }
+
+    fuji::core::utility::AllocatedBuffer createDeviceBuffer(fuji::core::utility::MemoryAllocator& allocator, vk::DeviceSize size, vk::BufferUsageFlags usage) {
+        vk::BufferCreateInfo bufferInfo {};
+        bufferInfo.size = std::max<vk::DeviceSize>(size, 16);
+        bufferInfo.usage = usage;
+        bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+        return allocator.createBuffer(bufferInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
+    }
+}
+
+fuji::text::GlyphExpander::GlyphExpander(core::utility::MemoryAllocator& allocator, core::utility::UploadScheduler& uploadScheduler, std::uint32_t maxGlyphCount, std::uint32_t glyphTableSize)
+        : uploadScheduler(uploadScheduler), device(allocator.getDevice()), maxGlyphCount(maxGlyphCount), glyphCount(0),
+          glyphTable(glyphTableSize, GlyphInstance {}), dirtyBegin(glyphTableSize), dirtyEnd(0), uploadValue(0) {
+    this->placedGlyphBuffer = createDeviceBuffer(allocator, sizeof(PlacedGlyph) * static_cast<vk::DeviceSize>(maxGlyphCount),
+        vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst);
+    this->glyphTableBuffer = createDeviceBuffer(allocator, sizeof(GlyphInstance) * static_cast<vk::DeviceSize>(glyphTableSize),
+        vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst);
+    this->instanceBuffer = createDeviceBuffer(allocator, sizeof(GlyphInstance) * static_cast<vk::DeviceSize>(maxGlyphCount),
+        vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferSrc);
+    this->indirectBuffer = createDeviceBuffer(allocator, sizeof(vk::DrawIndirectCommand),
+        vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eTransferSrc);
+
+    std::array<vk::DescriptorSetLayoutBinding, descriptorCount> bindings {};
+    for(std::uint32_t i = 0; i < descriptorCount; i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = vk::DescriptorType::eStorageBuffer;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = vk::ShaderStageFlagBits::eCompute;
+    }
+    this->descriptorSetLayout = this->device.createDescriptorSetLayoutUnique(vk::DescriptorSetLayoutCreateInfo { {}, bindings });
+
+    vk::DescriptorPoolSize poolSize { vk::DescriptorType::eStorageBuffer, descriptorCount };
+    this->descriptorPool = this->device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo { {}, 1, poolSize });
+
+    vk::DescriptorSetAllocateInfo allocateInfo {};
+    allocateInfo.descriptorPool = this->descriptorPool.get();
+    allocateInfo.descriptorSetCount = 1;
+    allocateInfo.pSetLayouts = &this->descriptorSetLayout.get();
+    this->descriptorSet = this->device.allocateDescriptorSets(allocateInfo)[0];
+
+    std::array<vk::DescriptorBufferInfo, descriptorCount> bufferInfos {
+        vk::DescriptorBufferInfo { this->placedGlyphBuffer.buffer.get(), 0, VK_WHOLE_SIZE },
+        vk::DescriptorBufferInfo { this->glyphTableBuffer.buffer.get(), 0, VK_WHOLE_SIZE },
+        vk::DescriptorBufferInfo { this->instanceBuffer.buffer.get(), 0, VK_WHOLE_SIZE },
+        vk::DescriptorBufferInfo { this->indirectBuffer.buffer.get(), 0, VK_WHOLE_SIZE }
+    };
+    std::array<vk::WriteDescriptorSet, descriptorCount> writes {};
+    for(std::uint32_t i = 0; i < descriptorCount; i++) {
+        writes[i].dstSet = this->descriptorSet;
+        writes[i].dstBinding = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = vk::DescriptorType::eStorageBuffer;
+        writes[i].pBufferInfo = &bufferInfos[i];
+    }
+    this->device.updateDescriptorSets(writes, {});
+
+    vk::PushConstantRange pushConstantRange { vk::ShaderStageFlagBits::eCompute, 0, sizeof(GlyphExpandPushConstants) };
+    vk::PipelineLayoutCreateInfo pipelineLayoutInfo {};
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &this->descriptorSetLayout.get();
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    this->pipelineLayout = this->device.createPipelineLayoutUnique(pipelineLayoutInfo);
+
+    core::utility::ShaderModule shaderModule { this->device, asCode(glyph_expand_comp), vk::ShaderStageFlagBits::eCompute };
+    auto createInfoTemplate = std::make_unique<core::utility::ComputePipelineCreateInfoTemplate>(std::move(shaderModule), this->pipelineLayout.get());
+    this->pipeline = std::move(core::utility::ComputePipelineCreateInfoTemplate::createComputePipeline(this->device, createInfoTemplate)[0]);
+}
+
+void fuji::text::GlyphExpander::setPlacedGlyphs(const std::vector<PlacedGlyph>& placedGlyphs) {
+    if(placedGlyphs.size() > this->maxGlyphCount) {
+        throw std::invalid_argument("GlyphExpander glyph count exceeds its capacity");
+    }
+    this->glyphCount = static_cast<std::uint32_t>(placedGlyphs.size());
+    if(this->glyphCount > 0) {
+        this->uploadScheduler.uploadBuffer(this->placedGlyphBuffer.buffer.get(), 0, placedGlyphs.data(), sizeof(PlacedGlyph) * placedGlyphs.size(),
+            vk::SharingMode::eExclusive, vk::PipelineStageFlagBits::eComputeShader, vk::AccessFlagBits::eShaderRead);
+        this->uploadValue = this->uploadScheduler.getSubmittedValue() + 1;
+    }
+}
+
+void fuji::text::GlyphExpander::setGlyph(std::uint32_t glyphIndex, const GlyphInstance& glyph) {
+    this->glyphTable.at(glyphIndex) = glyph;
+    this->dirtyBegin = std::min(this->dirtyBegin, glyphIndex);
+    this->dirtyEnd = std::max(this->dirtyEnd, glyphIndex + 1);
+}
+
+void fuji::text::GlyphExpander::commit() {
+    if(this->dirtyBegin >= this->dirtyEnd) {
+        return;
+    }
+    this->uploadScheduler.uploadBuffer(this->glyphTableBuffer.buffer.get(), sizeof(GlyphInstance) * this->dirtyBegin,
+        this->glyphTable.data() + this->dirtyBegin, sizeof(GlyphInstance) * (this->dirtyEnd - this->dirtyBegin),
+        vk::SharingMode::eExclusive, vk::PipelineStageFlagBits::eComputeShader, vk::AccessFlagBits::eShaderRead);
+    this->uploadValue = this->uploadScheduler.getSubmittedValue() + 1;
+    this->dirtyBegin = static_cast<std::uint32_t>(this->glyphTable.size());
+    this->dirtyEnd = 0;
+}
+
+std::uint64_t fuji::text::GlyphExpander::record(vk::CommandBuffer& commandBuffer, vk::Extent2D viewport, glm::vec2 scale, glm::vec2 translation) const {
+    // the uploads are flushed by the next flush() after they were queued
+    if(this->uploadValue > this->uploadScheduler.getSubmittedValue()) {
+        throw std::logic_error("GlyphExpander uploads have to be flushed before record()");
+    }
+    std::uint64_t waitValue = std::max(this->uploadScheduler.recordAcquireBarriers(commandBuffer), this->uploadValue);
+
+    vk::MemoryBarrier readBarrier {
+        vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eVertexAttributeRead,
+        vk::AccessFlagBits::eTransferWrite | vk::AccessFlagBits::eShaderWrite
+    };
+    commandBuffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eVertexInput,
+        vk::PipelineStageFlagBits::eTransfer | vk::PipelineStageFlagBits::eComputeShader,
+        vk::DependencyFlags {},
+        { readBarrier }, {}, {});
+
+    vk::DrawIndirectCommand command { 4, 0, 0, 0 };
+    commandBuffer.updateBuffer(this->indirectBuffer.buffer.get(), 0, sizeof(command), &command);
+
+    vk::MemoryBarrier resetBarrier {
+        vk::AccessFlagBits::eTransferWrite,
+        vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite
+    };
+    commandBuffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eTransfer,
+        vk::PipelineStageFlagBits::eComputeShader,
+        vk::DependencyFlags {},
+        { resetBarrier }, {}, {});
+
+    if(this->glyphCount > 0) {
+        GlyphExpandPushConstants pushConstants {};
+        pushConstants.scale = scale;
+        pushConstants.translation = translation;
+        pushConstants.viewport = glm::vec2(static_cast<float>(viewport.width), static_cast<float>(viewport.height));
+        pushConstants.glyphCount = this->glyphCount;
+        pushConstants.glyphTableSize = static_cast<std::uint32_t>(this->glyphTable.size());
+
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, this->pipeline.get());
+        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, this->pipelineLayout.get(), 0, { this->descriptorSet }, {});
+        commandBuffer.pushConstants(this->pipelineLayout.get(), vk::ShaderStageFlagBits::eCompute, 0, sizeof(GlyphExpandPushConstants), &pushConstants);
+        commandBuffer.dispatch((this->glyphCount + workgroupSize - 1) / workgroupSize, 1, 1);
+    }
+
+    vk::MemoryBarrier expandBarrier {
+        vk::AccessFlagBits::eShaderWrite,
+        vk::AccessFlagBits::eIndirectCommandRead | vk::AccessFlagBits::eVertexAttributeRead
+    };
+    commandBuffer.pipelineBarrier(
+        vk::PipelineStageFlagBits::eComputeShader,
+        vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eVertexInput,
+        vk::DependencyFlags {},
+        { expandBarrier }, {}, {});
+    return waitValue;
+}
+
+void fuji::text::GlyphExpander::draw(vk::CommandBuffer& commandBuffer) const {
+    commandBuffer.bindVertexBuffers(0, { this->instanceBuffer.buffer.get() }, { vk::DeviceSize { 0 } });
+    commandBuffer.drawIndirect(this->indirectBuffer.buffer.get(), 0, 1, sizeof(vk::DrawIndirectCommand));
+}
+
+const vk::Buffer& fuji::text::GlyphExpander::getInstanceBuffer() const {
+    return this->instanceBuffer.buffer.get();
+}
+
+const vk::Buffer& fuji::text::GlyphExpander::getIndirectBuffer() const {
+    return this->indirectBuffer.buffer.get();
+}
+
+std::uint32_t fuji::text::GlyphExpander::getGlyphCount() const noexcept {
+    return this->glyphCount;
+}
+
+std::uint32_t fuji::text::GlyphExpander::getMaxGlyphCount() const noexcept {
+    return this->maxGlyphCount;
+}
+
+std::uint32_t fuji::text::GlyphExpander::getGlyphTableSize() const noexcept {
+    return static_cast<std::uint32_t>(this->glyphTable.size());
+}
+
+void fuji::text::GlyphExpander::appendPlacedGlyphs(const TextLayout& layout, float baseline, std::uint32_t colorIndex, std::vector<PlacedGlyph>& placedGlyphs) {
+    for(std::size_t index = 0; index < layout.getParagraphCount(); index++) {
+        const ParagraphLayout& paragraph = layout.getParagraph(index);
+        if(!paragraph.run) {
+            continue;
+        }
+        float y = layout.getParagraphTop(index) + baseline;
+        for(auto& line : paragraph.lines) {
+            float x = line.x;
+            for(std::uint32_t i = line.firstGlyph; i < line.firstGlyph + line.glyphCount; i++) {
+                const ShapedGlyph& glyph = paragraph.run->glyphs[i];
+                placedGlyphs.push_back(PlacedGlyph { glm::vec2(x + glyph.offsetX, y - glyph.offsetY), glyph.glyphIndex, colorIndex });
+                x += glyph.advance;
+            }
+            y += layout.getLineHeight();
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#include <fuji/text/glyph_rasterizer.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+fuji::text::GlyphRasterizer::GlyphRasterizer(GlyphCache& glyphCache, Rasterize rasterize, std::uint32_t threadCount, std::size_t batchSize)
+        : glyphCache(glyphCache), rasterize(std::move(rasterize)), batchSize(std::max<std::size_t>(1, batchSize)), threadPool(threadCount) {
+    if(!this->rasterize) {
+        throw std::invalid_argument("GlyphRasterizer requires a rasterize callback");
+    }
+}
+
+fuji::text::GlyphRasterizer::~GlyphRasterizer() {
+    try {
+        this->threadPool.wait();
+    } catch(...) {
+    }
+}
+
+void fuji::text::GlyphRasterizer::beginFrame(std::uint64_t frameNumber, std::uint64_t completedFrameNumber) {
+    this->glyphCache.beginFrame(frameNumber, completedFrameNumber);
+}
+
+fuji::text::GlyphLookup fuji::text::GlyphRasterizer::request(const GlyphKey& key) {
+    if(auto glyph = this->glyphCache.find(key)) {
+        auto bearing = this->bearings.find(key);
+        if(bearing != this->bearings.end()) {
+            return GlyphLookup { *glyph, bearing->second.left, bearing->second.top, true };
+        }
+        return GlyphLookup { *glyph, 0, 0, true };
+    }
+    if(this->failed.count(key) == 0 && this->inFlight.insert(key).second) {
+        this->batch.push_back(key);
+    }
+    return this->getPlaceholder();
+}
+
+void fuji::text::GlyphRasterizer::dispatch() {
+    if(this->batch.empty()) {
+        return;
+    }
+
+    std::vector<core::utility::WorkStealingThreadPool::Task> tasks;
+    for(std::size_t first = 0; first < this->batch.size(); first += this->batchSize) {
+        std::size_t last = std::min(first + this->batchSize, this->batch.size());
+        std::vector<GlyphKey> keys { this->batch.begin() + first, this->batch.begin() + last };
+        tasks.push_back([this, keys = std::move(keys)] { this->rasterizeBatch(keys); });
+    }
+    this->batch.clear();
+    this->threadPool.submit(std::move(tasks));
+}
+
+std::size_t fuji::text::GlyphRasterizer::upload(std::size_t byteBudget) {
+    {
+        std::lock_guard<std::mutex> lock { this->finishedMutex };
+        std::move(this->finished.begin(), this->finished.end(), std::back_inserter(this->ready));
+        this->finished.clear();
+    }
+
+    std::size_t uploadedCount = 0;
+    std::size_t uploadedBytes = 0;
+    while(!this->ready.empty()) {
+        Result& result = this->ready.front();
+        if(!result.bitmap) {
+            this->failed.insert(result.key);
+            this->inFlight.erase(result.key);
+            this->ready.pop_front();
+            continue;
+        }
+
+        // a glyph larger than a page would block every later result, so it fails instead of waiting for space
+        if(!this->glyphCache.canFit(result.bitmap->width, result.bitmap->height)) {
+            this->failed.insert(result.key);
+            this->inFlight.erase(result.key);
+            this->ready.pop_front();
+            continue;
+        }
+
+        std::size_t size = result.bitmap->pixels.size();
+        if(uploadedCount > 0 && uploadedBytes + size > byteBudget) {
+            break;
+        }
+        auto glyph = this->glyphCache.insert(result.key, result.bitmap->pixels.data(), result.bitmap->width, result.bitmap->height);
+        for(auto& evictedKey : this->glyphCache.takeEvictedKeys()) {
+            this->bearings.erase(evictedKey);
+        }
+        if(!glyph) {
+            break;
+        }
+        this->bearings[result.key] = Bearing { result.bitmap->left, result.bitmap->top };
+        this->inFlight.erase(result.key);
+        this->ready.pop_front();
+        uploadedCount++;
+        uploadedBytes += size;
+    }
+
+    this->glyphCache.commit();
+    return uploadedCount;
+}
+
+void fuji::text::GlyphRasterizer::wait() {
+    this->threadPool.wait();
+}
+
+std::uint32_t fuji::text::GlyphRasterizer::getThreadCount() const noexcept {
+    return this->threadPool.getWorkerCount();
+}
+
+std::size_t fuji::text::GlyphRasterizer::getInFlightCount() const noexcept {
+    return this->inFlight.size();
+}
+
+std::size_t fuji::text::GlyphRasterizer::getReadyCount() {
+    std::lock_guard<std::mutex> lock { this->finishedMutex };
+    return this->ready.size() + this->finished.size();
+}
+
+std::size_t fuji::text::GlyphRasterizer::getFailedCount() const noexcept {
+    return this->failed.size();
+}
+
+void fuji::text::GlyphRasterizer::rasterizeBatch(const std::vector<GlyphKey>& keys) {
+    std::vector<Result> results;
+    results.reserve(keys.size());
+    for(auto& key : keys) {
+        std::optional<GlyphBitmap> bitmap;
+        try {
+            bitmap = this->rasterize(key);
+        } catch(...) {
+            bitmap.reset();
+        }
+        if(bitmap && bitmap->pixels.size() != static_cast<std::size_t>(bitmap->width) * bitmap->height) {
+            bitmap.reset();
+        }
+        results.push_back(Result { key, std::move(bitmap) });
+    }
+
+    std::lock_guard<std::mutex> lock { this->finishedMutex };
+    std::move(results.begin(), results.end(), std::back_inserter(this->finished));
+}
+
+fuji::text::GlyphLookup fuji::text::GlyphRasterizer::getPlaceholder() const noexcept {
+    return GlyphLookup { this->glyphCache.getPlaceholder(), 0, 0, false };
+}
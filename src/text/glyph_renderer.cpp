@@ -0,0 +1,208 @@
+#include <fuji/text/glyph_renderer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fuji/core/internal/utility/graphics_pipeline_create_info_template.hpp>
+#include <fuji/core/internal/utility/shader_module.hpp>
+#include <fuji/core/internal/utility/shader_stage_flow.hpp>
+
+#include <fuji/shader/glyph_vert.h>
+#include <fuji/shader/glyph_frag.h>
+#include <fuji/shader/glyph_bindless_frag.h>
+
+namespace {
+    template <std::size_t N>
+    vk::ArrayProxy<const std::uint32_t> asCode(const std::uint32_t (&code)[N]) {
+        return vk::ArrayProxy<const std::uint32_t> { static_cast<std::uint32_t>(N), code };
+    }
+}
+
+fuji::text::GlyphRenderer::GlyphRenderer(const vk::Device& device, core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, std::uint32_t subpass)
+        : device(device), imageTable(nullptr) {
+    this->createSampler();
+
+    std::array<vk::DescriptorSetLayoutBinding, 2> bindings {};
+    bindings[0].binding = 0;
+    bindings[0].descriptorType = vk::DescriptorType::eCombinedImageSampler;
+    bindings[0].descriptorCount = 1;
+    bindings[0].stageFlags = vk::ShaderStageFlagBits::eFragment;
+    bindings[0].pImmutableSamplers = &this->sampler.get();
+    bindings[1].binding = 1;
+    bindings[1].descriptorType = vk::DescriptorType::eUniformBuffer;
+    bindings[1].descriptorCount = 1;
+    bindings[1].stageFlags = vk::ShaderStageFlagBits::eFragment;
+
+    vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutInfo {};
+    descriptorSetLayoutInfo.bindingCount = static_cast<std::uint32_t>(bindings.size());
+    descriptorSetLayoutInfo.pBindings = bindings.data();
+    this->descriptorSetLayout = this->device.createDescriptorSetLayoutUnique(descriptorSetLayoutInfo);
+
+    this->createPipeline(pipelineCache, renderPass, subpass, { this->descriptorSetLayout.get() }, asCode(glyph_frag));
+}
+
+fuji::text::GlyphRenderer::GlyphRenderer(const vk::Device& device, core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, const core::utility::BindlessImageTable& imageTable, std::uint32_t subpass)
+        : device(device), imageTable(&imageTable) {
+    this->createSampler();
+
+    std::array<vk::DescriptorSetLayoutBinding, 2> bindings {};
+    bindings[0].binding = 0;
+    bindings[0].descriptorType = vk::DescriptorType::eSampler;
+    bindings[0].descriptorCount = 1;
+    bindings[0].stageFlags = vk::ShaderStageFlagBits::eFragment;
+    bindings[0].pImmutableSamplers = &this->sampler.get();
+    bindings[1].binding = 1;
+    bindings[1].descriptorType = vk::DescriptorType::eUniformBuffer;
+    bindings[1].descriptorCount = 1;
+    bindings[1].stageFlags = vk::ShaderStageFlagBits::eFragment;
+
+    vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutInfo {};
+    descriptorSetLayoutInfo.bindingCount = static_cast<std::uint32_t>(bindings.size());
+    descriptorSetLayoutInfo.pBindings = bindings.data();
+    this->descriptorSetLayout = this->device.createDescriptorSetLayoutUnique(descriptorSetLayoutInfo);
+
+    this->createPipeline(pipelineCache, renderPass, subpass, { this->descriptorSetLayout.get(), imageTable.getDescriptorSetLayout() }, asCode(glyph_bindless_frag));
+}
+
+const vk::DescriptorSetLayout& fuji::text::GlyphRenderer::getDescriptorSetLayout() const {
+    return this->descriptorSetLayout.get();
+}
+
+const vk::PipelineLayout& fuji::text::GlyphRenderer::getPipelineLayout() const {
+    return this->pipelineLayout.get();
+}
+
+const vk::Pipeline& fuji::text::GlyphRenderer::getPipeline() const {
+    return this->pipeline.get();
+}
+
+bool fuji::text::GlyphRenderer::isBindless() const noexcept {
+    return this->imageTable != nullptr;
+}
+
+void fuji::text::GlyphRenderer::writeDescriptorSet(const vk::DescriptorSet& descriptorSet, const GlyphCache& glyphCache, const vk::Buffer& palette, vk::DeviceSize paletteOffset) const {
+    if(this->isBindless()) {
+        throw std::logic_error("a bindless GlyphRenderer samples pages from its BindlessImageTable");
+    }
+    vk::DescriptorImageInfo imageInfo {};
+    imageInfo.imageView = glyphCache.getImageView();
+    imageInfo.imageLayout = vk::ImageLayout::eGeneral;
+
+    vk::WriteDescriptorSet write {};
+    write.dstSet = descriptorSet;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = vk::DescriptorType::eCombinedImageSampler;
+    write.pImageInfo = &imageInfo;
+    this->device.updateDescriptorSets(write, {});
+    this->writeDescriptorSet(descriptorSet, palette, paletteOffset);
+}
+
+void fuji::text::GlyphRenderer::writeDescriptorSet(const vk::DescriptorSet& descriptorSet, const vk::Buffer& palette, vk::DeviceSize paletteOffset) const {
+    vk::DescriptorBufferInfo bufferInfo {};
+    bufferInfo.buffer = palette;
+    bufferInfo.offset = paletteOffset;
+    bufferInfo.range = paletteByteSize;
+
+    vk::WriteDescriptorSet write {};
+    write.dstSet = descriptorSet;
+    write.dstBinding = 1;
+    write.descriptorCount = 1;
+    write.descriptorType = vk::DescriptorType::eUniformBuffer;
+    write.pBufferInfo = &bufferInfo;
+    this->device.updateDescriptorSets(write, {});
+}
+
+void fuji::text::GlyphRenderer::bind(vk::CommandBuffer& commandBuffer, const vk::DescriptorSet& descriptorSet, vk::Extent2D extent, std::uint32_t atlasPageSize, glm::vec2 origin, glm::vec2 quadScale) const {
+    commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, this->pipeline.get());
+    commandBuffer.setViewport(0, { vk::Viewport { 0.0f, 0.0f, static_cast<float>(extent.width), static_cast<float>(extent.height), 0.0f, 1.0f } });
+    commandBuffer.setScissor(0, { vk::Rect2D { vk::Offset2D { 0, 0 }, extent } });
+    if(this->isBindless()) {
+        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, this->pipelineLayout.get(), 0, { descriptorSet, this->imageTable->getDescriptorSet() }, {});
+    } else {
+        commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, this->pipelineLayout.get(), 0, { descriptorSet }, {});
+    }
+
+    GlyphPushConstants pushConstants {};
+    pushConstants.viewportScale = glm::vec2(2.0f / static_cast<float>(extent.width), 2.0f / static_cast<float>(extent.height));
+    pushConstants.atlasScale = glm::vec2(1.0f / static_cast<float>(atlasPageSize));
+    pushConstants.origin = origin;
+    pushConstants.quadScale = quadScale;
+    commandBuffer.pushConstants(this->pipelineLayout.get(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(GlyphPushConstants), &pushConstants);
+}
+
+void fuji::text::GlyphRenderer::draw(vk::CommandBuffer& commandBuffer, const vk::Buffer& instanceBuffer, vk::DeviceSize offset, std::uint32_t glyphCount) const {
+    if(glyphCount == 0) {
+        return;
+    }
+    commandBuffer.bindVertexBuffers(0, { instanceBuffer }, { offset });
+    commandBuffer.draw(4, glyphCount, 0, 0);
+}
+
+fuji::text::GlyphInstance fuji::text::GlyphRenderer::createInstance(glm::vec2 pen, const GlyphLookup& lookup, std::uint16_t colorIndex, std::uint32_t firstPage) noexcept {
+    GlyphInstance instance {};
+    instance.position = glm::vec2(pen.x + static_cast<float>(lookup.left), pen.y - static_cast<float>(lookup.top));
+    instance.atlasRect = glm::u16vec4(lookup.glyph.region.x, lookup.glyph.region.y, lookup.glyph.region.width, lookup.glyph.region.height);
+    instance.layer = static_cast<std::uint16_t>(firstPage + lookup.glyph.layer);
+    instance.colorIndex = colorIndex;
+    return instance;
+}
+
+void fuji::text::GlyphRenderer::createSampler() {
+    vk::SamplerCreateInfo samplerInfo {};
+    samplerInfo.magFilter = vk::Filter::eLinear;
+    samplerInfo.minFilter = vk::Filter::eLinear;
+    samplerInfo.mipmapMode = vk::SamplerMipmapMode::eNearest;
+    samplerInfo.addressModeU = vk::SamplerAddressMode::eClampToEdge;
+    samplerInfo.addressModeV = vk::SamplerAddressMode::eClampToEdge;
+    samplerInfo.addressModeW = vk::SamplerAddressMode::eClampToEdge;
+    samplerInfo.maxAnisotropy = 1.0f;
+    samplerInfo.borderColor = vk::BorderColor::eFloatTransparentBlack;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+    this->sampler = this->device.createSamplerUnique(samplerInfo);
+}
+
+void fuji::text::GlyphRenderer::createPipeline(core::utility::PipelineCache& pipelineCache, const vk::RenderPass& renderPass, std::uint32_t subpass, vk::ArrayProxy<const vk::DescriptorSetLayout> setLayouts, vk::ArrayProxy<const std::uint32_t> fragmentCode) {
+    vk::PushConstantRange pushConstantRange {
+        vk::ShaderStageFlagBits::eVertex,
+        0,
+        sizeof(GlyphPushConstants)
+    };
+    vk::PipelineLayoutCreateInfo pipelineLayoutInfo {};
+    pipelineLayoutInfo.setLayoutCount = static_cast<std::uint32_t>(setLayouts.size());
+    pipelineLayoutInfo.pSetLayouts = setLayouts.data();
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    this->pipelineLayout = this->device.createPipelineLayoutUnique(pipelineLayoutInfo);
+
+    std::vector<core::utility::ShaderModule> shaderModules;
+    shaderModules.emplace_back(this->device, asCode(glyph_vert), vk::ShaderStageFlagBits::eVertex);
+    shaderModules.emplace_back(this->device, fragmentCode, vk::ShaderStageFlagBits::eFragment);
+    auto createInfoTemplate = std::make_unique<core::utility::GraphicsPipelineCreateInfoTemplate>(
+        std::make_unique<core::utility::ShaderStageFlow>(std::move(shaderModules), GlyphInputLayout {}));
+    createInfoTemplate->setPipelineLayout(this->pipelineLayout.get());
+    createInfoTemplate->setRenderPass(renderPass, subpass);
+    // each glyph is a 4-vertex strip blended over the target
+    createInfoTemplate->setPrimitiveTopology(vk::PrimitiveTopology::eTriangleStrip);
+
+    vk::PipelineColorBlendAttachmentState colorBlendAttachment {};
+    colorBlendAttachment.colorWriteMask =
+        vk::ColorComponentFlagBits::eR
+      | vk::ColorComponentFlagBits::eG
+      | vk::ColorComponentFlagBits::eB
+      | vk::ColorComponentFlagBits::eA;
+    colorBlendAttachment.blendEnable = VK_TRUE;
+    colorBlendAttachment.srcColorBlendFactor = vk::BlendFactor::eSrcAlpha;
+    colorBlendAttachment.dstColorBlendFactor = vk::BlendFactor::eOneMinusSrcAlpha;
+    colorBlendAttachment.colorBlendOp = vk::BlendOp::eAdd;
+    colorBlendAttachment.srcAlphaBlendFactor = vk::BlendFactor::eOne;
+    colorBlendAttachment.dstAlphaBlendFactor = vk::BlendFactor::eOneMinusSrcAlpha;
+    colorBlendAttachment.alphaBlendOp = vk::BlendOp::eAdd;
+    createInfoTemplate->setColorBlendAttachmentState(colorBlendAttachment);
+
+    this->pipeline = std::move(core::utility::GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(this->device, pipelineCache, createInfoTemplate)[0]);
+}
@@ -0,0 +1,65 @@
+#include <fuji/text/internal/utility/atlas_staging.hpp>
+
+#include <cstring>
+
+fuji::text::utility::AtlasStaging::AtlasStaging(std::uint32_t padding) noexcept
+        : padding(padding) {
+}
+
+void fuji::text::utility::AtlasStaging::stage(std::uint32_t layer, const PackedRect& rect, const std::uint8_t* coverage, std::uint32_t rowPitch) {
+    // the padding border is uploaded as zeros so neighbouring glyphs never bleed under linear filtering
+    std::uint32_t width = rect.width - this->padding * 2;
+    std::uint32_t height = rect.height - this->padding * 2;
+    if(rowPitch == 0) {
+        rowPitch = width;
+    }
+
+    vk::DeviceSize offset = this->pendingPixels.size();
+    this->pendingPixels.resize(offset + static_cast<vk::DeviceSize>(rect.width) * rect.height, 0);
+    for(std::uint32_t row = 0; coverage && row < height; row++) {
+        std::memcpy(
+            this->pendingPixels.data() + offset + static_cast<vk::DeviceSize>(row + this->padding) * rect.width + this->padding,
+            coverage + static_cast<std::size_t>(row) * rowPitch,
+            width);
+    }
+    this->dirtyRects.push_back(DirtyRect { layer, rect, offset });
+}
+
+bool fuji::text::utility::AtlasStaging::upload(core::utility::UploadScheduler& uploadScheduler, const vk::Image& image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, vk::SharingMode sharingMode) {
+    if(this->dirtyRects.empty()) {
+        return false;
+    }
+
+    std::vector<core::utility::ImageUploadRegion> regions;
+    regions.reserve(this->dirtyRects.size());
+    for(auto& dirtyRect : this->dirtyRects) {
+        core::utility::ImageUploadRegion region {};
+        region.data = this->pendingPixels.data() + dirtyRect.offset;
+        region.size = static_cast<vk::DeviceSize>(dirtyRect.rect.width) * dirtyRect.rect.height;
+        region.offset = vk::Offset3D { static_cast<std::int32_t>(dirtyRect.rect.x), static_cast<std::int32_t>(dirtyRect.rect.y), 0 };
+        region.extent = vk::Extent3D { dirtyRect.rect.width, dirtyRect.rect.height, 1 };
+        region.arrayLayer = dirtyRect.layer;
+        regions.push_back(region);
+    }
+    uploadScheduler.uploadImage(image, regions, oldLayout, newLayout, sharingMode);
+
+    this->clear();
+    return true;
+}
+
+void fuji::text::utility::AtlasStaging::clear() noexcept {
+    this->pendingPixels.clear();
+    this->dirtyRects.clear();
+}
+
+std::uint32_t fuji::text::utility::AtlasStaging::getPadding() const noexcept {
+    return this->padding;
+}
+
+std::size_t fuji::text::utility::AtlasStaging::getPendingRegionCount() const noexcept {
+    return this->dirtyRects.size();
+}
+
+vk::DeviceSize fuji::text::utility::AtlasStaging::getPendingUploadSize() const noexcept {
+    return this->pendingPixels.size();
+}
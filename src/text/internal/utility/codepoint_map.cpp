@@ -0,0 +1,88 @@
+#include <fuji/text/internal/utility/codepoint_map.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+fuji::text::utility::CodepointMap::CodepointMap(Resolve resolve)
+        : resolve(std::move(resolve)), emptyPage(), directory(new std::atomic<const Page*>[pageCount]), builtPageCount(0) {
+    if(!this->resolve) {
+        throw std::invalid_argument("CodepointMap requires a resolver");
+    }
+    for(std::uint32_t i = 0; i < pageCount; i++) {
+        this->directory[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+std::uint32_t fuji::text::utility::CodepointMap::find(char32_t codepoint) const {
+    std::uint32_t code = static_cast<std::uint32_t>(codepoint);
+    if(code >= pageCount * pageSize) {
+        return 0;
+    }
+    return this->getPage(code / pageSize).glyphIndices[code % pageSize];
+}
+
+void fuji::text::utility::CodepointMap::find(const char32_t* codepoints, std::size_t count, std::uint32_t* glyphIndices) const {
+    const std::uint16_t* latin = this->getPage(0).glyphIndices.data();
+    std::size_t i = 0;
+    while(i < count) {
+        std::size_t runEnd = i;
+        while(runEnd < count && static_cast<std::uint32_t>(codepoints[runEnd]) < pageSize) {
+            runEnd++;
+        }
+        for(std::size_t j = i; j < runEnd; j++) {
+            glyphIndices[j] = latin[codepoints[j]];
+        }
+        i = runEnd;
+
+        std::uint32_t lastPageIndex = pageCount;
+        const Page* page = nullptr;
+        for(; i < count && static_cast<std::uint32_t>(codepoints[i]) >= pageSize; i++) {
+            std::uint32_t code = static_cast<std::uint32_t>(codepoints[i]);
+            if(code >= pageCount * pageSize) {
+                glyphIndices[i] = 0;
+                continue;
+            }
+            if(code / pageSize != lastPageIndex) {
+                lastPageIndex = code / pageSize;
+                page = &this->getPage(lastPageIndex);
+            }
+            glyphIndices[i] = page->glyphIndices[code % pageSize];
+        }
+    }
+}
+
+std::size_t fuji::text::utility::CodepointMap::getBuiltPageCount() const {
+    std::lock_guard<std::mutex> lock { this->mutex };
+    return this->builtPageCount;
+}
+
+const fuji::text::utility::CodepointMap::Page& fuji::text::utility::CodepointMap::getPage(std::uint32_t pageIndex) const {
+    const Page* page = this->directory[pageIndex].load(std::memory_order_acquire);
+    if(page != nullptr) {
+        return *page;
+    }
+
+    std::lock_guard<std::mutex> lock { this->mutex };
+    page = this->directory[pageIndex].load(std::memory_order_relaxed);
+    if(page != nullptr) {
+        return *page;
+    }
+
+    auto built = std::make_unique<Page>();
+    char32_t first = static_cast<char32_t>(pageIndex * pageSize);
+    for(std::uint32_t i = 0; i < pageSize; i++) {
+        std::uint32_t glyphIndex = this->resolve(first + i);
+        built->glyphIndices[i] = glyphIndex <= 0xFFFF ? static_cast<std::uint16_t>(glyphIndex) : 0;
+    }
+    this->builtPageCount++;
+
+    bool empty = std::all_of(built->glyphIndices.begin(), built->glyphIndices.end(), [](std::uint16_t glyphIndex) { return glyphIndex == 0; });
+    if(empty) {
+        page = &this->emptyPage;
+    } else {
+        page = built.get();
+        this->pages.push_back(std::move(built));
+    }
+    this->directory[pageIndex].store(page, std::memory_order_release);
+    return *page;
+}
@@ -0,0 +1,96 @@
+#include <fuji/text/internal/utility/fenwick_tree.hpp>
+
+namespace {
+    std::size_t lowestBit(std::size_t value) noexcept {
+        return value & (~value + 1);
+    }
+}
+
+fuji::text::utility::FenwickTree::FenwickTree(const std::vector<std::int64_t>& values) : values(values) {
+    this->rebuild();
+}
+
+std::size_t fuji::text::utility::FenwickTree::size() const noexcept {
+    return this->values.size();
+}
+
+std::int64_t fuji::text::utility::FenwickTree::get(std::size_t index) const noexcept {
+    return this->values[index];
+}
+
+void fuji::text::utility::FenwickTree::set(std::size_t index, std::int64_t value) noexcept {
+    this->add(index, value - this->values[index]);
+}
+
+void fuji::text::utility::FenwickTree::add(std::size_t index, std::int64_t delta) noexcept {
+    this->values[index] += delta;
+    for(std::size_t i = index + 1; i <= this->tree.size(); i += lowestBit(i)) {
+        this->tree[i - 1] += delta;
+    }
+}
+
+void fuji::text::utility::FenwickTree::pushBack(std::int64_t value) {
+    std::size_t i = this->values.size() + 1;
+    this->values.push_back(value);
+    this->tree.push_back(value + this->prefixSum(i - 1) - this->prefixSum(i - lowestBit(i)));
+}
+
+void fuji::text::utility::FenwickTree::insert(std::size_t index, std::int64_t value) {
+    if(index == this->values.size()) {
+        this->pushBack(value);
+        return;
+    }
+    this->values.insert(this->values.begin() + index, value);
+    this->rebuild();
+}
+
+void fuji::text::utility::FenwickTree::erase(std::size_t index) {
+    this->values.erase(this->values.begin() + index);
+    if(index == this->values.size()) {
+        this->tree.pop_back();
+        return;
+    }
+    this->rebuild();
+}
+
+void fuji::text::utility::FenwickTree::clear() noexcept {
+    this->values.clear();
+    this->tree.clear();
+}
+
+std::int64_t fuji::text::utility::FenwickTree::prefixSum(std::size_t count) const noexcept {
+    std::int64_t sum = 0;
+    for(std::size_t i = count; i > 0; i -= lowestBit(i)) {
+        sum += this->tree[i - 1];
+    }
+    return sum;
+}
+
+std::int64_t fuji::text::utility::FenwickTree::total() const noexcept {
+    return this->prefixSum(this->tree.size());
+}
+
+std::size_t fuji::text::utility::FenwickTree::upperBound(std::int64_t position) const noexcept {
+    std::size_t step = 1;
+    while(step * 2 <= this->tree.size()) {
+        step *= 2;
+    }
+    std::size_t index = 0;
+    for(; step > 0; step /= 2) {
+        if(index + step <= this->tree.size() && this->tree[index + step - 1] <= position) {
+            index += step;
+            position -= this->tree[index - 1];
+        }
+    }
+    return index;
+}
+
+void fuji::text::utility::FenwickTree::rebuild() noexcept {
+    this->tree = this->values;
+    for(std::size_t i = 1; i <= this->tree.size(); i++) {
+        std::size_t parent = i + lowestBit(i);
+        if(parent <= this->tree.size()) {
+            this->tree[parent - 1] += this->tree[i - 1];
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#include <fuji/text/internal/utility/paged_glyph_index.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+fuji::text::utility::PagedGlyphIndex::PagedGlyphIndex(std::uint32_t pageWidth, std::uint32_t pageHeight, std::uint32_t maxPageCount)
+        : pageWidth(pageWidth), pageHeight(pageHeight), maxPageCount(maxPageCount), evictionCount(0) {
+
+}
+
+const fuji::text::utility::PagedGlyphIndex::Entry* fuji::text::utility::PagedGlyphIndex::find(const GlyphKey& key, std::uint64_t frameNumber) {
+    auto it = this->entries.find(key);
+    if(it == this->entries.end()) {
+        return nullptr;
+    }
+    it->second.lastUsedFrame = std::max(it->second.lastUsedFrame, frameNumber);
+    Page& page = this->pages[it->second.page];
+    page.lastUsedFrame = std::max(page.lastUsedFrame, frameNumber);
+    return &it->second;
+}
+
+fuji::text::utility::PagedGlyphIndex::Entry fuji::text::utility::PagedGlyphIndex::reserve(std::uint32_t width, std::uint32_t height) {
+    if(!this->pages.empty()) {
+        throw std::logic_error("PagedGlyphIndex can only reserve a region before the first insertion");
+    }
+    if(width == 0 || height == 0 || width > this->pageWidth || height > this->pageHeight) {
+        throw std::invalid_argument("PagedGlyphIndex reserved region does not fit in a page");
+    }
+    this->reservedRect = PackedRect { 0, 0, width, height };
+    this->createPage();
+    return Entry { 0, *this->reservedRect, 0 };
+}
+
+bool fuji::text::utility::PagedGlyphIndex::canFit(std::uint32_t width, std::uint32_t height) const noexcept {
+    if(width > this->pageWidth || height > this->pageHeight) {
+        return false;
+    }
+    return this->maxPageCount > 1 || this->fitsEmptyPage(0, width, height);
+}
+
+std::optional<fuji::text::utility::PagedGlyphIndex::Insertion> fuji::text::utility::PagedGlyphIndex::insert(const GlyphKey& key, std::uint32_t width, std::uint32_t height, std::uint64_t frameNumber, std::uint64_t completedFrameNumber) {
+    if(width > this->pageWidth || height > this->pageHeight) {
+        return std::nullopt;
+    }
+    if(auto entry = this->find(key, frameNumber)) {
+        return Insertion { *entry, std::nullopt, {} };
+    }
+
+    std::optional<std::uint32_t> evictedPage;
+    std::vector<GlyphKey> evictedKeys;
+    std::optional<PackedRect> rect;
+    std::uint32_t pageIndex = 0;
+    for(; pageIndex < this->pages.size(); pageIndex++) {
+        rect = this->pages[pageIndex].packer.pack(width, height);
+        if(rect) {
+            break;
+        }
+    }
+    if(!rect && this->pages.size() < this->maxPageCount) {
+        this->createPage();
+        pageIndex = static_cast<std::uint32_t>(this->pages.size() - 1);
+        rect = this->pages[pageIndex].packer.pack(width, height);
+    }
+    if(!rect) {
+        evictedPage = this->findEvictablePage(width, height, completedFrameNumber);
+        if(!evictedPage) {
+            return std::nullopt;
+        }
+        pageIndex = *evictedPage;
+        evictedKeys = this->evict(pageIndex);
+        rect = this->pages[pageIndex].packer.pack(width, height);
+        if(!rect) {
+            return std::nullopt;
+        }
+    }
+
+    Page& page = this->pages[pageIndex];
+    page.lastUsedFrame = std::max(page.lastUsedFrame, frameNumber);
+    page.keys.push_back(key);
+    Entry entry { pageIndex, *rect, frameNumber };
+    this->entries.emplace(key, entry);
+    return Insertion { entry, evictedPage, std::move(evictedKeys) };
+}
+
+void fuji::text::utility::PagedGlyphIndex::clear() {
+    this->pages.clear();
+    this->entries.clear();
+    this->evictionCount = 0;
+    if(this->reservedRect) {
+        this->createPage();
+    }
+}
+
+std::uint32_t fuji::text::utility::PagedGlyphIndex::getPageCount() const noexcept {
+    return static_cast<std::uint32_t>(this->pages.size());
+}
+
+std::uint32_t fuji::text::utility::PagedGlyphIndex::getMaxPageCount() const noexcept {
+    return this->maxPageCount;
+}
+
+std::size_t fuji::text::utility::PagedGlyphIndex::getGlyphCount() const noexcept {
+    return this->entries.size();
+}
+
+std::uint64_t fuji::text::utility::PagedGlyphIndex::getEvictionCount() const noexcept {
+    return this->evictionCount;
+}
+
+std::optional<std::uint32_t> fuji::text::utility::PagedGlyphIndex::findEvictablePage(std::uint32_t width, std::uint32_t height, std::uint64_t completedFrameNumber) const {
+    std::optional<std::uint32_t> candidate;
+    for(std::uint32_t i = 0; i < this->pages.size(); i++) {
+        if(this->pages[i].lastUsedFrame > completedFrameNumber || !this->fitsEmptyPage(i, width, height)) {
+            continue;
+        }
+        if(!candidate || this->pages[i].lastUsedFrame < this->pages[*candidate].lastUsedFrame) {
+            candidate = i;
+        }
+    }
+    return candidate;
+}
+
+std::vector<fuji::text::GlyphKey> fuji::text::utility::PagedGlyphIndex::evict(std::uint32_t pageIndex) {
+    Page& page = this->pages[pageIndex];
+    for(auto& key : page.keys) {
+        this->entries.erase(key);
+    }
+    std::vector<GlyphKey> keys = std::move(page.keys);
+    page.keys.clear();
+    page.packer.reset();
+    page.lastUsedFrame = 0;
+    // the reserved region is the first rect packed into an empty page, so packing it again yields the same place
+    if(pageIndex == 0 && this->reservedRect) {
+        page.packer.pack(this->reservedRect->width, this->reservedRect->height);
+    }
+    this->evictionCount++;
+    return keys;
+}
+
+bool fuji::text::utility::PagedGlyphIndex::fitsEmptyPage(std::uint32_t pageIndex, std::uint32_t width, std::uint32_t height) const noexcept {
+    // only page 0 shares its space with the reserved region
+    if(pageIndex != 0 || !this->reservedRect) {
+        return true;
+    }
+    return width <= this->pageWidth - this->reservedRect->width || height <= this->pageHeight - this->reservedRect->height;
+}
+
+void fuji::text::utility::PagedGlyphIndex::createPage() {
+    this->pages.push_back(Page { SkylinePacker { this->pageWidth, this->pageHeight }, 0, {} });
+    if(this->pages.size() == 1 && this->reservedRect) {
+        this->pages[0].packer.pack(this->reservedRect->width, this->reservedRect->height);
+    }
+}
@@ -0,0 +1,330 @@
+#include <fuji/text/internal/utility/pair_adjustment_table.hpp>
+
+#include <algorithm>
+
+namespace {
+    using fuji::text::utility::SfntReader;
+
+    enum ValueFormat : std::uint16_t {
+        eXPlacement = 0x0001,
+        eYPlacement = 0x0002,
+        eXAdvance = 0x0004
+    };
+
+    constexpr std::uint16_t pairAdjustmentLookup = 2;
+    constexpr std::uint16_t extensionLookup = 9;
+
+    std::size_t getValueRecordSize(std::uint16_t valueFormat) noexcept {
+        std::size_t size = 0;
+        for(std::uint16_t bit = 1; bit != 0 && bit <= 0x0080; bit <<= 1) {
+            if(valueFormat & bit) {
+                size += 2;
+            }
+        }
+        return size;
+    }
+
+    std::int16_t readXAdvance(const SfntReader& data, std::size_t offset, std::uint16_t valueFormat) {
+        if(!(valueFormat & eXAdvance)) {
+            return 0;
+        }
+        std::size_t skip = ((valueFormat & eXPlacement) ? 2 : 0) + ((valueFormat & eYPlacement) ? 2 : 0);
+        return data.readI16(offset + skip);
+    }
+
+    std::vector<std::uint16_t> readCoverage(const SfntReader& coverage) {
+        std::vector<std::uint16_t> glyphs;
+        std::uint16_t format = coverage.readU16(0);
+        if(format == 1) {
+            std::uint16_t glyphCount = coverage.readU16(2);
+            for(std::uint16_t i = 0; i < glyphCount; i++) {
+                glyphs.push_back(coverage.readU16(4 + static_cast<std::size_t>(i) * 2));
+            }
+        } else if(format == 2) {
+            std::uint16_t rangeCount = coverage.readU16(2);
+            for(std::uint16_t i = 0; i < rangeCount; i++) {
+                std::size_t range = 4 + static_cast<std::size_t>(i) * 6;
+                std::uint16_t startGlyph = coverage.readU16(range);
+                std::uint16_t endGlyph = coverage.readU16(range + 2);
+                for(std::uint32_t glyph = startGlyph; glyph <= endGlyph; glyph++) {
+                    glyphs.push_back(static_cast<std::uint16_t>(glyph));
+                }
+            }
+        }
+        return glyphs;
+    }
+
+    template <typename Visit>
+    void visitClassDef(const SfntReader& classDef, Visit visit) {
+        std::uint16_t format = classDef.readU16(0);
+        if(format == 1) {
+            std::uint16_t startGlyph = classDef.readU16(2);
+            std::uint16_t glyphCount = classDef.readU16(4);
+            for(std::uint16_t i = 0; i < glyphCount; i++) {
+                visit(static_cast<std::uint16_t>(startGlyph + i), classDef.readU16(6 + static_cast<std::size_t>(i) * 2));
+            }
+        } else if(format == 2) {
+            std::uint16_t rangeCount = classDef.readU16(2);
+            for(std::uint16_t i = 0; i < rangeCount; i++) {
+                std::size_t range = 4 + static_cast<std::size_t>(i) * 6;
+                std::uint16_t startGlyph = classDef.readU16(range);
+                std::uint16_t endGlyph = classDef.readU16(range + 2);
+                std::uint16_t glyphClass = classDef.readU16(range + 4);
+                for(std::uint32_t glyph = startGlyph; glyph <= endGlyph; glyph++) {
+                    visit(static_cast<std::uint16_t>(glyph), glyphClass);
+                }
+            }
+        }
+    }
+
+    std::uint32_t hashKey(std::uint32_t key) noexcept {
+        key ^= key >> 16;
+        key *= 0x7feb352d;
+        key ^= key >> 15;
+        return key;
+    }
+}
+
+fuji::text::utility::PairAdjustmentTable::PairAdjustmentTable() : pairCount(0) {
+}
+
+fuji::text::utility::PairAdjustmentTable fuji::text::utility::PairAdjustmentTable::fromKern(const SfntReader& kern) {
+    PairAdjustmentTable table;
+    if(kern.readU16(0) != 0) {
+        return table;
+    }
+
+    std::uint16_t subtableCount = kern.readU16(2);
+    std::size_t offset = 4;
+    for(std::uint16_t i = 0; i < subtableCount; i++) {
+        std::uint16_t length = kern.readU16(offset + 2);
+        std::uint16_t coverage = kern.readU16(offset + 4);
+        bool horizontal = (coverage & 0x0001) != 0;
+        bool minimum = (coverage & 0x0002) != 0;
+        bool crossStream = (coverage & 0x0004) != 0;
+        std::uint8_t format = static_cast<std::uint8_t>(coverage >> 8);
+        if(format == 0 && horizontal && !minimum && !crossStream) {
+            std::uint16_t pairCount = kern.readU16(offset + 6);
+            table.rehash(table.pairCount + pairCount);
+            for(std::uint16_t j = 0; j < pairCount; j++) {
+                std::size_t pair = offset + 14 + static_cast<std::size_t>(j) * 6;
+                table.insert(kern.readU16(pair), kern.readU16(pair + 2), kern.readI16(pair + 4));
+            }
+        }
+        if(length < 6) {
+            break;
+        }
+        offset += length;
+    }
+    return table;
+}
+
+fuji::text::utility::PairAdjustmentTable fuji::text::utility::PairAdjustmentTable::fromGpos(const SfntReader& gpos) {
+    PairAdjustmentTable table;
+    SfntReader featureList = gpos.subspan(gpos.readU16(6));
+    SfntReader lookupList = gpos.subspan(gpos.readU16(8));
+
+    std::vector<std::uint16_t> lookupIndices;
+    std::uint16_t featureCount = featureList.readU16(0);
+    for(std::uint16_t i = 0; i < featureCount; i++) {
+        std::size_t record = 2 + static_cast<std::size_t>(i) * 6;
+        if(featureList.readU32(record) != makeTag('k', 'e', 'r', 'n')) {
+            continue;
+        }
+        SfntReader feature = featureList.subspan(featureList.readU16(record + 4));
+        std::uint16_t lookupIndexCount = feature.readU16(2);
+        for(std::uint16_t j = 0; j < lookupIndexCount; j++) {
+            lookupIndices.push_back(feature.readU16(4 + static_cast<std::size_t>(j) * 2));
+        }
+    }
+    std::sort(lookupIndices.begin(), lookupIndices.end());
+    lookupIndices.erase(std::unique(lookupIndices.begin(), lookupIndices.end()), lookupIndices.end());
+
+    std::uint16_t lookupCount = lookupList.readU16(0);
+    for(std::uint16_t lookupIndex : lookupIndices) {
+        if(lookupIndex >= lookupCount) {
+            continue;
+        }
+        SfntReader lookup = lookupList.subspan(lookupList.readU16(2 + static_cast<std::size_t>(lookupIndex) * 2));
+        std::uint16_t lookupType = lookup.readU16(0);
+        std::uint16_t subtableCount = lookup.readU16(4);
+        for(std::uint16_t i = 0; i < subtableCount; i++) {
+            SfntReader subtable = lookup.subspan(lookup.readU16(6 + static_cast<std::size_t>(i) * 2));
+            std::uint16_t subtableType = lookupType;
+            if(lookupType == extensionLookup) {
+                subtableType = subtable.readU16(2);
+                subtable = subtable.subspan(subtable.readU32(4));
+            }
+            if(subtableType != pairAdjustmentLookup) {
+                continue;
+            }
+            std::uint16_t format = subtable.readU16(0);
+            if(format == 1) {
+                table.addPairSubtable(subtable);
+            } else if(format == 2) {
+                table.addClassSubtable(subtable);
+            }
+        }
+    }
+    return table;
+}
+
+std::int16_t fuji::text::utility::PairAdjustmentTable::find(std::uint16_t left, std::uint16_t right) const noexcept {
+    if(!this->keys.empty()) {
+        std::uint32_t key = (static_cast<std::uint32_t>(left) << 16) | right;
+        std::size_t mask = this->keys.size() - 1;
+        for(std::size_t slot = hashKey(key) & mask;; slot = (slot + 1) & mask) {
+            if(this->keys[slot] == key) {
+                return this->values[slot];
+            }
+            if(this->keys[slot] == emptyKey) {
+                break;
+            }
+        }
+    }
+
+    for(auto& subtable : this->classSubtables) {
+        std::size_t first = static_cast<std::size_t>(left) - subtable.firstGlyph;
+        if(left < subtable.firstGlyph || first >= subtable.firstClasses.size() || subtable.firstClasses[first] == uncovered) {
+            continue;
+        }
+        std::size_t second = static_cast<std::size_t>(right) - subtable.secondFirstGlyph;
+        std::uint16_t secondClass = right >= subtable.secondFirstGlyph && second < subtable.secondClasses.size() ? subtable.secondClasses[second] : 0;
+        return subtable.adjustments[static_cast<std::size_t>(subtable.firstClasses[first]) * subtable.secondClassCount + secondClass];
+    }
+    return 0;
+}
+
+void fuji::text::utility::PairAdjustmentTable::apply(const std::uint32_t* glyphIndices, std::size_t count, std::int32_t* adjustments) const noexcept {
+    if(count == 0) {
+        return;
+    }
+    for(std::size_t i = 0; i + 1 < count; i++) {
+        bool valid = glyphIndices[i] <= 0xFFFF && glyphIndices[i + 1] <= 0xFFFF;
+        adjustments[i] = valid ? this->find(static_cast<std::uint16_t>(glyphIndices[i]), static_cast<std::uint16_t>(glyphIndices[i + 1])) : 0;
+    }
+    adjustments[count - 1] = 0;
+}
+
+bool fuji::text::utility::PairAdjustmentTable::empty() const noexcept {
+    return this->pairCount == 0 && this->classSubtables.empty();
+}
+
+std::size_t fuji::text::utility::PairAdjustmentTable::getPairCount() const noexcept {
+    return this->pairCount;
+}
+
+std::size_t fuji::text::utility::PairAdjustmentTable::getClassSubtableCount() const noexcept {
+    return this->classSubtables.size();
+}
+
+void fuji::text::utility::PairAdjustmentTable::addPairSubtable(const SfntReader& subtable) {
+    std::vector<std::uint16_t> coverage = readCoverage(subtable.subspan(subtable.readU16(2)));
+    std::uint16_t valueFormat1 = subtable.readU16(4);
+    std::uint16_t valueFormat2 = subtable.readU16(6);
+    std::uint16_t pairSetCount = subtable.readU16(8);
+    std::size_t recordSize = 2 + getValueRecordSize(valueFormat1) + getValueRecordSize(valueFormat2);
+
+    std::size_t count = std::min<std::size_t>(coverage.size(), pairSetCount);
+    for(std::size_t i = 0; i < count; i++) {
+        SfntReader pairSet = subtable.subspan(subtable.readU16(10 + i * 2));
+        std::uint16_t pairValueCount = pairSet.readU16(0);
+        this->rehash(this->pairCount + pairValueCount);
+        for(std::uint16_t j = 0; j < pairValueCount; j++) {
+            std::size_t record = 2 + static_cast<std::size_t>(j) * recordSize;
+            this->insert(coverage[i], pairSet.readU16(record), readXAdvance(pairSet, record + 2, valueFormat1));
+        }
+    }
+}
+
+void fuji::text::utility::PairAdjustmentTable::addClassSubtable(const SfntReader& subtable) {
+    std::vector<std::uint16_t> coverage = readCoverage(subtable.subspan(subtable.readU16(2)));
+    if(coverage.empty()) {
+        return;
+    }
+    std::uint16_t valueFormat1 = subtable.readU16(4);
+    std::uint16_t valueFormat2 = subtable.readU16(6);
+    SfntReader classDef1 = subtable.subspan(subtable.readU16(8));
+    SfntReader classDef2 = subtable.subspan(subtable.readU16(10));
+    std::uint16_t firstClassCount = subtable.readU16(12);
+    std::uint16_t secondClassCount = subtable.readU16(14);
+    std::size_t recordSize = getValueRecordSize(valueFormat1) + getValueRecordSize(valueFormat2);
+
+    ClassSubtable classSubtable {};
+    auto [minGlyph, maxGlyph] = std::minmax_element(coverage.begin(), coverage.end());
+    classSubtable.firstGlyph = *minGlyph;
+    classSubtable.firstClasses.assign(static_cast<std::size_t>(*maxGlyph - *minGlyph) + 1, uncovered);
+    for(std::uint16_t glyph : coverage) {
+        classSubtable.firstClasses[glyph - classSubtable.firstGlyph] = 0;
+    }
+    visitClassDef(classDef1, [&classSubtable, firstClassCount](std::uint16_t glyph, std::uint16_t glyphClass) {
+        std::size_t index = static_cast<std::size_t>(glyph) - classSubtable.firstGlyph;
+        if(glyph >= classSubtable.firstGlyph && index < classSubtable.firstClasses.size() && classSubtable.firstClasses[index] != uncovered) {
+            classSubtable.firstClasses[index] = glyphClass < firstClassCount ? glyphClass : 0;
+        }
+    });
+
+    std::uint16_t secondMin = 0xFFFF;
+    std::uint16_t secondMax = 0;
+    visitClassDef(classDef2, [&secondMin, &secondMax](std::uint16_t glyph, std::uint16_t) {
+        secondMin = std::min(secondMin, glyph);
+        secondMax = std::max(secondMax, glyph);
+    });
+    if(secondMin <= secondMax) {
+        classSubtable.secondFirstGlyph = secondMin;
+        classSubtable.secondClasses.assign(static_cast<std::size_t>(secondMax - secondMin) + 1, 0);
+        visitClassDef(classDef2, [&classSubtable, secondClassCount](std::uint16_t glyph, std::uint16_t glyphClass) {
+            classSubtable.secondClasses[glyph - classSubtable.secondFirstGlyph] = glyphClass < secondClassCount ? glyphClass : 0;
+        });
+    }
+
+    classSubtable.secondClassCount = std::max<std::uint16_t>(1, secondClassCount);
+    classSubtable.adjustments.assign(static_cast<std::size_t>(std::max<std::uint16_t>(1, firstClassCount)) * classSubtable.secondClassCount, 0);
+    for(std::uint16_t i = 0; i < firstClassCount; i++) {
+        for(std::uint16_t j = 0; j < secondClassCount; j++) {
+            std::size_t record = 16 + (static_cast<std::size_t>(i) * secondClassCount + j) * recordSize;
+            classSubtable.adjustments[static_cast<std::size_t>(i) * secondClassCount + j] = readXAdvance(subtable, record, valueFormat1);
+        }
+    }
+    this->classSubtables.push_back(std::move(classSubtable));
+}
+
+void fuji::text::utility::PairAdjustmentTable::insert(std::uint16_t left, std::uint16_t right, std::int16_t adjustment) {
+    std::uint32_t key = (static_cast<std::uint32_t>(left) << 16) | right;
+    if(key == emptyKey) {
+        return;
+    }
+    std::size_t mask = this->keys.size() - 1;
+    for(std::size_t slot = hashKey(key) & mask;; slot = (slot + 1) & mask) {
+        if(this->keys[slot] == key) {
+            return;
+        }
+        if(this->keys[slot] == emptyKey) {
+            this->keys[slot] = key;
+            this->values[slot] = adjustment;
+            this->pairCount++;
+            return;
+        }
+    }
+}
+
+void fuji::text::utility::PairAdjustmentTable::rehash(std::size_t pairCount) {
+    std::size_t capacity = 16;
+    while(capacity < pairCount * 2) {
+        capacity *= 2;
+    }
+    if(capacity <= this->keys.size()) {
+        return;
+    }
+
+    std::vector<std::uint32_t> oldKeys = std::move(this->keys);
+    std::vector<std::int16_t> oldValues = std::move(this->values);
+    this->keys.assign(capacity, emptyKey);
+    this->values.assign(capacity, 0);
+    this->pairCount = 0;
+    for(std::size_t i = 0; i < oldKeys.size(); i++) {
+        if(oldKeys[i] != emptyKey) {
+            this->insert(static_cast<std::uint16_t>(oldKeys[i] >> 16), static_cast<std::uint16_t>(oldKeys[i]), oldValues[i]);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#include <fuji/text/internal/utility/sdf_kernel.hpp>
+
+#include <algorithm>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define FUJI_SDF_KERNEL_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FUJI_SDF_KERNEL_SSE2 1
+#endif
+
+namespace {
+    struct PreparedSegment {
+        float ax;
+        float ay;
+        float dx;
+        float dy;
+        float inverseLengthSquared;
+    };
+
+    PreparedSegment prepare(const fuji::text::utility::LineSegment& segment) {
+        float dx = segment.x1 - segment.x0;
+        float dy = segment.y1 - segment.y0;
+        float lengthSquared = dx * dx + dy * dy;
+        return PreparedSegment { segment.x0, segment.y0, dx, dy, lengthSquared > 0.0f ? 1.0f / lengthSquared : 0.0f };
+    }
+
+    void updateScalar(float* distances, std::uint32_t begin, std::uint32_t end, float y, const PreparedSegment& segment) {
+        float py = y - segment.ay;
+        for(std::uint32_t i = begin; i < end; i++) {
+            float px = static_cast<float>(i) + 0.5f - segment.ax;
+            float t = std::clamp((px * segment.dx + py * segment.dy) * segment.inverseLengthSquared, 0.0f, 1.0f);
+            float ex = px - t * segment.dx;
+            float ey = py - t * segment.dy;
+            distances[i] = std::min(distances[i], ex * ex + ey * ey);
+        }
+    }
+
+#if defined(FUJI_SDF_KERNEL_AVX2)
+    constexpr std::uint32_t laneCount = 8;
+
+    std::uint32_t updateVector(float* distances, std::uint32_t count, float y, const PreparedSegment& segment) {
+        const __m256 dx = _mm256_set1_ps(segment.dx);
+        const __m256 dy = _mm256_set1_ps(segment.dy);
+        const __m256 py = _mm256_set1_ps(y - segment.ay);
+        const __m256 inverseLengthSquared = _mm256_set1_ps(segment.inverseLengthSquared);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 step = _mm256_set1_ps(static_cast<float>(laneCount));
+        const __m256 pyDy = _mm256_mul_ps(py, dy);
+        __m256 px = _mm256_sub_ps(_mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f), _mm256_set1_ps(segment.ax));
+
+        std::uint32_t i = 0;
+        for(; i + laneCount <= count; i += laneCount) {
+            __m256 t = _mm256_mul_ps(_mm256_fmadd_ps(px, dx, pyDy), inverseLengthSquared);
+            t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+            __m256 ex = _mm256_fnmadd_ps(t, dx, px);
+            __m256 ey = _mm256_fnmadd_ps(t, dy, py);
+            __m256 distance = _mm256_fmadd_ps(ex, ex, _mm256_mul_ps(ey, ey));
+            _mm256_storeu_ps(distances + i, _mm256_min_ps(_mm256_loadu_ps(distances + i), distance));
+            px = _mm256_add_ps(px, step);
+        }
+        return i;
+    }
+#elif defined(FUJI_SDF_KERNEL_SSE2)
+    constexpr std::uint32_t laneCount = 4;
+
+    std::uint32_t updateVector(float* distances, std::uint32_t count, float y, const PreparedSegment& segment) {
+        const __m128 dx = _mm_set1_ps(segment.dx);
+        const __m128 dy = _mm_set1_ps(segment.dy);
+        const __m128 py = _mm_set1_ps(y - segment.ay);
+        const __m128 inverseLengthSquared = _mm_set1_ps(segment.inverseLengthSquared);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 step = _mm_set1_ps(static_cast<float>(laneCount));
+        const __m128 pyDy = _mm_mul_ps(py, dy);
+        __m128 px = _mm_sub_ps(_mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f), _mm_set1_ps(segment.ax));
+
+        std::uint32_t i = 0;
+        for(; i + laneCount <= count; i += laneCount) {
+            __m128 t = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(px, dx), pyDy), inverseLengthSquared);
+            t = _mm_min_ps(_mm_max_ps(t, zero), one);
+            __m128 ex = _mm_sub_ps(px, _mm_mul_ps(t, dx));
+            __m128 ey = _mm_sub_ps(py, _mm_mul_ps(t, dy));
+            __m128 distance = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+            _mm_storeu_ps(distances + i, _mm_min_ps(_mm_loadu_ps(distances + i), distance));
+            px = _mm_add_ps(px, step);
+        }
+        return i;
+    }
+#else
+    std::uint32_t updateVector(float*, std::uint32_t, float, const PreparedSegment&) {
+        return 0;
+    }
+#endif
+}
+
+void fuji::text::utility::updateRowDistances(float* distances, std::uint32_t count, float y, const LineSegment* segments, std::size_t segmentCount) {
+    for(std::size_t i = 0; i < segmentCount; i++) {
+        PreparedSegment segment = prepare(segments[i]);
+        std::uint32_t processed = updateVector(distances, count, y, segment);
+        updateScalar(distances, processed, count, y, segment);
+    }
+}
+
+void fuji::text::utility::updateRowDistancesScalar(float* distances, std::uint32_t count, float y, const LineSegment* segments, std::size_t segmentCount) {
+    for(std::size_t i = 0; i < segmentCount; i++) {
+        updateScalar(distances, 0, count, y, prepare(segments[i]));
+    }
+}
+
+const char* fuji::text::utility::getSdfKernelName() noexcept {
+#if defined(FUJI_SDF_KERNEL_AVX2)
+    return "avx2";
+#elif defined(FUJI_SDF_KERNEL_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,71 @@
+#include <fuji/text/internal/utility/sfnt_reader.hpp>
+
+#include <stdexcept>
+
+fuji::text::utility::SfntReader::SfntReader() noexcept : data(nullptr), size(0) {
+}
+
+fuji::text::utility::SfntReader::SfntReader(const std::uint8_t* data, std::size_t size) noexcept : data(data), size(size) {
+}
+
+const std::uint8_t* fuji::text::utility::SfntReader::getData() const noexcept {
+    return this->data;
+}
+
+std::size_t fuji::text::utility::SfntReader::getSize() const noexcept {
+    return this->size;
+}
+
+bool fuji::text::utility::SfntReader::empty() const noexcept {
+    return this->size == 0;
+}
+
+bool fuji::text::utility::SfntReader::contains(std::size_t offset, std::size_t length) const noexcept {
+    return offset <= this->size && length <= this->size - offset;
+}
+
+fuji::text::utility::SfntReader fuji::text::utility::SfntReader::subspan(std::size_t offset, std::size_t length) const {
+    if(!this->contains(offset, length)) {
+        throw std::runtime_error("font data is truncated");
+    }
+    return SfntReader { this->data + offset, length };
+}
+
+fuji::text::utility::SfntReader fuji::text::utility::SfntReader::subspan(std::size_t offset) const {
+    if(offset > this->size) {
+        throw std::runtime_error("font data is truncated");
+    }
+    return SfntReader { this->data + offset, this->size - offset };
+}
+
+std::uint8_t fuji::text::utility::SfntReader::readU8(std::size_t offset) const {
+    if(!this->contains(offset, 1)) {
+        throw std::runtime_error("font data is truncated");
+    }
+    return this->data[offset];
+}
+
+std::int8_t fuji::text::utility::SfntReader::readI8(std::size_t offset) const {
+    return static_cast<std::int8_t>(this->readU8(offset));
+}
+
+std::uint16_t fuji::text::utility::SfntReader::readU16(std::size_t offset) const {
+    if(!this->contains(offset, 2)) {
+        throw std::runtime_error("font data is truncated");
+    }
+    return static_cast<std::uint16_t>((this->data[offset] << 8) | this->data[offset + 1]);
+}
+
+std::int16_t fuji::text::utility::SfntReader::readI16(std::size_t offset) const {
+    return static_cast<std::int16_t>(this->readU16(offset));
+}
+
+std::uint32_t fuji::text::utility::SfntReader::readU32(std::size_t offset) const {
+    if(!this->contains(offset, 4)) {
+        throw std::runtime_error("font data is truncated");
+    }
+    return (static_cast<std::uint32_t>(this->data[offset]) << 24)
+        | (static_cast<std::uint32_t>(this->data[offset + 1]) << 16)
+        | (static_cast<std::uint32_t>(this->data[offset + 2]) << 8)
+        | static_cast<std::uint32_t>(this->data[offset + 3]);
+}
@@ -0,0 +1,111 @@
+#include <fuji/text/internal/utility/skyline_packer.hpp>
+
+#include <algorithm>
+#include <limits>
+
+fuji::text::utility::SkylinePacker::SkylinePacker(std::uint32_t width, std::uint32_t height)
+        : width(width), height(height), usedArea(0) {
+    this->reset();
+}
+
+std::optional<fuji::text::utility::PackedRect> fuji::text::utility::SkylinePacker::pack(std::uint32_t width, std::uint32_t height) {
+    if(width == 0 || height == 0) {
+        return std::nullopt;
+    }
+
+    std::size_t bestIndex = this->skyline.size();
+    std::uint32_t bestTop = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t bestWidth = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t bestY = 0;
+    for(std::size_t i = 0; i < this->skyline.size(); i++) {
+        auto y = this->fit(i, width, height);
+        if(!y) {
+            continue;
+        }
+        std::uint32_t top = *y + height;
+        if(top < bestTop || (top == bestTop && this->skyline[i].width < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = this->skyline[i].width;
+            bestY = *y;
+        }
+    }
+    if(bestIndex == this->skyline.size()) {
+        return std::nullopt;
+    }
+
+    PackedRect rect { this->skyline[bestIndex].x, bestY, width, height };
+    this->skyline.insert(this->skyline.begin() + bestIndex, Node { rect.x, rect.y + height, width });
+
+    for(std::size_t i = bestIndex + 1; i < this->skyline.size();) {
+        Node& previous = this->skyline[i - 1];
+        Node& node = this->skyline[i];
+        std::uint32_t previousEnd = previous.x + previous.width;
+        if(node.x >= previousEnd) {
+            break;
+        }
+        std::uint32_t shrink = previousEnd - node.x;
+        if(node.width <= shrink) {
+            this->skyline.erase(this->skyline.begin() + i);
+            continue;
+        }
+        node.x += shrink;
+        node.width -= shrink;
+        break;
+    }
+    this->merge();
+
+    this->usedArea += static_cast<std::uint64_t>(width) * height;
+    return rect;
+}
+
+void fuji::text::utility::SkylinePacker::reset() {
+    this->usedArea = 0;
+    this->skyline.clear();
+    this->skyline.push_back(Node { 0, 0, this->width });
+}
+
+std::uint32_t fuji::text::utility::SkylinePacker::getWidth() const noexcept {
+    return this->width;
+}
+
+std::uint32_t fuji::text::utility::SkylinePacker::getHeight() const noexcept {
+    return this->height;
+}
+
+std::uint64_t fuji::text::utility::SkylinePacker::getUsedArea() const noexcept {
+    return this->usedArea;
+}
+
+float fuji::text::utility::SkylinePacker::getOccupancy() const noexcept {
+    return static_cast<float>(this->usedArea) / (static_cast<float>(this->width) * static_cast<float>(this->height));
+}
+
+std::optional<std::uint32_t> fuji::text::utility::SkylinePacker::fit(std::size_t index, std::uint32_t width, std::uint32_t height) const {
+    std::uint32_t x = this->skyline[index].x;
+    if(x + width > this->width) {
+        return std::nullopt;
+    }
+
+    std::uint32_t y = 0;
+    std::uint32_t remaining = width;
+    for(std::size_t i = index; remaining > 0; i++) {
+        y = std::max(y, this->skyline[i].y);
+        if(y + height > this->height) {
+            return std::nullopt;
+        }
+        remaining -= std::min(remaining, this->skyline[i].width);
+    }
+    return y;
+}
+
+void fuji::text::utility::SkylinePacker::merge() {
+    for(std::size_t i = 1; i < this->skyline.size();) {
+        if(this->skyline[i - 1].y == this->skyline[i].y) {
+            this->skyline[i - 1].width += this->skyline[i].width;
+            this->skyline.erase(this->skyline.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
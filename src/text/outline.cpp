@@ -0,0 +1,66 @@
+#include <fuji/text/outline.hpp>
+
+#include <algorithm>
+
+void fuji::text::Outline::moveTo(float x, float y) {
+    if(!this->verbs.empty() && this->verbs.back() != Verb::eClose) {
+        this->close();
+    }
+    this->verbs.push_back(Verb::eMoveTo);
+    this->points.push_back(OutlinePoint { x, y });
+}
+
+void fuji::text::Outline::lineTo(float x, float y) {
+    this->verbs.push_back(Verb::eLineTo);
+    this->points.push_back(OutlinePoint { x, y });
+}
+
+void fuji::text::Outline::quadTo(float controlX, float controlY, float x, float y) {
+    this->verbs.push_back(Verb::eQuadTo);
+    this->points.push_back(OutlinePoint { controlX, controlY });
+    this->points.push_back(OutlinePoint { x, y });
+}
+
+void fuji::text::Outline::cubicTo(float control1X, float control1Y, float control2X, float control2Y, float x, float y) {
+    this->verbs.push_back(Verb::eCubicTo);
+    this->points.push_back(OutlinePoint { control1X, control1Y });
+    this->points.push_back(OutlinePoint { control2X, control2Y });
+    this->points.push_back(OutlinePoint { x, y });
+}
+
+void fuji::text::Outline::close() {
+    if(!this->verbs.empty() && this->verbs.back() != Verb::eClose) {
+        this->verbs.push_back(Verb::eClose);
+    }
+}
+
+void fuji::text::Outline::clear() noexcept {
+    this->verbs.clear();
+    this->points.clear();
+}
+
+bool fuji::text::Outline::empty() const noexcept {
+    return this->points.empty();
+}
+
+const std::vector<fuji::text::Outline::Verb>& fuji::text::Outline::getVerbs() const noexcept {
+    return this->verbs;
+}
+
+const std::vector<fuji::text::OutlinePoint>& fuji::text::Outline::getPoints() const noexcept {
+    return this->points;
+}
+
+fuji::text::OutlineBounds fuji::text::Outline::getBounds() const noexcept {
+    if(this->points.empty()) {
+        return OutlineBounds { 0.0f, 0.0f, 0.0f, 0.0f };
+    }
+    OutlineBounds bounds { this->points[0].x, this->points[0].y, this->points[0].x, this->points[0].y };
+    for(auto& point : this->points) {
+        bounds.minX = std::min(bounds.minX, point.x);
+        bounds.minY = std::min(bounds.minY, point.y);
+        bounds.maxX = std::max(bounds.maxX, point.x);
+        bounds.maxY = std::max(bounds.maxY, point.y);
+    }
+    return bounds;
+}
@@ -0,0 +1,165 @@
+#include <fuji/text/sdf_generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+    struct Crossing {
+        float x;
+        std::int32_t direction;
+    };
+
+    float length(float x, float y) {
+        return std::sqrt(x * x + y * y);
+    }
+}
+
+fuji::text::SdfGenerator::SdfGenerator(float spread, float flatness) : spread(spread), flatness(flatness) {
+
+}
+
+fuji::text::SdfBitmap fuji::text::SdfGenerator::generate(const Outline& outline, float scale) const {
+    SdfBitmap bitmap {};
+    if(outline.empty()) {
+        return bitmap;
+    }
+
+    OutlineBounds bounds = outline.getBounds();
+    std::int32_t padding = static_cast<std::int32_t>(std::ceil(this->spread));
+    bitmap.left = static_cast<std::int32_t>(std::floor(bounds.minX * scale)) - padding;
+    bitmap.top = static_cast<std::int32_t>(std::ceil(bounds.maxY * scale)) + padding;
+    std::int32_t right = static_cast<std::int32_t>(std::ceil(bounds.maxX * scale)) + padding;
+    std::int32_t bottom = static_cast<std::int32_t>(std::floor(bounds.minY * scale)) - padding;
+    bitmap.width = static_cast<std::uint32_t>(right - bitmap.left);
+    bitmap.height = static_cast<std::uint32_t>(bitmap.top - bottom);
+    bitmap.pixels.resize(static_cast<std::size_t>(bitmap.width) * bitmap.height);
+
+    std::vector<utility::LineSegment> segments = this->flatten(outline, scale, static_cast<float>(bitmap.left), static_cast<float>(bitmap.top));
+
+    std::vector<float> distances(bitmap.width);
+    std::vector<utility::LineSegment> rowSegments;
+    std::vector<Crossing> crossings;
+    float maxDistanceSquared = this->spread * this->spread;
+    for(std::uint32_t row = 0; row < bitmap.height; row++) {
+        float y = static_cast<float>(row) + 0.5f;
+
+        // segments farther than the spread from this row can only produce clamped values
+        rowSegments.clear();
+        crossings.clear();
+        for(auto& segment : segments) {
+            float minY = std::min(segment.y0, segment.y1);
+            float maxY = std::max(segment.y0, segment.y1);
+            if(y >= minY - this->spread && y <= maxY + this->spread) {
+                rowSegments.push_back(segment);
+            }
+            if(segment.y0 != segment.y1 && y >= minY && y < maxY) {
+                float t = (y - segment.y0) / (segment.y1 - segment.y0);
+                crossings.push_back(Crossing { segment.x0 + t * (segment.x1 - segment.x0), segment.y1 > segment.y0 ? 1 : -1 });
+            }
+        }
+        std::sort(crossings.begin(), crossings.end(), [](auto& lhs, auto& rhs) { return lhs.x < rhs.x; });
+
+        std::fill(distances.begin(), distances.end(), maxDistanceSquared);
+        utility::updateRowDistances(distances.data(), bitmap.width, y, rowSegments.data(), rowSegments.size());
+
+        std::int32_t winding = 0;
+        std::size_t crossing = 0;
+        std::uint8_t* pixels = bitmap.pixels.data() + static_cast<std::size_t>(row) * bitmap.width;
+        for(std::uint32_t column = 0; column < bitmap.width; column++) {
+            float x = static_cast<float>(column) + 0.5f;
+            while(crossing < crossings.size() && crossings[crossing].x < x) {
+                winding += crossings[crossing].direction;
+                crossing++;
+            }
+            float distance = std::sqrt(std::min(distances[column], maxDistanceSquared));
+            float signedDistance = winding != 0 ? distance : -distance;
+            float value = std::clamp(0.5f + signedDistance / (2.0f * this->spread), 0.0f, 1.0f);
+            pixels[column] = static_cast<std::uint8_t>(std::lround(value * 255.0f));
+        }
+    }
+    return bitmap;
+}
+
+float fuji::text::SdfGenerator::getSpread() const noexcept {
+    return this->spread;
+}
+
+const char* fuji::text::SdfGenerator::getKernelName() noexcept {
+    return utility::getSdfKernelName();
+}
+
+std::vector<fuji::text::utility::LineSegment> fuji::text::SdfGenerator::flatten(const Outline& outline, float scale, float originX, float originY) const {
+    auto transform = [scale, originX, originY](const OutlinePoint& point) {
+        return OutlinePoint { point.x * scale - originX, originY - point.y * scale };
+    };
+
+    std::vector<utility::LineSegment> segments;
+    const auto& points = outline.getPoints();
+    std::size_t index = 0;
+    OutlinePoint start { 0.0f, 0.0f };
+    OutlinePoint current { 0.0f, 0.0f };
+    auto lineTo = [&segments, &current](OutlinePoint point) {
+        if(point.x != current.x || point.y != current.y) {
+            segments.push_back(utility::LineSegment { current.x, current.y, point.x, point.y });
+        }
+        current = point;
+    };
+
+    for(auto verb : outline.getVerbs()) {
+        switch(verb) {
+            case Outline::Verb::eMoveTo:
+                lineTo(start);
+                start = current = transform(points[index++]);
+                break;
+            case Outline::Verb::eLineTo:
+                lineTo(transform(points[index++]));
+                break;
+            case Outline::Verb::eQuadTo: {
+                OutlinePoint p0 = current;
+                OutlinePoint p1 = transform(points[index++]);
+                OutlinePoint p2 = transform(points[index++]);
+                float deviation = length(p0.x - 2.0f * p1.x + p2.x, p0.y - 2.0f * p1.y + p2.y);
+                std::uint32_t steps = std::max(1u, static_cast<std::uint32_t>(std::ceil(std::sqrt(deviation / (8.0f * this->flatness)))));
+                for(std::uint32_t i = 1; i <= steps; i++) {
+                    float t = static_cast<float>(i) / steps;
+                    float u = 1.0f - t;
+                    lineTo(OutlinePoint {
+                        u * u * p0.x + 2.0f * u * t * p1.x + t * t * p2.x,
+                        u * u * p0.y + 2.0f * u * t * p1.y + t * t * p2.y
+                    });
+                }
+                break;
+            }
+            case Outline::Verb::eCubicTo: {
+                OutlinePoint p0 = current;
+                OutlinePoint p1 = transform(points[index++]);
+                OutlinePoint p2 = transform(points[index++]);
+                OutlinePoint p3 = transform(points[index++]);
+                float deviation = std::max(
+                    length(p0.x - 2.0f * p1.x + p2.x, p0.y - 2.0f * p1.y + p2.y),
+                    length(p1.x - 2.0f * p2.x + p3.x, p1.y - 2.0f * p2.y + p3.y));
+                std::uint32_t steps = std::max(1u, static_cast<std::uint32_t>(std::ceil(std::sqrt(3.0f * deviation / (4.0f * this->flatness)))));
+                for(std::uint32_t i = 1; i <= steps; i++) {
+                    float t = static_cast<float>(i) / steps;
+                    float u = 1.0f - t;
+                    float a = u * u * u;
+                    float b = 3.0f * u * u * t;
+                    float c = 3.0f * u * t * t;
+                    float d = t * t * t;
+                    lineTo(OutlinePoint {
+                        a * p0.x + b * p1.x + c * p2.x + d * p3.x,
+                        a * p0.y + b * p1.y + c * p2.y + d * p3.y
+                    });
+                }
+                break;
+            }
+            case Outline::Verb::eClose:
+                lineTo(start);
+                break;
+        }
+    }
+    lineTo(start);
+    return segments;
+}
@@ -0,0 +1,16 @@
+#version 460
+
+layout (location = 0) in vec3 coord;
+layout (location = 1) flat in uint colorIndex;
+
+layout (location = 0) out vec4 outColor;
+
+layout (set = 0, binding = 0) uniform sampler2DArray atlas;
+layout (set = 0, binding = 1) uniform Palette {
+    vec4 colors[256];
+} palette;
+
+void main() {
+    vec4 color = palette.colors[colorIndex];
+    outColor = vec4(color.rgb, color.a * texture(atlas, coord).r);
+}
@@ -0,0 +1,25 @@
+#version 460
+
+layout (location = 0) in vec2 position;
+layout (location = 1) in uvec4 atlasRect;
+layout (location = 2) in uint layer;
+layout (location = 3) in uint colorIndex;
+
+layout (push_constant) uniform PushConstants {
+    vec2 viewportScale;
+    vec2 atlasScale;
+    vec2 origin;
+    vec2 quadScale;
+} pushConstants;
+
+layout (location = 0) out vec3 outCoord;
+layout (location = 1) flat out uint outColorIndex;
+
+void main() {
+    vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+    vec2 size = vec2(atlasRect.zw);
+    vec2 pixel = pushConstants.origin + position + corner * size * pushConstants.quadScale;
+    gl_Position = vec4(pixel * pushConstants.viewportScale - 1.0, 0.0, 1.0);
+    outCoord = vec3((vec2(atlasRect.xy) + corner * size) * pushConstants.atlasScale, float(layer));
+    outColorIndex = colorIndex;
+}
@@ -0,0 +1,19 @@
+#version 460
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout (location = 0) in vec3 coord;
+layout (location = 1) flat in uint colorIndex;
+
+layout (location = 0) out vec4 outColor;
+
+layout (set = 0, binding = 0) uniform sampler atlasSampler;
+layout (set = 0, binding = 1) uniform Palette {
+    vec4 colors[256];
+} palette;
+layout (set = 1, binding = 0) uniform texture2D pages[];
+
+void main() {
+    vec4 color = palette.colors[colorIndex];
+    uint page = uint(coord.z + 0.5);
+    outColor = vec4(color.rgb, color.a * texture(sampler2D(pages[nonuniformEXT(page)], atlasSampler), coord.xy).r);
+}
@@ -0,0 +1,197 @@
+#include <fuji/text/shaped_run_cache.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+    std::uint64_t mix(std::uint64_t seed, std::uint64_t value) noexcept {
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+    std::uint64_t hashCanonicalFeatures(const std::vector<fuji::text::FontFeature>& features) noexcept {
+        std::uint64_t value = features.size();
+        for(auto& feature : features) {
+            value = mix(value, (static_cast<std::uint64_t>(feature.tag) << 32) | feature.value);
+        }
+        return value;
+    }
+
+    fuji::text::ShapingKey canonicalize(const fuji::text::ShapingKey& key) {
+        return fuji::text::ShapingKey { key.fontId, key.size, fuji::text::ShapingKey::canonicalizeFeatures(key.features) };
+    }
+
+    bool equals(const fuji::text::ShapingKey& a, const fuji::text::ShapingKey& b) noexcept {
+        return a.fontId == b.fontId && a.size == b.size && a.features == b.features;
+    }
+
+    std::size_t getWordEnd(std::string_view text, std::size_t begin) noexcept {
+        std::size_t end = text.find(' ', begin);
+        if(end == std::string_view::npos) {
+            return text.size();
+        }
+        end = text.find_first_not_of(' ', end);
+        return end == std::string_view::npos ? text.size() : end;
+    }
+}
+
+std::vector<fuji::text::FontFeature> fuji::text::ShapingKey::canonicalizeFeatures(std::vector<FontFeature> features) {
+    std::stable_sort(features.begin(), features.end(), [](auto& a, auto& b) { return a.tag < b.tag; });
+    // a later feature overrides an earlier one with the same tag, as it does when shaping
+    auto last = features.begin();
+    for(auto it = features.begin(); it != features.end(); ++it) {
+        if(std::next(it) == features.end() || std::next(it)->tag != it->tag) {
+            *last++ = *it;
+        }
+    }
+    features.erase(last, features.end());
+    return features;
+}
+
+std::uint64_t fuji::text::ShapingKey::hashFeatures(const std::vector<FontFeature>& features) {
+    return hashCanonicalFeatures(canonicalizeFeatures(features));
+}
+
+fuji::text::ShapedRunCache::ShapedRunCache(std::size_t memoryBudget)
+        : memoryBudget(memoryBudget), memoryUsage(0), hitCount(0), missCount(0), evictionCount(0) {
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::find(const ShapingKey& key, std::string_view text) {
+    auto run = this->findCanonical(canonicalize(key), text);
+    if(!run) {
+        this->missCount++;
+    }
+    return run;
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::insert(const ShapingKey& key, std::string_view text, ShapedRun run) {
+    return this->insertCanonical(canonicalize(key), text, std::move(run));
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::shape(const ShapingKey& key, std::string_view text, const Shape& shaper, bool splitWords) {
+    ShapingKey canonicalKey = canonicalize(key);
+    if(!splitWords || text.find(' ') == std::string_view::npos) {
+        return this->shapeWord(canonicalKey, text, shaper);
+    }
+    // a miss on the whole text is not counted; the words that have to be shaped are
+    if(auto run = this->findCanonical(canonicalKey, text)) {
+        return run;
+    }
+
+    ShapedRun run { {}, 0.0f };
+    for(std::size_t begin = 0; begin < text.size();) {
+        std::size_t end = getWordEnd(text, begin);
+        auto word = this->shapeWord(canonicalKey, text.substr(begin, end - begin), shaper);
+        for(auto glyph : word->glyphs) {
+            glyph.cluster += static_cast<std::uint32_t>(begin);
+            run.glyphs.push_back(glyph);
+        }
+        run.advance += word->advance;
+        begin = end;
+    }
+    return this->insertCanonical(canonicalKey, text, std::move(run));
+}
+
+void fuji::text::ShapedRunCache::clear() noexcept {
+    this->entries.clear();
+    this->index.clear();
+    this->memoryUsage = 0;
+}
+
+std::size_t fuji::text::ShapedRunCache::getMemoryBudget() const noexcept {
+    return this->memoryBudget;
+}
+
+std::size_t fuji::text::ShapedRunCache::getMemoryUsage() const noexcept {
+    return this->memoryUsage;
+}
+
+std::size_t fuji::text::ShapedRunCache::getEntryCount() const noexcept {
+    return this->entries.size();
+}
+
+std::uint64_t fuji::text::ShapedRunCache::getHitCount() const noexcept {
+    return this->hitCount;
+}
+
+std::uint64_t fuji::text::ShapedRunCache::getMissCount() const noexcept {
+    return this->missCount;
+}
+
+std::uint64_t fuji::text::ShapedRunCache::getEvictionCount() const noexcept {
+    return this->evictionCount;
+}
+
+std::size_t fuji::text::ShapedRunCache::hash(const ShapingKey& key, std::string_view text) noexcept {
+    std::uint64_t value = std::hash<std::string_view> {}(text);
+    value = mix(value, key.fontId);
+    value = mix(value, std::hash<float> {}(key.size));
+    value = mix(value, hashCanonicalFeatures(key.features));
+    return static_cast<std::size_t>(value);
+}
+
+fuji::text::ShapedRunCache::EntryList::iterator fuji::text::ShapedRunCache::lookup(const ShapingKey& key, std::string_view text, std::size_t hash) {
+    auto [first, last] = this->index.equal_range(hash);
+    for(auto candidate = first; candidate != last; ++candidate) {
+        Entry& entry = *candidate->second;
+        if(equals(entry.key, key) && entry.text == text) {
+            return candidate->second;
+        }
+    }
+    return this->entries.end();
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::findCanonical(const ShapingKey& key, std::string_view text) {
+    auto entry = this->lookup(key, text, hash(key, text));
+    if(entry == this->entries.end()) {
+        return nullptr;
+    }
+    this->hitCount++;
+    this->entries.splice(this->entries.begin(), this->entries, entry);
+    return entry->run;
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::insertCanonical(const ShapingKey& key, std::string_view text, ShapedRun run) {
+    std::size_t runHash = hash(key, text);
+    auto existing = this->lookup(key, text, runHash);
+    if(existing != this->entries.end()) {
+        this->entries.splice(this->entries.begin(), this->entries, existing);
+        return existing->run;
+    }
+
+    std::size_t memorySize = sizeof(Entry) + sizeof(ShapedRun) + text.size() + key.features.size() * sizeof(FontFeature) + run.glyphs.size() * sizeof(ShapedGlyph);
+    auto shared = std::make_shared<const ShapedRun>(std::move(run));
+    if(memorySize > this->memoryBudget) {
+        return shared;
+    }
+
+    this->entries.push_front(Entry { key, std::string { text }, runHash, memorySize, shared });
+    this->index.emplace(runHash, this->entries.begin());
+    this->memoryUsage += memorySize;
+    this->evict();
+    return shared;
+}
+
+std::shared_ptr<const fuji::text::ShapedRun> fuji::text::ShapedRunCache::shapeWord(const ShapingKey& key, std::string_view text, const Shape& shaper) {
+    if(auto run = this->findCanonical(key, text)) {
+        return run;
+    }
+    this->missCount++;
+    return this->insertCanonical(key, text, shaper(key, text));
+}
+
+void fuji::text::ShapedRunCache::evict() {
+    while(this->memoryUsage > this->memoryBudget && !this->entries.empty()) {
+        auto victim = std::prev(this->entries.end());
+        auto [first, last] = this->index.equal_range(victim->hash);
+        for(auto candidate = first; candidate != last; ++candidate) {
+            if(candidate->second == victim) {
+                this->index.erase(candidate);
+                break;
+            }
+        }
+        this->memoryUsage -= victim->memorySize;
+        this->entries.erase(victim);
+        this->evictionCount++;
+    }
+}
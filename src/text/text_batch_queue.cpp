@@ -0,0 +1,76 @@
+#include <fuji/text/text_batch_queue.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+namespace {
+    auto toTuple(const fuji::text::TextBatchKey& key) noexcept {
+        return std::make_tuple(key.order, static_cast<VkPipeline>(key.pipeline), static_cast<VkDescriptorSet>(key.descriptorSet), key.atlasPageSize);
+    }
+
+    bool isSameState(const fuji::text::TextBatchKey& lhs, const fuji::text::TextBatchKey& rhs) noexcept {
+        return lhs.pipeline == rhs.pipeline && lhs.descriptorSet == rhs.descriptorSet && lhs.atlasPageSize == rhs.atlasPageSize;
+    }
+}
+
+void fuji::text::TextBatchQueue::add(const TextBatchKey& key, glm::vec2 origin, const GlyphInstance* instances, std::uint32_t instanceCount) {
+    if(instanceCount == 0) {
+        return;
+    }
+    std::uint32_t firstInstance = static_cast<std::uint32_t>(this->queuedInstances.size());
+    this->queuedInstances.insert(this->queuedInstances.end(), instances, instances + instanceCount);
+    for(std::size_t i = firstInstance; i < this->queuedInstances.size(); i++) {
+        this->queuedInstances[i].position += origin;
+    }
+    this->blocks.push_back(Block { key, firstInstance, instanceCount });
+}
+
+void fuji::text::TextBatchQueue::add(const TextBatchKey& key, glm::vec2 origin, const std::vector<GlyphInstance>& instances) {
+    this->add(key, origin, instances.data(), static_cast<std::uint32_t>(instances.size()));
+}
+
+void fuji::text::TextBatchQueue::build() {
+    std::vector<std::size_t> order(this->blocks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+        return toTuple(this->blocks[lhs].key) < toTuple(this->blocks[rhs].key);
+    });
+
+    this->instances.clear();
+    this->instances.reserve(this->queuedInstances.size());
+    this->batches.clear();
+    for(std::size_t index : order) {
+        const Block& block = this->blocks[index];
+        if(this->batches.empty() || !isSameState(this->batches.back().key, block.key)) {
+            this->batches.push_back(TextBatch { block.key, static_cast<std::uint32_t>(this->instances.size()), 0, 0 });
+        }
+        auto first = this->queuedInstances.begin() + block.firstInstance;
+        this->instances.insert(this->instances.end(), first, first + block.instanceCount);
+        this->batches.back().instanceCount += block.instanceCount;
+        this->batches.back().blockCount++;
+    }
+}
+
+void fuji::text::TextBatchQueue::clear() noexcept {
+    this->blocks.clear();
+    this->queuedInstances.clear();
+    this->instances.clear();
+    this->batches.clear();
+}
+
+bool fuji::text::TextBatchQueue::empty() const noexcept {
+    return this->blocks.empty();
+}
+
+std::size_t fuji::text::TextBatchQueue::getBlockCount() const noexcept {
+    return this->blocks.size();
+}
+
+const std::vector<fuji::text::TextBatch>& fuji::text::TextBatchQueue::getBatches() const noexcept {
+    return this->batches;
+}
+
+const std::vector<fuji::text::GlyphInstance>& fuji::text::TextBatchQueue::getInstances() const noexcept {
+    return this->instances;
+}
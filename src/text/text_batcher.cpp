@@ -0,0 +1,82 @@
+#include <fuji/text/text_batcher.hpp>
+
+#include <stdexcept>
+
+fuji::text::TextBatcher::TextBatcher(core::utility::MemoryAllocator& allocator, core::utility::FrameRing& frameRing, vk::DeviceSize instanceCapacity, std::uint32_t maxBatchCount, bool drawIndirectFirstInstance)
+        : drawIndirectFirstInstance(drawIndirectFirstInstance),
+          instanceBuffer(allocator, frameRing, instanceCapacity, vk::BufferUsageFlagBits::eVertexBuffer, sizeof(GlyphInstance)),
+          indirectBuffer(allocator, frameRing, sizeof(vk::DrawIndirectCommand) * maxBatchCount * frameRing.getFramesInFlight(), vk::BufferUsageFlagBits::eIndirectBuffer, 4) {
+
+}
+
+void fuji::text::TextBatcher::beginFrame() {
+    this->instanceBuffer.beginFrame();
+    this->indirectBuffer.beginFrame();
+    this->statistics = TextBatchStatistics {};
+}
+
+void fuji::text::TextBatcher::add(const TextBatchKey& key, glm::vec2 origin, const GlyphInstance* instances, std::uint32_t instanceCount) {
+    this->queue.add(key, origin, instances, instanceCount);
+}
+
+void fuji::text::TextBatcher::add(const TextBatchKey& key, glm::vec2 origin, const std::vector<GlyphInstance>& instances) {
+    this->queue.add(key, origin, instances);
+}
+
+void fuji::text::TextBatcher::record(vk::CommandBuffer& commandBuffer, const Bind& bind) {
+    if(this->queue.empty()) {
+        return;
+    }
+    this->queue.build();
+    const std::vector<TextBatch>& batches = this->queue.getBatches();
+    const std::vector<GlyphInstance>& instances = this->queue.getInstances();
+
+    auto instanceRange = this->instanceBuffer.write(instances.data(), sizeof(GlyphInstance) * instances.size(), sizeof(GlyphInstance));
+    if(!instanceRange) {
+        throw std::runtime_error("TextBatcher instance buffer is too small for the queued text");
+    }
+
+    this->commands.clear();
+    for(auto& batch : batches) {
+        std::uint32_t firstInstance = this->drawIndirectFirstInstance ? batch.firstInstance : 0;
+        this->commands.push_back(vk::DrawIndirectCommand { 4, batch.instanceCount, 0, firstInstance });
+    }
+    auto indirectRange = this->indirectBuffer.write(this->commands.data(), sizeof(vk::DrawIndirectCommand) * this->commands.size(), 4);
+    if(!indirectRange) {
+        throw std::runtime_error("TextBatcher indirect buffer is too small for the queued batches");
+    }
+
+    if(this->drawIndirectFirstInstance) {
+        commandBuffer.bindVertexBuffers(0, { instanceRange->buffer }, { instanceRange->offset });
+    }
+    for(std::size_t i = 0; i < batches.size(); i++) {
+        bind(commandBuffer, batches[i].key);
+        if(!this->drawIndirectFirstInstance) {
+            commandBuffer.bindVertexBuffers(0, { instanceRange->buffer }, { instanceRange->offset + sizeof(GlyphInstance) * batches[i].firstInstance });
+        }
+        commandBuffer.drawIndirect(indirectRange->buffer, indirectRange->offset + sizeof(vk::DrawIndirectCommand) * i, 1, sizeof(vk::DrawIndirectCommand));
+    }
+
+    this->statistics.blockCount += this->queue.getBlockCount();
+    this->statistics.batchCount += batches.size();
+    this->statistics.drawCallCount += batches.size();
+    this->statistics.instanceCount += instances.size();
+    this->queue.clear();
+}
+
+void fuji::text::TextBatcher::endFrame() {
+    this->instanceBuffer.endFrame();
+    this->indirectBuffer.endFrame();
+}
+
+const fuji::text::TextBatchStatistics& fuji::text::TextBatcher::getStatistics() const noexcept {
+    return this->statistics;
+}
+
+const std::vector<vk::DrawIndirectCommand>& fuji::text::TextBatcher::getDrawCommands() const noexcept {
+    return this->commands;
+}
+
+bool fuji::text::TextBatcher::isFirstInstanceSupported(const vk::PhysicalDevice& physicalDevice) {
+    return physicalDevice.getFeatures().drawIndirectFirstInstance;
+}
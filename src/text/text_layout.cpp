@@ -0,0 +1,267 @@
+#include <fuji/text/text_layout.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    bool isBreakingSpace(const std::string& text, std::uint32_t cluster) noexcept {
+        return cluster < text.size() && (text[cluster] == ' ' || text[cluster] == '\t');
+    }
+}
+
+fuji::text::TextLayout::TextLayout(Shape shaper, float lineHeight, float width, TextAlignment alignment)
+        : shaper(std::move(shaper)), lineHeight(lineHeight), width(width), alignment(alignment),
+          generation(1), widthGeneration(1), alignmentGeneration(1), allDirty(false) {
+    if(!this->shaper) {
+        throw std::invalid_argument("TextLayout requires a shaper");
+    }
+}
+
+void fuji::text::TextLayout::setText(std::string_view text) {
+    this->paragraphs.clear();
+    this->dirtyParagraphs.clear();
+    this->lineCounts.clear();
+    std::size_t begin = 0;
+    while(true) {
+        std::size_t end = text.find('\n', begin);
+        this->appendParagraph(text.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin));
+        if(end == std::string_view::npos) {
+            break;
+        }
+        begin = end + 1;
+    }
+}
+
+void fuji::text::TextLayout::setParagraph(std::size_t index, std::string_view text) {
+    ParagraphLayout& paragraph = this->paragraphs.at(index);
+    if(paragraph.text == text) {
+        return;
+    }
+    paragraph.text = std::string { text };
+    paragraph.generation = ++this->generation;
+    this->markDirty(index);
+}
+
+void fuji::text::TextLayout::insertParagraph(std::size_t index, std::string_view text) {
+    if(index > this->paragraphs.size()) {
+        throw std::out_of_range("TextLayout paragraph index out of range");
+    }
+    this->paragraphs.insert(this->paragraphs.begin() + index, this->createParagraph(text));
+    this->lineCounts.insert(index, 0);
+    for(auto& dirty : this->dirtyParagraphs) {
+        if(dirty >= index) {
+            dirty++;
+        }
+    }
+    this->markDirty(index);
+}
+
+void fuji::text::TextLayout::appendParagraph(std::string_view text) {
+    this->insertParagraph(this->paragraphs.size(), text);
+}
+
+void fuji::text::TextLayout::eraseParagraph(std::size_t index) {
+    if(index >= this->paragraphs.size()) {
+        throw std::out_of_range("TextLayout paragraph index out of range");
+    }
+    this->paragraphs.erase(this->paragraphs.begin() + index);
+    this->lineCounts.erase(index);
+    this->dirtyParagraphs.erase(std::remove(this->dirtyParagraphs.begin(), this->dirtyParagraphs.end(), index), this->dirtyParagraphs.end());
+    for(auto& dirty : this->dirtyParagraphs) {
+        if(dirty > index) {
+            dirty--;
+        }
+    }
+}
+
+void fuji::text::TextLayout::setWidth(float width) {
+    if(this->width == width) {
+        return;
+    }
+    this->width = width;
+    this->widthGeneration = ++this->generation;
+    this->allDirty = true;
+}
+
+void fuji::text::TextLayout::setAlignment(TextAlignment alignment) {
+    if(this->alignment == alignment) {
+        return;
+    }
+    this->alignment = alignment;
+    this->alignmentGeneration = ++this->generation;
+    this->allDirty = true;
+}
+
+std::size_t fuji::text::TextLayout::update() {
+    std::vector<std::size_t> indices;
+    if(this->allDirty) {
+        indices.resize(this->paragraphs.size());
+        for(std::size_t i = 0; i < indices.size(); i++) {
+            indices[i] = i;
+        }
+    } else {
+        indices = std::move(this->dirtyParagraphs);
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    }
+    this->dirtyParagraphs.clear();
+    this->allDirty = false;
+
+    std::size_t updatedCount = 0;
+    for(std::size_t index : indices) {
+        ParagraphLayout& paragraph = this->paragraphs[index];
+        bool reshape = paragraph.shapedGeneration != paragraph.generation;
+        bool rebreak = reshape || paragraph.brokenGeneration < this->widthGeneration;
+        bool realign = rebreak || paragraph.alignedGeneration < this->alignmentGeneration;
+        if(!realign) {
+            continue;
+        }
+        if(reshape) {
+            paragraph.run = this->shaper(paragraph.text);
+            paragraph.shapedGeneration = paragraph.generation;
+        }
+        if(rebreak) {
+            this->breakLines(paragraph);
+            paragraph.brokenGeneration = this->generation;
+            this->lineCounts.set(index, static_cast<std::int64_t>(paragraph.lines.size()));
+        }
+        this->alignLines(paragraph);
+        paragraph.alignedGeneration = this->generation;
+        updatedCount++;
+    }
+    return updatedCount;
+}
+
+std::size_t fuji::text::TextLayout::getParagraphCount() const noexcept {
+    return this->paragraphs.size();
+}
+
+const fuji::text::ParagraphLayout& fuji::text::TextLayout::getParagraph(std::size_t index) const {
+    return this->paragraphs.at(index);
+}
+
+float fuji::text::TextLayout::getParagraphTop(std::size_t index) const {
+    if(index > this->paragraphs.size()) {
+        throw std::out_of_range("TextLayout paragraph index out of range");
+    }
+    return static_cast<float>(this->lineCounts.prefixSum(index)) * this->lineHeight;
+}
+
+std::size_t fuji::text::TextLayout::findParagraph(float y) const noexcept {
+    if(this->paragraphs.empty() || y < 0.0f) {
+        return 0;
+    }
+    std::size_t index = this->lineCounts.upperBound(static_cast<std::int64_t>(std::floor(y / this->lineHeight)));
+    return std::min(index, this->paragraphs.size() - 1);
+}
+
+std::size_t fuji::text::TextLayout::getLineCount() const noexcept {
+    return static_cast<std::size_t>(this->lineCounts.total());
+}
+
+float fuji::text::TextLayout::getHeight() const noexcept {
+    return static_cast<float>(this->lineCounts.total()) * this->lineHeight;
+}
+
+float fuji::text::TextLayout::getLineHeight() const noexcept {
+    return this->lineHeight;
+}
+
+float fuji::text::TextLayout::getWidth() const noexcept {
+    return this->width;
+}
+
+fuji::text::TextAlignment fuji::text::TextLayout::getAlignment() const noexcept {
+    return this->alignment;
+}
+
+bool fuji::text::TextLayout::isDirty() const noexcept {
+    return this->allDirty || !this->dirtyParagraphs.empty();
+}
+
+fuji::text::ParagraphLayout fuji::text::TextLayout::createParagraph(std::string_view text) {
+    ParagraphLayout paragraph {};
+    paragraph.text = std::string { text };
+    paragraph.generation = ++this->generation;
+    return paragraph;
+}
+
+void fuji::text::TextLayout::markDirty(std::size_t index) noexcept {
+    if(!this->allDirty) {
+        this->dirtyParagraphs.push_back(index);
+    }
+}
+
+void fuji::text::TextLayout::breakLines(ParagraphLayout& paragraph) const {
+    paragraph.lines.clear();
+    const std::vector<ShapedGlyph>& glyphs = paragraph.run->glyphs;
+    std::uint32_t textSize = static_cast<std::uint32_t>(paragraph.text.size());
+    auto emit = [&paragraph, &glyphs, textSize](std::size_t first, std::size_t last, float lineWidth) {
+        LayoutLine line {};
+        line.firstGlyph = static_cast<std::uint32_t>(first);
+        line.glyphCount = static_cast<std::uint32_t>(last - first);
+        line.textBegin = first < glyphs.size() ? glyphs[first].cluster : textSize;
+        line.textEnd = last < glyphs.size() ? glyphs[last].cluster : textSize;
+        line.width = lineWidth;
+        paragraph.lines.push_back(line);
+    };
+
+    std::size_t lineStart = 0;
+    std::size_t breakAt = 0;
+    float lineAdvance = 0.0f;
+    float visibleAdvance = 0.0f;
+    float advanceAtBreak = 0.0f;
+    float visibleAtBreak = 0.0f;
+    for(std::size_t i = 0; i < glyphs.size(); i++) {
+        bool space = isBreakingSpace(paragraph.text, glyphs[i].cluster);
+        if(!space && i > lineStart && isBreakingSpace(paragraph.text, glyphs[i - 1].cluster)) {
+            breakAt = i;
+            advanceAtBreak = lineAdvance;
+            visibleAtBreak = visibleAdvance;
+        }
+        if(!space && i > lineStart && lineAdvance + glyphs[i].advance > this->width) {
+            if(breakAt > lineStart) {
+                emit(lineStart, breakAt, visibleAtBreak);
+                lineStart = breakAt;
+                lineAdvance -= advanceAtBreak;
+                visibleAdvance -= advanceAtBreak;
+            }
+            // the word carried over from the last space can still be too wide together with this glyph
+            if(i > lineStart && lineAdvance + glyphs[i].advance > this->width) {
+                emit(lineStart, i, visibleAdvance);
+                lineStart = i;
+                lineAdvance = 0.0f;
+                visibleAdvance = 0.0f;
+            }
+        }
+        lineAdvance += glyphs[i].advance;
+        if(!space) {
+            visibleAdvance = lineAdvance;
+        }
+    }
+    emit(lineStart, glyphs.size(), visibleAdvance);
+}
+
+void fuji::text::TextLayout::alignLines(ParagraphLayout& paragraph) const {
+    float reference = this->width;
+    if(!std::isfinite(reference)) {
+        reference = 0.0f;
+        for(auto& line : paragraph.lines) {
+            reference = std::max(reference, line.width);
+        }
+    }
+    for(auto& line : paragraph.lines) {
+        switch(this->alignment) {
+        case TextAlignment::eLeft:
+            line.x = 0.0f;
+            break;
+        case TextAlignment::eCenter:
+            line.x = (reference - line.width) * 0.5f;
+            break;
+        case TextAlignment::eRight:
+            line.x = reference - line.width;
+            break;
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/bindless_image_table.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_BindlessImageTableTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            vk::ApplicationInfo applicationInfo {};
+            applicationInfo.apiVersion = VK_API_VERSION_1_2;
+            this->instance = vk::createInstanceUnique(vk::InstanceCreateInfo { {}, &applicationInfo });
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            if(!BindlessImageTable::isSupported(this->physicalDevice)) {
+                GTEST_SKIP() << "descriptor indexing is not supported";
+            }
+
+            float priority = 1.0f;
+            vk::DeviceQueueCreateInfo queueInfo { {}, 0, 1, &priority };
+            vk::PhysicalDeviceDescriptorIndexingFeatures features = BindlessImageTable::getRequiredFeatures();
+            vk::DeviceCreateInfo deviceInfo { {}, queueInfo };
+            deviceInfo.pNext = &features;
+            this->device = this->physicalDevice.createDeviceUnique(deviceInfo);
+            this->allocator = std::make_unique<MemoryAllocator>(this->physicalDevice, this->device.get());
+
+            vk::ImageCreateInfo imageInfo {};
+            imageInfo.imageType = vk::ImageType::e2D;
+            imageInfo.extent = vk::Extent3D { 16, 16, 1 };
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = vk::Format::eR8Unorm;
+            imageInfo.tiling = vk::ImageTiling::eOptimal;
+            imageInfo.usage = vk::ImageUsageFlagBits::eSampled;
+            imageInfo.sharingMode = vk::SharingMode::eExclusive;
+            imageInfo.samples = vk::SampleCountFlagBits::e1;
+            this->image = this->allocator->createImage(imageInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+            vk::ImageViewCreateInfo viewInfo {};
+            viewInfo.image = this->image.image.get();
+            viewInfo.viewType = vk::ImageViewType::e2D;
+            viewInfo.format = imageInfo.format;
+            viewInfo.subresourceRange = vk::ImageSubresourceRange { vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 };
+            this->imageView = this->device->createImageViewUnique(viewInfo);
+        }
+        void TearDown() override {
+            imageView.reset();
+            image.image.reset();
+            image = AllocatedImage {};
+            allocator.reset();
+            device.reset();
+            instance.reset();
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+        std::unique_ptr<MemoryAllocator> allocator;
+        AllocatedImage image;
+        vk::UniqueImageView imageView;
+    };
+
+    TEST_F(Utility_BindlessImageTableTest, NormalCase_AddAndUpdate) {
+        BindlessImageTable table { physicalDevice, device.get(), 16 };
+        EXPECT_TRUE(table.getDescriptorSet());
+
+        std::vector<vk::ImageView> pages(3, imageView.get());
+        std::uint32_t first = table.add(pages);
+        std::uint32_t second = table.add(imageView.get());
+        EXPECT_EQ(0, first);
+        EXPECT_EQ(4, second);
+        EXPECT_EQ(4, table.getUsedCount());
+        EXPECT_EQ(5, table.getReservedCount());
+        EXPECT_NO_THROW(table.update(first + 1, imageView.get()));
+    }
+
+    TEST_F(Utility_BindlessImageTableTest, NormalCase_RangeIsRoundedUpToPowerOfTwo) {
+        BindlessImageTable table { physicalDevice, device.get(), 16 };
+        std::uint32_t first = table.add(std::vector<vk::ImageView>(5, imageView.get()));
+        EXPECT_EQ(5, table.getUsedCount());
+        EXPECT_EQ(8, table.getReservedCount());
+        EXPECT_EQ(8, table.add(imageView.get()));
+        EXPECT_THROW(table.update(first + 5, imageView.get()), std::invalid_argument);
+    }
+
+    TEST_F(Utility_BindlessImageTableTest, NormalCase_RemovedRangeIsRecycledAfterFrameCompletes) {
+        BindlessImageTable table { physicalDevice, device.get(), 4 };
+        table.beginFrame(1, 0);
+        std::uint32_t first = table.add(std::vector<vk::ImageView>(4, imageView.get()));
+        table.remove(first);
+        EXPECT_EQ(1, table.getPendingRemovalCount());
+        EXPECT_THROW(table.add(imageView.get()), std::runtime_error);
+
+        table.beginFrame(2, 0);
+        EXPECT_EQ(1, table.getPendingRemovalCount());
+        table.beginFrame(3, 1);
+        EXPECT_EQ(0, table.getPendingRemovalCount());
+        EXPECT_EQ(0, table.getUsedCount());
+        EXPECT_EQ(0, table.add(imageView.get()));
+    }
+
+    TEST_F(Utility_BindlessImageTableTest, AbnormalCase_InvalidArguments) {
+        EXPECT_THROW((BindlessImageTable { physicalDevice, device.get(), 12 }), std::invalid_argument);
+
+        BindlessImageTable table { physicalDevice, device.get(), 4 };
+        EXPECT_THROW(table.add(vk::ArrayProxy<const vk::ImageView> {}), std::invalid_argument);
+        EXPECT_THROW(table.update(4, imageView.get()), std::out_of_range);
+        EXPECT_THROW(table.update(0, imageView.get()), std::invalid_argument);
+    }
+
+    TEST_F(Utility_BindlessImageTableTest, AbnormalCase_CapacityExceedsDeviceLimits) {
+        std::uint32_t maxCapacity = BindlessImageTable::getMaxCapacity(physicalDevice);
+        EXPECT_GE(maxCapacity, 16);
+        std::uint32_t capacity = 1;
+        while(capacity <= maxCapacity && capacity < (1u << 31)) {
+            capacity <<= 1;
+        }
+        if(capacity <= maxCapacity) {
+            GTEST_SKIP() << "every power-of-two capacity is within the device limits";
+        }
+        EXPECT_THROW((BindlessImageTable { physicalDevice, device.get(), capacity }), std::invalid_argument);
+    }
+
+    TEST_F(Utility_BindlessImageTableTest, AbnormalCase_RemoveUnknownOrRemovedRange) {
+        BindlessImageTable table { physicalDevice, device.get(), 8 };
+        table.beginFrame(1, 0);
+        std::uint32_t first = table.add(std::vector<vk::ImageView>(2, imageView.get()));
+        EXPECT_THROW(table.remove(first + 1), std::invalid_argument);
+        EXPECT_THROW(table.remove(8), std::invalid_argument);
+
+        table.remove(first);
+        EXPECT_THROW(table.remove(first), std::invalid_argument);
+        EXPECT_THROW(table.update(first, imageView.get()), std::invalid_argument);
+        EXPECT_EQ(1, table.getPendingRemovalCount());
+        EXPECT_NO_THROW(table.beginFrame(2, 1));
+        EXPECT_EQ(0, table.getUsedCount());
+    }
+}
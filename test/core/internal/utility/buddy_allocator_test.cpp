@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <fuji/core/internal/utility/buddy_allocator.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    TEST(Utility_BuddyAllocatorTest, NormalCase_SplitAndMerge) {
+        BuddyAllocator allocator { 1024, 64 };
+
+        auto first = allocator.allocate(100);
+        auto second = allocator.allocate(64);
+        ASSERT_TRUE(first.has_value());
+        ASSERT_TRUE(second.has_value());
+        EXPECT_EQ(0, first.value());
+        EXPECT_EQ(128, second.value());
+        EXPECT_EQ(192, allocator.getAllocatedBytes());
+        EXPECT_EQ(164, allocator.getRequestedBytes());
+        EXPECT_EQ(512, allocator.getLargestFreeBlock());
+
+        allocator.free(first.value());
+        allocator.free(second.value());
+        EXPECT_TRUE(allocator.isEmpty());
+        EXPECT_EQ(1024, allocator.getLargestFreeBlock());
+    }
+
+    TEST(Utility_BuddyAllocatorTest, NormalCase_Alignment) {
+        BuddyAllocator allocator { 1024, 64 };
+
+        allocator.allocate(64);
+        auto aligned = allocator.allocate(64, 256);
+        ASSERT_TRUE(aligned.has_value());
+        EXPECT_EQ(0, aligned.value() % 256);
+    }
+
+    TEST(Utility_BuddyAllocatorTest, AbnormalCase_OutOfMemory) {
+        BuddyAllocator allocator { 256, 64 };
+
+        EXPECT_TRUE(allocator.allocate(256).has_value());
+        EXPECT_FALSE(allocator.allocate(64).has_value());
+        EXPECT_FALSE(allocator.allocate(512).has_value());
+        EXPECT_THROW(allocator.free(64), std::invalid_argument);
+    }
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/compute_pipeline_create_info_template.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_ComputePipelineCreateInfoTemplateTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            vk::PhysicalDevice physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            this->device = physicalDevice.createDeviceUnique({});
+
+            vk::DescriptorSetLayoutBinding binding { 0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute };
+            this->descriptorSetLayout = this->device->createDescriptorSetLayoutUnique(vk::DescriptorSetLayoutCreateInfo { {}, binding });
+            this->pipelineLayout = this->device->createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo { {}, this->descriptorSetLayout.get() });
+        }
+        void TearDown() override {
+            pipelineLayout.reset();
+            descriptorSetLayout.reset();
+            device.reset();
+            instance.reset();
+        }
+
+        std::vector<char> readCode(const char* path) {
+            std::ifstream fin { path, std::ios::in | std::ios::binary };
+            return std::vector<char> { std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {} };
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::UniqueDevice device;
+        vk::UniqueDescriptorSetLayout descriptorSetLayout;
+        vk::UniquePipelineLayout pipelineLayout;
+    };
+
+    TEST_F(Utility_ComputePipelineCreateInfoTemplateTest, NormalCase_CreatePipeline) {
+        ShaderModule shaderModule { device.get(), readCode(TEST_COMP_SPV_FILE), vk::ShaderStageFlagBits::eCompute };
+        auto createInfoTemplate = std::make_unique<ComputePipelineCreateInfoTemplate>(shaderModule, pipelineLayout.get());
+
+        vk::ComputePipelineCreateInfo createInfo = createInfoTemplate->getCreateInfo();
+        EXPECT_EQ(vk::ShaderStageFlagBits::eCompute, createInfo.stage.stage);
+        EXPECT_STREQ("main", createInfo.stage.pName);
+        EXPECT_EQ(nullptr, createInfo.stage.pSpecializationInfo);
+        EXPECT_EQ(pipelineLayout.get(), createInfo.layout);
+
+        vk::Device handle = device.get();
+        auto pipelines = ComputePipelineCreateInfoTemplate::createComputePipeline(handle, createInfoTemplate);
+        ASSERT_EQ(1, pipelines.size());
+        EXPECT_TRUE(pipelines[0]);
+    }
+
+    TEST_F(Utility_ComputePipelineCreateInfoTemplateTest, NormalCase_SpecializationConstants) {
+        ShaderModule shaderModule { device.get(), readCode(TEST_COMP_SPV_FILE), vk::ShaderStageFlagBits::eCompute };
+        auto createInfoTemplate = std::make_unique<ComputePipelineCreateInfoTemplate>(shaderModule, pipelineLayout.get());
+
+        SpecializationConstants constants;
+        constants.set(0, std::uint32_t { 3 });
+        createInfoTemplate->setSpecializationConstants(constants);
+
+        vk::ComputePipelineCreateInfo createInfo = createInfoTemplate->getCreateInfo();
+        ASSERT_NE(nullptr, createInfo.stage.pSpecializationInfo);
+        EXPECT_EQ(1, createInfo.stage.pSpecializationInfo->mapEntryCount);
+        EXPECT_TRUE(constants == createInfoTemplate->getSpecializationConstants());
+
+        vk::Device handle = device.get();
+        auto pipelines = ComputePipelineCreateInfoTemplate::createComputePipeline(handle, createInfoTemplate);
+        EXPECT_EQ(1, pipelines.size());
+    }
+
+    TEST_F(Utility_ComputePipelineCreateInfoTemplateTest, AbnormalCase_NonComputeModuleThrowError) {
+        ShaderModule shaderModule { device.get(), readCode(TEST_VERT_SPV_FILE), vk::ShaderStageFlagBits::eVertex };
+        EXPECT_THROW(ComputePipelineCreateInfoTemplate(shaderModule, pipelineLayout.get()), std::invalid_argument);
+    }
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/dynamic_state.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    TEST(Utility_DynamicStateTest, NormalCase_ViewportAndScissorOnly) {
+        std::vector<vk::DynamicState> expected { vk::DynamicState::eViewport, vk::DynamicState::eScissor };
+        EXPECT_EQ(expected, DynamicStateRecorder::getDynamicStates(DynamicStateSupport { false, false }));
+    }
+
+    TEST(Utility_DynamicStateTest, NormalCase_ExtendedDynamicState) {
+        std::vector<vk::DynamicState> expected {
+            vk::DynamicState::eViewport,
+            vk::DynamicState::eScissor,
+            vk::DynamicState::eCullMode,
+            vk::DynamicState::eFrontFace,
+            vk::DynamicState::ePrimitiveTopology
+        };
+        EXPECT_EQ(expected, DynamicStateRecorder::getDynamicStates(DynamicStateSupport { true, false }));
+    }
+
+    TEST(Utility_DynamicStateTest, NormalCase_ColorBlendEnable) {
+        std::vector<vk::DynamicState> expected {
+            vk::DynamicState::eViewport,
+            vk::DynamicState::eScissor,
+            vk::DynamicState::eColorBlendEnableEXT
+        };
+        EXPECT_EQ(expected, DynamicStateRecorder::getDynamicStates(DynamicStateSupport { false, true }));
+    }
+
+    TEST(Utility_DynamicStateTest, NormalCase_AllDynamicStates) {
+        std::vector<vk::DynamicState> expected {
+            vk::DynamicState::eViewport,
+            vk::DynamicState::eScissor,
+            vk::DynamicState::eCullMode,
+            vk::DynamicState::eFrontFace,
+            vk::DynamicState::ePrimitiveTopology,
+            vk::DynamicState::eColorBlendEnableEXT
+        };
+        EXPECT_EQ(expected, DynamicStateRecorder::getDynamicStates(DynamicStateSupport { true, true }));
+    }
+
+    TEST(Utility_DynamicStateTest, NormalCase_DefaultsMatchPipelineTemplate) {
+        DynamicStateValues values {};
+        EXPECT_EQ(vk::PrimitiveTopology::eTriangleList, values.primitiveTopology);
+        EXPECT_EQ(vk::CullModeFlags { vk::CullModeFlagBits::eNone }, values.cullMode);
+        EXPECT_EQ(vk::FrontFace::eCounterClockwise, values.frontFace);
+        EXPECT_FALSE(values.blendEnable);
+    }
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/frame_ring.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_FrameRingTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            vk::PhysicalDevice physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            float priority = 1.0f;
+            vk::DeviceQueueCreateInfo queueInfo { {}, 0, 1, &priority };
+            this->device = physicalDevice.createDeviceUnique(vk::DeviceCreateInfo { {}, queueInfo });
+            this->queue = this->device->getQueue(0, 0);
+        }
+        void TearDown() override {
+            device.reset();
+            instance.reset();
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::UniqueDevice device;
+        vk::Queue queue;
+    };
+
+    TEST_F(Utility_FrameRingTest, NormalCase_SubmitAndWait) {
+        FrameRing frameRing { device.get(), 0, 2 };
+        FrameSlot& slot = frameRing.acquire();
+        EXPECT_EQ(1, slot.frameNumber);
+        frameRing.submit(queue);
+        frameRing.wait(1);
+        EXPECT_TRUE(frameRing.isComplete(1));
+        EXPECT_EQ(1, frameRing.getCompletedFrameNumber());
+
+        frameRing.acquire();
+        frameRing.submit(queue);
+        frameRing.waitIdle();
+        EXPECT_EQ(2, frameRing.getCompletedFrameNumber());
+    }
+
+    TEST_F(Utility_FrameRingTest, AbnormalCase_AcquireTwiceWithoutSubmit) {
+        FrameRing frameRing { device.get(), 0, 1 };
+        frameRing.acquire();
+        FrameSlot& slot = frameRing.acquire();
+        EXPECT_EQ(2, slot.frameNumber);
+        EXPECT_EQ(vk::Result::eSuccess, device->getFenceStatus(slot.inFlightFence.get()));
+
+        frameRing.waitIdle();
+        EXPECT_EQ(2, frameRing.getCompletedFrameNumber());
+
+        frameRing.submit(queue);
+        frameRing.waitIdle();
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef TEST_CORE_INTERNAL_UTILITY_GRAPHICS_PIPELINE_FIXTURE_HPP
+#define TEST_CORE_INTERNAL_UTILITY_GRAPHICS_PIPELINE_FIXTURE_HPP
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/graphics_pipeline_create_info_template.hpp>
+#include <fuji/core/internal/utility/shader_module.hpp>
+#include <fuji/core/internal/utility/shader_stage_flow.hpp>
+#include <fuji/core/internal/utility/specialization_constants.hpp>
+#include <fuji/core/internal/utility/vertex_shader_input_layout.hpp>
+
+namespace fuji::test {
+    // a device, a single-subpass R8G8B8A8 render pass and a pipeline layout for test.vert + specialized.frag
+    class GraphicsPipelineFixture : public testing::Test {
+    protected:
+        struct Vertex {
+            glm::vec2 pos;
+            glm::vec2 coord;
+        };
+
+        struct Instance {
+            glm::mat4 model;
+        };
+
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            this->device = this->physicalDevice.createDeviceUnique({});
+
+            vk::AttachmentDescription colorAttachment {};
+            colorAttachment.format = vk::Format::eR8G8B8A8Unorm;
+            colorAttachment.samples = vk::SampleCountFlagBits::e1;
+            colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+            colorAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+            colorAttachment.initialLayout = vk::ImageLayout::eUndefined;
+            colorAttachment.finalLayout = vk::ImageLayout::eTransferSrcOptimal;
+            vk::AttachmentReference colorAttachmentRef { 0, vk::ImageLayout::eColorAttachmentOptimal };
+            vk::SubpassDescription subpass {};
+            subpass.pipelineBindPoint = vk::PipelineBindPoint::eGraphics;
+            subpass.colorAttachmentCount = 1;
+            subpass.pColorAttachments = &colorAttachmentRef;
+            this->renderPass = this->device->createRenderPassUnique(vk::RenderPassCreateInfo { {}, colorAttachment, subpass });
+
+            vk::DescriptorSetLayoutBinding binding { 0, vk::DescriptorType::eCombinedImageSampler, 1, vk::ShaderStageFlagBits::eFragment };
+            this->descriptorSetLayout = this->device->createDescriptorSetLayoutUnique(vk::DescriptorSetLayoutCreateInfo { {}, binding });
+            this->pipelineLayout = this->device->createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo { {}, this->descriptorSetLayout.get() });
+        }
+        void TearDown() override {
+            pipelineLayout.reset();
+            descriptorSetLayout.reset();
+            renderPass.reset();
+            device.reset();
+            instance.reset();
+        }
+
+        static std::vector<char> readCode(const char* path) {
+            std::ifstream fin { path, std::ios::in | std::ios::binary };
+            return std::vector<char> { std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {} };
+        }
+
+        std::unique_ptr<core::utility::GraphicsPipelineCreateInfoTemplate> createTemplate(const core::utility::SpecializationConstants& constants = {}) {
+            using namespace fuji::core::utility;
+            std::vector<ShaderModule> shaderModules;
+            shaderModules.emplace_back(this->device.get(), readCode(TEST_VERT_SPV_FILE), vk::ShaderStageFlagBits::eVertex);
+            shaderModules.emplace_back(this->device.get(), readCode(SPECIALIZED_FRAG_SPV_FILE), vk::ShaderStageFlagBits::eFragment);
+            auto shaderStageFlow = std::make_unique<ShaderStageFlow>(
+                std::move(shaderModules),
+                VertexShaderInputLayout {
+                    {
+                        Binding { vk::VertexInputRate::eVertex, &Vertex::pos, &Vertex::coord },
+                        Binding { vk::VertexInputRate::eInstance, &Instance::model },
+                    }
+                });
+            if(!constants.empty()) {
+                shaderStageFlow->setSpecializationConstants(vk::ShaderStageFlagBits::eFragment, constants);
+            }
+
+            auto createInfoTemplate = std::make_unique<GraphicsPipelineCreateInfoTemplate>(std::move(shaderStageFlow));
+            createInfoTemplate->setPipelineLayout(this->pipelineLayout.get());
+            createInfoTemplate->setRenderPass(this->renderPass.get());
+            return createInfoTemplate;
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+        vk::UniqueRenderPass renderPass;
+        vk::UniqueDescriptorSetLayout descriptorSetLayout;
+        vk::UniquePipelineLayout pipelineLayout;
+    };
+}
+
+#endif
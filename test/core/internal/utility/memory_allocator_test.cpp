@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    constexpr vk::DeviceSize blockSize = 1024 * 1024;
+
+    class Utility_MemoryAllocatorTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            this->device = this->physicalDevice.createDeviceUnique({});
+        }
+        void TearDown() override {
+            device.reset();
+            instance.reset();
+        }
+
+        vk::BufferCreateInfo createBufferInfo(vk::DeviceSize size) {
+            vk::BufferCreateInfo bufferInfo {};
+            bufferInfo.size = size;
+            bufferInfo.usage = vk::BufferUsageFlagBits::eTransferSrc;
+            bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+            return bufferInfo;
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+    };
+
+    TEST_F(Utility_MemoryAllocatorTest, NormalCase_SubAllocateFromBlock) {
+        MemoryAllocator allocator { physicalDevice, device.get(), blockSize };
+        {
+            AllocatedBuffer first = allocator.createBuffer(createBufferInfo(1024), vk::MemoryPropertyFlagBits::eHostVisible);
+            AllocatedBuffer second = allocator.createBuffer(createBufferInfo(1024), vk::MemoryPropertyFlagBits::eHostVisible);
+            EXPECT_FALSE(first.allocation->dedicated);
+            EXPECT_EQ(first.allocation->memory, second.allocation->memory);
+            EXPECT_NE(first.allocation->offset, second.allocation->offset);
+            EXPECT_NE(nullptr, first.allocation->mappedData);
+
+            MemoryStatistics statistics = allocator.getStatistics(first.allocation->memoryType);
+            EXPECT_EQ(1, statistics.blockCount);
+            EXPECT_EQ(2, statistics.allocationCount);
+            EXPECT_EQ(blockSize, statistics.reservedBytes);
+            EXPECT_EQ(2048, statistics.usedBytes);
+        }
+        MemoryStatistics statistics = allocator.getStatistics();
+        EXPECT_EQ(1, statistics.blockCount);
+        EXPECT_EQ(0, statistics.allocationCount);
+    }
+
+    TEST_F(Utility_MemoryAllocatorTest, NormalCase_DedicatedAllocation) {
+        MemoryAllocator allocator { physicalDevice, device.get(), blockSize };
+        {
+            AllocatedBuffer buffer = allocator.createBuffer(createBufferInfo(blockSize), vk::MemoryPropertyFlagBits::eHostVisible);
+            EXPECT_TRUE(buffer.allocation->dedicated);
+            EXPECT_EQ(0, buffer.allocation->offset);
+            EXPECT_EQ(1, allocator.getStatistics().allocationCount);
+        }
+        EXPECT_EQ(0, allocator.getStatistics().blockCount);
+    }
+
+    TEST_F(Utility_MemoryAllocatorTest, NormalCase_FreeFromUnknownPool) {
+        MemoryAllocator allocator { physicalDevice, device.get(), blockSize };
+        Allocation allocation {};
+        allocation.tiling = ResourceTiling::eOptimal;
+        EXPECT_NO_THROW(allocator.free(allocation));
+        EXPECT_EQ(0, allocator.getStatistics().blockCount);
+    }
+
+    TEST_F(Utility_MemoryAllocatorTest, AbnormalCase_InvalidBlockSize) {
+        EXPECT_THROW((MemoryAllocator { physicalDevice, device.get(), 1000 * 1000 }), std::invalid_argument);
+        EXPECT_THROW((MemoryAllocator { physicalDevice, device.get(), 128 }), std::invalid_argument);
+    }
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_type.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    vk::PhysicalDeviceMemoryProperties createMemoryProperties() {
+        vk::PhysicalDeviceMemoryProperties memoryProperties {};
+        memoryProperties.memoryTypeCount = 3;
+        memoryProperties.memoryTypes[0].propertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal;
+        memoryProperties.memoryTypes[1].propertyFlags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+        memoryProperties.memoryTypes[2].propertyFlags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCached;
+        return memoryProperties;
+    }
+
+    TEST(Utility_MemoryTypeTest, NormalCase_RequiredProperties) {
+        auto memoryProperties = createMemoryProperties();
+        EXPECT_EQ(0, findMemoryType(memoryProperties, 0b111, vk::MemoryPropertyFlagBits::eDeviceLocal).value());
+        EXPECT_EQ(1, findMemoryType(memoryProperties, 0b111, vk::MemoryPropertyFlagBits::eHostVisible).value());
+    }
+
+    TEST(Utility_MemoryTypeTest, NormalCase_PreferredProperties) {
+        auto memoryProperties = createMemoryProperties();
+        EXPECT_EQ(2, findMemoryType(memoryProperties, 0b111, vk::MemoryPropertyFlagBits::eHostVisible, vk::MemoryPropertyFlagBits::eHostCached).value());
+        EXPECT_EQ(1, findMemoryType(memoryProperties, 0b011, vk::MemoryPropertyFlagBits::eHostVisible, vk::MemoryPropertyFlagBits::eHostCached).value());
+    }
+
+    TEST(Utility_MemoryTypeTest, AbnormalCase_NoSuitableType) {
+        auto memoryProperties = createMemoryProperties();
+        EXPECT_FALSE(findMemoryType(memoryProperties, 0b001, vk::MemoryPropertyFlagBits::eHostVisible).has_value());
+        EXPECT_THROW(requireMemoryType(memoryProperties, 0b001, vk::MemoryPropertyFlagBits::eHostVisible), std::runtime_error);
+    }
+}
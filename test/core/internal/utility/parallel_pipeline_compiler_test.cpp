@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/parallel_pipeline_compiler.hpp>
+
+#include "graphics_pipeline_fixture.hpp"
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_ParallelPipelineCompilerTest : public fuji::test::GraphicsPipelineFixture {
+    };
+
+    TEST_F(Utility_ParallelPipelineCompilerTest, NormalCase_CompileVariants) {
+        constexpr std::uint32_t variantCount = 6;
+        PipelineCache pipelineCache { device.get() };
+        vk::Device handle = device.get();
+        ParallelPipelineCompiler compiler { handle, pipelineCache, 3 };
+        EXPECT_EQ(3, compiler.getWorkerCount());
+
+        std::vector<std::unique_ptr<GraphicsPipelineCreateInfoTemplate>> createInfoTemplates;
+        for(std::uint32_t i = 0; i < variantCount; i++) {
+            SpecializationConstants constants;
+            constants.set(0, i);
+            createInfoTemplates.push_back(createTemplate(constants));
+        }
+        auto futures = compiler.compile(std::move(createInfoTemplates));
+        ASSERT_EQ(variantCount, futures.size());
+
+        std::vector<vk::UniquePipeline> pipelines;
+        for(auto& future : futures) {
+            pipelines.push_back(future.get());
+            EXPECT_TRUE(pipelines.back());
+        }
+        compiler.wait();
+        EXPECT_EQ(variantCount, pipelineCache.getHitCount() + pipelineCache.getMissCount());
+    }
+}
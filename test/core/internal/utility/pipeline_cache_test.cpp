@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/pipeline_cache.hpp>
+#include <fuji/core/internal/utility/shader_module.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_PipelineCacheTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            this->device = this->physicalDevice.createDeviceUnique({});
+            this->filePath = std::filesystem::temp_directory_path() / "fuji_pipeline_cache_test.bin";
+            std::filesystem::remove(this->filePath);
+        }
+        void TearDown() override {
+            std::filesystem::remove(this->filePath);
+            device.reset();
+            instance.reset();
+        }
+
+        std::vector<char> readCode(const char* path) {
+            std::ifstream fin { path, std::ios::in | std::ios::binary };
+            return std::vector<char> { std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {} };
+        }
+
+        void createComputePipeline(PipelineCache& pipelineCache) {
+            vk::DescriptorSetLayoutBinding binding { 0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute };
+            vk::UniqueDescriptorSetLayout descriptorSetLayout = this->device->createDescriptorSetLayoutUnique(vk::DescriptorSetLayoutCreateInfo { {}, binding });
+            vk::UniquePipelineLayout pipelineLayout = this->device->createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo { {}, descriptorSetLayout.get() });
+            ShaderModule shaderModule { this->device.get(), readCode(TEST_COMP_SPV_FILE), vk::ShaderStageFlagBits::eCompute };
+
+            std::vector<vk::ComputePipelineCreateInfo> createInfos {
+                vk::ComputePipelineCreateInfo { {}, vk::PipelineShaderStageCreateInfo { {}, vk::ShaderStageFlagBits::eCompute, shaderModule.getHandle(), "main" }, pipelineLayout.get() }
+            };
+            auto pipelines = pipelineCache.createPipelines(this->device.get(), createInfos);
+            ASSERT_EQ(1, pipelines.size());
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+        std::filesystem::path filePath;
+    };
+
+    TEST_F(Utility_PipelineCacheTest, NormalCase_SaveAndReload) {
+        {
+            PipelineCache pipelineCache { physicalDevice, device.get(), filePath };
+            EXPECT_FALSE(pipelineCache.isLoadedFromFile());
+            EXPECT_NO_THROW(pipelineCache.save());
+        }
+        EXPECT_TRUE(std::filesystem::exists(filePath));
+
+        PipelineCache pipelineCache { physicalDevice, device.get(), filePath };
+        EXPECT_TRUE(pipelineCache.isLoadedFromFile());
+        EXPECT_EQ(0, pipelineCache.getHitCount());
+        EXPECT_EQ(0, pipelineCache.getMissCount());
+    }
+
+    TEST_F(Utility_PipelineCacheTest, NormalCase_WarmStartHitsCache) {
+        {
+            PipelineCache pipelineCache { physicalDevice, device.get(), filePath };
+            createComputePipeline(pipelineCache);
+            EXPECT_EQ(1, pipelineCache.getHitCount() + pipelineCache.getMissCount());
+            pipelineCache.save();
+        }
+
+        PipelineCache pipelineCache { physicalDevice, device.get(), filePath };
+        ASSERT_TRUE(pipelineCache.isLoadedFromFile());
+        createComputePipeline(pipelineCache);
+        EXPECT_EQ(1, pipelineCache.getHitCount());
+        EXPECT_EQ(0, pipelineCache.getMissCount());
+    }
+
+    TEST_F(Utility_PipelineCacheTest, AbnormalCase_CorruptedFileIsIgnored) {
+        {
+            std::ofstream fout { filePath, std::ios::binary };
+            fout << "not a pipeline cache";
+        }
+
+        PipelineCache pipelineCache { physicalDevice, device.get(), filePath };
+        EXPECT_FALSE(pipelineCache.isLoadedFromFile());
+        EXPECT_TRUE(pipelineCache.getHandle());
+    }
+
+    TEST_F(Utility_PipelineCacheTest, AbnormalCase_SaveWithoutPathThrowError) {
+        PipelineCache pipelineCache { physicalDevice, device.get(), std::filesystem::path {} };
+        EXPECT_THROW(pipelineCache.save(), std::logic_error);
+    }
+
+    TEST_F(Utility_PipelineCacheTest, NormalCase_TransientCache) {
+        PipelineCache pipelineCache { device.get() };
+        EXPECT_TRUE(pipelineCache.getHandle());
+        EXPECT_FALSE(pipelineCache.isLoadedFromFile());
+        EXPECT_THROW(pipelineCache.save(), std::logic_error);
+    }
+}
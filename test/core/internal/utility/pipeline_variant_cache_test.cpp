@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/pipeline_variant_cache.hpp>
+
+#include "graphics_pipeline_fixture.hpp"
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_PipelineVariantCacheTest : public fuji::test::GraphicsPipelineFixture {
+    };
+
+    TEST_F(Utility_PipelineVariantCacheTest, NormalCase_VariantsAreBuiltOnce) {
+        enum class GlyphMode : std::uint32_t { Bitmap, Sdf };
+        PipelineCache pipelineCache { device.get() };
+        vk::Device handle = device.get();
+        std::uint32_t factoryCallCount = 0;
+        PipelineVariantCache variantCache { handle, pipelineCache, [this, &factoryCallCount] {
+            factoryCallCount++;
+            return this->createTemplate();
+        } };
+
+        SpecializationConstants bitmap;
+        bitmap.set(0, GlyphMode::Bitmap).set(1, true);
+        SpecializationConstants sdf;
+        sdf.set(1, true).set(0, GlyphMode::Sdf);
+
+        vk::Pipeline first = variantCache.get(bitmap);
+        vk::Pipeline second = variantCache.get(sdf);
+        EXPECT_TRUE(first);
+        EXPECT_TRUE(second);
+        EXPECT_NE(first, second);
+
+        SpecializationConstants reordered;
+        reordered.set(1, true).set(0, GlyphMode::Bitmap);
+        EXPECT_EQ(first, variantCache.get(reordered));
+        EXPECT_EQ(2, variantCache.size());
+        EXPECT_EQ(2, factoryCallCount);
+        EXPECT_EQ(1, variantCache.getHitCount());
+        EXPECT_EQ(2, variantCache.getMissCount());
+    }
+
+    TEST_F(Utility_PipelineVariantCacheTest, NormalCase_ConcurrentRequestsShareOneCompile) {
+        PipelineCache pipelineCache { device.get() };
+        vk::Device handle = device.get();
+        std::atomic<std::uint32_t> factoryCallCount { 0 };
+        PipelineVariantCache variantCache { handle, pipelineCache, [this, &factoryCallCount] {
+            factoryCallCount++;
+            return this->createTemplate();
+        } };
+
+        SpecializationConstants constants;
+        constants.set(0, std::uint8_t { 1 });
+        std::vector<vk::Pipeline> results(4);
+        std::vector<std::thread> threads;
+        for(std::size_t i = 0; i < results.size(); i++) {
+            threads.emplace_back([&variantCache, &constants, &results, i] { results[i] = variantCache.get(constants); });
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+
+        for(auto& result : results) {
+            EXPECT_TRUE(result);
+            EXPECT_EQ(results[0], result);
+        }
+        EXPECT_EQ(1, factoryCallCount.load());
+        EXPECT_EQ(1, variantCache.size());
+        EXPECT_EQ(1, variantCache.getMissCount());
+        EXPECT_EQ(3, variantCache.getHitCount());
+    }
+}
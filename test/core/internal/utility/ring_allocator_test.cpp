@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <fuji/core/internal/utility/ring_allocator.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    TEST(Utility_RingAllocatorTest, NormalCase_ReleaseCompletedFrames) {
+        RingAllocator allocator { 256 };
+
+        EXPECT_EQ(0, allocator.allocate(100).value());
+        allocator.endFrame(1);
+        EXPECT_EQ(128, allocator.allocate(100, 64).value());
+        allocator.endFrame(2);
+        EXPECT_EQ(228, allocator.getUsedBytes());
+
+        allocator.release(1);
+        EXPECT_EQ(128, allocator.getUsedBytes());
+        allocator.release(2);
+        EXPECT_EQ(0, allocator.getUsedBytes());
+    }
+
+    TEST(Utility_RingAllocatorTest, NormalCase_WrapAround) {
+        RingAllocator allocator { 256 };
+
+        allocator.allocate(128);
+        allocator.endFrame(1);
+        allocator.allocate(96);
+        allocator.endFrame(2);
+        allocator.release(1);
+
+        auto wrapped = allocator.allocate(100);
+        ASSERT_TRUE(wrapped.has_value());
+        EXPECT_EQ(0, wrapped.value());
+        EXPECT_EQ(96 + 32 + 100, allocator.getUsedBytes());
+    }
+
+    TEST(Utility_RingAllocatorTest, AbnormalCase_Full) {
+        RingAllocator allocator { 256 };
+
+        allocator.allocate(200);
+        allocator.endFrame(1);
+        EXPECT_FALSE(allocator.allocate(100).has_value());
+        EXPECT_FALSE(allocator.allocate(512).has_value());
+
+        allocator.release(1);
+        EXPECT_TRUE(allocator.allocate(100).has_value());
+    }
+
+    TEST(Utility_RingAllocatorTest, NormalCase_OldestFrameNumber) {
+        RingAllocator allocator { 256 };
+        EXPECT_FALSE(allocator.getOldestFrameNumber().has_value());
+
+        allocator.allocate(64);
+        allocator.endFrame(3);
+        allocator.allocate(64);
+        allocator.endFrame(4);
+        EXPECT_EQ(3, allocator.getOldestFrameNumber().value());
+
+        allocator.release(3);
+        EXPECT_EQ(4, allocator.getOldestFrameNumber().value());
+        allocator.release(4);
+        EXPECT_FALSE(allocator.getOldestFrameNumber().has_value());
+    }
+}
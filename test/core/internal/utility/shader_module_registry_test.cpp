@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/mapped_file.hpp>
+#include <fuji/core/internal/utility/shader_module_registry.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_ShaderModuleRegistryTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            vk::PhysicalDevice physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            this->device = physicalDevice.createDeviceUnique({});
+        }
+        void TearDown() override {
+            device.reset();
+            instance.reset();
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::UniqueDevice device;
+    };
+
+    TEST_F(Utility_ShaderModuleRegistryTest, NormalCase_IdenticalCodeSharesHandle) {
+        ShaderModuleRegistry registry { device.get() };
+
+        MappedFile file { TEST_VERT_SPV_FILE };
+        std::vector<std::uint32_t> code(file.getSize() / sizeof(std::uint32_t));
+        std::memcpy(code.data(), file.getData(), file.getSize());
+
+        ShaderModule fromFile = registry.acquire(TEST_VERT_SPV_FILE, vk::ShaderStageFlagBits::eVertex);
+        ShaderModule fromWords = registry.acquire(vk::ArrayProxy<const std::uint32_t> { code }, vk::ShaderStageFlagBits::eVertex);
+
+        EXPECT_EQ(fromFile.getHandle(), fromWords.getHandle());
+        EXPECT_EQ(1, registry.size());
+    }
+
+    TEST_F(Utility_ShaderModuleRegistryTest, NormalCase_DifferentCodeHasDifferentHandle) {
+        ShaderModuleRegistry registry { device.get() };
+
+        ShaderModule vertex = registry.acquire(TEST_VERT_SPV_FILE, vk::ShaderStageFlagBits::eVertex);
+        ShaderModule fragment = registry.acquire(TEST_FRAG_SPV_FILE, vk::ShaderStageFlagBits::eFragment);
+
+        EXPECT_NE(vertex.getHandle(), fragment.getHandle());
+        EXPECT_EQ(2, registry.size());
+    }
+
+    TEST_F(Utility_ShaderModuleRegistryTest, NormalCase_ReleasedModuleIsForgotten) {
+        ShaderModuleRegistry registry { device.get() };
+        {
+            ShaderModule vertex = registry.acquire(TEST_VERT_SPV_FILE, vk::ShaderStageFlagBits::eVertex);
+            EXPECT_EQ(1, registry.size());
+        }
+        EXPECT_EQ(0, registry.size());
+    }
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iterator>
 #include <stdexcept>
@@ -33,8 +35,25 @@ namespace {
         EXPECT_NO_THROW(ShaderModule shaderModule(device.get(), code, vk::ShaderStageFlagBits::eVertex));
     }
 
+    TEST_F(Utility_ShaderModuleTest, NormalCase_MappedFileNothrow) {
+        MappedFile file { TEST_VERT_SPV_FILE };
+        EXPECT_NO_THROW(ShaderModule shaderModule(device.get(), file, vk::ShaderStageFlagBits::eVertex));
+    }
+
+    TEST_F(Utility_ShaderModuleTest, NormalCase_SpirvWordsNothrow) {
+        MappedFile file { TEST_VERT_SPV_FILE };
+        std::vector<std::uint32_t> code(file.getSize() / sizeof(std::uint32_t));
+        std::memcpy(code.data(), file.getData(), file.getSize());
+        EXPECT_NO_THROW(ShaderModule shaderModule(device.get(), vk::ArrayProxy<const std::uint32_t> { code }, vk::ShaderStageFlagBits::eVertex));
+    }
+
     TEST_F(Utility_ShaderModuleTest, AbnormalCase_InvalidCodeThrowError) {
         std::vector<char> code { };
         EXPECT_THROW(ShaderModule shaderModule(device.get(), code, vk::ShaderStageFlagBits::eVertex), std::runtime_error);
     }
+
+    TEST_F(Utility_ShaderModuleTest, AbnormalCase_InvalidMagicNumberThrowError) {
+        std::vector<char> code(16, 0);
+        EXPECT_THROW(ShaderModule shaderModule(device.get(), code, vk::ShaderStageFlagBits::eVertex), std::runtime_error);
+    }
 }
\ No newline at end of file
@@ -63,7 +63,54 @@ namespace {
         EXPECT_EQ(vk::ShaderStageFlagBits::eFragment, shaderStageFlow.getShaderStageCreateInfos()[1].stage);
         EXPECT_STREQ("main", shaderStageFlow.getShaderStageCreateInfos()[1].pName);
 
-        EXPECT_EQ(3, shaderStageFlow.getVertexInputStateCreateInfo().vertexAttributeDescriptionCount);
+        EXPECT_EQ(6, shaderStageFlow.getVertexInputStateCreateInfo().vertexAttributeDescriptionCount);
         EXPECT_EQ(2, shaderStageFlow.getVertexInputStateCreateInfo().vertexBindingDescriptionCount);
     }
+
+    TEST_F(Utility_ShaderModuleTest, NormalCase_StaticInputLayout) {
+        std::ifstream vert_fin { TEST_VERT_SPV_FILE, std::ios::in | std::ios::binary };
+        std::vector<char> vert_code { std::istreambuf_iterator<char>{ vert_fin }, std::istreambuf_iterator<char> {} };
+
+        std::vector<fuji::core::utility::ShaderModule> shaderModules;
+        shaderModules.emplace_back(device.get(), vert_code, vk::ShaderStageFlagBits::eVertex);
+
+        using InputLayout = fuji::core::utility::StaticVertexShaderInputLayout<
+            fuji::core::utility::StaticBinding<Vertex, vk::VertexInputRate::eVertex, FUJI_VERTEX_ATTRIBUTE(Vertex, pos), FUJI_VERTEX_ATTRIBUTE(Vertex, coord)>
+        >;
+        fuji::core::utility::ShaderStageFlow shaderStageFlow { std::move(shaderModules), InputLayout {} };
+
+        EXPECT_EQ(2, shaderStageFlow.getVertexInputStateCreateInfo().vertexAttributeDescriptionCount);
+        EXPECT_EQ(1, shaderStageFlow.getVertexInputStateCreateInfo().vertexBindingDescriptionCount);
+        EXPECT_EQ(InputLayout::attributeDescriptions.data(), shaderStageFlow.getVertexInputStateCreateInfo().pVertexAttributeDescriptions);
+    }
+
+    TEST_F(Utility_ShaderModuleTest, NormalCase_SpecializationConstants) {
+        std::ifstream vert_fin { TEST_VERT_SPV_FILE, std::ios::in | std::ios::binary };
+        std::vector<char> vert_code { std::istreambuf_iterator<char>{ vert_fin }, std::istreambuf_iterator<char> {} };
+        std::ifstream frag_fin { TEST_FRAG_SPV_FILE, std::ios::in | std::ios::binary };
+        std::vector<char> frag_code { std::istreambuf_iterator<char>{ frag_fin }, std::istreambuf_iterator<char> {} };
+
+        std::vector<fuji::core::utility::ShaderModule> shaderModules;
+        shaderModules.emplace_back(device.get(), vert_code, vk::ShaderStageFlagBits::eVertex);
+        shaderModules.emplace_back(device.get(), frag_code, vk::ShaderStageFlagBits::eFragment);
+
+        fuji::core::utility::ShaderStageFlow shaderStageFlow {
+            std::move(shaderModules),
+            fuji::core::utility::VertexShaderInputLayout {
+                {
+                    fuji::core::utility::Binding { vk::VertexInputRate::eVertex, &Vertex::pos, &Vertex::coord },
+                }
+            }
+        };
+        EXPECT_EQ(nullptr, shaderStageFlow.getShaderStageCreateInfos()[1].pSpecializationInfo);
+
+        fuji::core::utility::SpecializationConstants constants;
+        constants.set(0, std::uint32_t { 1 });
+        shaderStageFlow.setSpecializationConstants(vk::ShaderStageFlagBits::eFragment, constants);
+
+        EXPECT_EQ(nullptr, shaderStageFlow.getShaderStageCreateInfos()[0].pSpecializationInfo);
+        ASSERT_NE(nullptr, shaderStageFlow.getShaderStageCreateInfos()[1].pSpecializationInfo);
+        EXPECT_EQ(1, shaderStageFlow.getShaderStageCreateInfos()[1].pSpecializationInfo->mapEntryCount);
+        EXPECT_TRUE(constants == *shaderStageFlow.getSpecializationConstants(vk::ShaderStageFlagBits::eFragment));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/specialization_constants.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    TEST(Utility_SpecializationConstantsTest, NormalCase_SpecializationInfo) {
+        SpecializationConstants constants;
+        constants.set(0, std::uint32_t { 2 }).set(1, true).set(2, 2.2f);
+
+        vk::SpecializationInfo info = constants.getSpecializationInfo();
+        EXPECT_EQ(3, info.mapEntryCount);
+        EXPECT_EQ(12, info.dataSize);
+        EXPECT_EQ(1, info.pMapEntries[1].constantID);
+        EXPECT_EQ(sizeof(vk::Bool32), info.pMapEntries[1].size);
+
+        vk::Bool32 value;
+        std::memcpy(&value, static_cast<const std::uint8_t*>(info.pData) + info.pMapEntries[1].offset, sizeof(value));
+        EXPECT_EQ(VK_TRUE, value);
+    }
+
+    TEST(Utility_SpecializationConstantsTest, NormalCase_EqualityIgnoresInsertionOrder) {
+        SpecializationConstants lhs;
+        lhs.set(0, std::uint32_t { 1 }).set(1, 0.5f);
+        SpecializationConstants rhs;
+        rhs.set(1, 0.5f).set(0, std::uint32_t { 1 });
+
+        EXPECT_TRUE(lhs == rhs);
+        EXPECT_EQ(SpecializationConstants::Hash {}(lhs), SpecializationConstants::Hash {}(rhs));
+    }
+
+    TEST(Utility_SpecializationConstantsTest, NormalCase_OverwriteValue) {
+        SpecializationConstants lhs;
+        lhs.set(0, std::uint32_t { 1 }).set(1, 0.5f);
+        SpecializationConstants rhs;
+        rhs.set(0, std::uint64_t { 1 }).set(1, 0.5f);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.set(0, std::uint32_t { 1 });
+        EXPECT_TRUE(lhs == rhs);
+        EXPECT_EQ(8, rhs.getSpecializationInfo().dataSize);
+    }
+
+    TEST(Utility_SpecializationConstantsTest, NormalCase_EnumValue) {
+        enum class GlyphMode : std::uint8_t { Bitmap, Sdf, Msdf };
+        SpecializationConstants constants;
+        constants.set(0, GlyphMode::Msdf);
+
+        vk::SpecializationInfo info = constants.getSpecializationInfo();
+        ASSERT_EQ(1, info.mapEntryCount);
+        EXPECT_EQ(sizeof(std::uint32_t), info.pMapEntries[0].size);
+
+        std::uint32_t value;
+        std::memcpy(&value, info.pData, sizeof(value));
+        EXPECT_EQ(2, value);
+    }
+
+    TEST(Utility_SpecializationConstantsTest, NormalCase_NarrowScalarsAreWidened) {
+        SpecializationConstants constants;
+        constants.set(0, std::uint8_t { 200 }).set(1, std::int16_t { -3 });
+
+        vk::SpecializationInfo info = constants.getSpecializationInfo();
+        ASSERT_EQ(2, info.mapEntryCount);
+        EXPECT_EQ(sizeof(std::uint32_t), info.pMapEntries[0].size);
+        EXPECT_EQ(sizeof(std::int32_t), info.pMapEntries[1].size);
+        EXPECT_EQ(8, info.dataSize);
+
+        std::uint32_t unsignedValue;
+        std::int32_t signedValue;
+        std::memcpy(&unsignedValue, static_cast<const std::uint8_t*>(info.pData) + info.pMapEntries[0].offset, sizeof(unsignedValue));
+        std::memcpy(&signedValue, static_cast<const std::uint8_t*>(info.pData) + info.pMapEntries[1].offset, sizeof(signedValue));
+        EXPECT_EQ(200, unsignedValue);
+        EXPECT_EQ(-3, signedValue);
+    }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/frame_ring.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/streaming_buffer.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_StreamingBufferTest : public fuji::test::DeviceFixture {
+    protected:
+        void SetUp() override {
+            DeviceFixture::SetUp();
+            this->frameRing = std::make_unique<FrameRing>(this->device.get(), 0, 2);
+        }
+        void TearDown() override {
+            frameRing.reset();
+            DeviceFixture::TearDown();
+        }
+    protected:
+        std::unique_ptr<FrameRing> frameRing;
+    };
+
+    TEST_F(Utility_StreamingBufferTest, NormalCase_WriteAndRetireFrames) {
+        StreamingBuffer streamingBuffer { *allocator, *frameRing, 256 };
+        std::vector<std::uint8_t> data(64, 9);
+
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        auto first = streamingBuffer.write(data.data(), data.size());
+        ASSERT_TRUE(first);
+        EXPECT_EQ(0, first->offset);
+        EXPECT_EQ(streamingBuffer.getBuffer(), first->buffer);
+        EXPECT_EQ(0, std::memcmp(first->data, data.data(), data.size()));
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        auto second = streamingBuffer.allocate(20, 32);
+        ASSERT_TRUE(second);
+        EXPECT_EQ(64, second->offset);
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+        EXPECT_EQ(84, streamingBuffer.getUsedBytes());
+
+        frameRing->waitIdle();
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        EXPECT_EQ(0, streamingBuffer.getUsedBytes());
+        EXPECT_EQ(0, streamingBuffer.getStallCount());
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+
+    TEST_F(Utility_StreamingBufferTest, NormalCase_WrapAroundAndStall) {
+        StreamingBuffer streamingBuffer { *allocator, *frameRing, 256 };
+
+        // frames 1 and 2 take [0, 96) and [96, 192)
+        for(vk::DeviceSize expected : { 0, 96 }) {
+            frameRing->acquire();
+            streamingBuffer.beginFrame();
+            auto range = streamingBuffer.allocate(96);
+            ASSERT_TRUE(range);
+            EXPECT_EQ(expected, range->offset);
+            streamingBuffer.endFrame();
+            frameRing->submit(queue);
+        }
+
+        // acquiring frame 3 waits for frame 1, so the ring wraps around into its range
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        auto wrapped = streamingBuffer.allocate(96);
+        ASSERT_TRUE(wrapped);
+        EXPECT_EQ(0, wrapped->offset);
+        EXPECT_EQ(0, streamingBuffer.getStallCount());
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+
+        // frame 2 is retired by acquire, but 128 bytes only fit once frame 3 has completed as well
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        auto stalled = streamingBuffer.allocate(128);
+        ASSERT_TRUE(stalled);
+        EXPECT_EQ(0, stalled->offset);
+        EXPECT_EQ(1, streamingBuffer.getStallCount());
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+
+    TEST_F(Utility_StreamingBufferTest, AbnormalCase_CurrentFrameExhaustsRing) {
+        StreamingBuffer streamingBuffer { *allocator, *frameRing, 256 };
+
+        frameRing->acquire();
+        streamingBuffer.beginFrame();
+        EXPECT_FALSE(streamingBuffer.allocate(512));
+        ASSERT_TRUE(streamingBuffer.allocate(256));
+        EXPECT_FALSE(streamingBuffer.allocate(16));
+        EXPECT_EQ(0, streamingBuffer.getStallCount());
+        streamingBuffer.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+
+namespace {
+    class Utility_UploadSchedulerTest : public fuji::test::DeviceFixture {
+    protected:
+        AllocatedImage createImage(vk::Extent2D extent) {
+            vk::ImageCreateInfo imageInfo {};
+            imageInfo.imageType = vk::ImageType::e2D;
+            imageInfo.extent = vk::Extent3D { extent.width, extent.height, 1 };
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = vk::Format::eR8Unorm;
+            imageInfo.tiling = vk::ImageTiling::eOptimal;
+            imageInfo.usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eTransferSrc | vk::ImageUsageFlagBits::eSampled;
+            imageInfo.sharingMode = vk::SharingMode::eExclusive;
+            imageInfo.samples = vk::SampleCountFlagBits::e1;
+            return this->allocator->createImage(imageInfo, vk::MemoryPropertyFlagBits::eDeviceLocal);
+        }
+    };
+
+    TEST_F(Utility_UploadSchedulerTest, NormalCase_UploadBuffer) {
+        UploadScheduler scheduler { physicalDevice, *allocator, 0, 0, 1024 };
+        AllocatedBuffer buffer = createHostBuffer(64, vk::BufferUsageFlagBits::eTransferDst);
+        std::vector<std::uint8_t> data(32, 7);
+
+        EXPECT_FALSE(scheduler.hasPendingUploads());
+        scheduler.uploadBuffer(buffer.buffer.get(), 16, data.data(), data.size());
+        EXPECT_TRUE(scheduler.hasPendingUploads());
+        std::uint64_t value = scheduler.flush(queue);
+        EXPECT_EQ(1, value);
+        EXPECT_FALSE(scheduler.hasPendingUploads());
+        EXPECT_EQ(value, scheduler.flush(queue));
+
+        scheduler.wait(value);
+        EXPECT_TRUE(scheduler.isComplete(value));
+        allocator->invalidate(buffer.allocation.get());
+        EXPECT_EQ(0, std::memcmp(buffer.allocation->mappedData + 16, data.data(), data.size()));
+    }
+
+    TEST_F(Utility_UploadSchedulerTest, NormalCase_UploadsToOneImageAreMerged) {
+        UploadScheduler scheduler { physicalDevice, *allocator, 0, 0, 1024 };
+        vk::Extent2D extent { 8, 8 };
+        AllocatedImage image = createImage(extent);
+        std::vector<std::uint8_t> top(32, 1);
+        std::vector<std::uint8_t> bottom(32, 2);
+
+        ImageUploadRegion topRegion { top.data(), top.size(), vk::Offset3D { 0, 0, 0 }, vk::Extent3D { 8, 4, 1 } };
+        ImageUploadRegion bottomRegion { bottom.data(), bottom.size(), vk::Offset3D { 0, 4, 0 }, vk::Extent3D { 8, 4, 1 } };
+        scheduler.uploadImage(image.image.get(), topRegion, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferSrcOptimal, vk::SharingMode::eExclusive, vk::PipelineStageFlagBits::eTransfer);
+        scheduler.uploadImage(image.image.get(), bottomRegion, vk::ImageLayout::eTransferSrcOptimal, vk::ImageLayout::eTransferSrcOptimal, vk::SharingMode::eExclusive, vk::PipelineStageFlagBits::eTransfer);
+        scheduler.wait(scheduler.flush(queue));
+
+        AllocatedBuffer readback = createHostBuffer(64, vk::BufferUsageFlagBits::eTransferDst);
+        copyImageToBuffer(image.image.get(), extent, readback.buffer.get());
+        allocator->invalidate(readback.allocation.get());
+        for(std::uint32_t i = 0; i < 64; i++) {
+            EXPECT_EQ(i < 32 ? 1 : 2, readback.allocation->mappedData[i]);
+        }
+    }
+
+    TEST_F(Utility_UploadSchedulerTest, NormalCase_StagingOverflowUsesTemporaryBuffer) {
+        UploadScheduler scheduler { physicalDevice, *allocator, 0, 0, 256 };
+        AllocatedBuffer buffer = createHostBuffer(1024, vk::BufferUsageFlagBits::eTransferDst);
+        std::vector<std::uint8_t> data(1024, 3);
+
+        scheduler.uploadBuffer(buffer.buffer.get(), 0, data.data(), data.size());
+        scheduler.wait(scheduler.flush(queue));
+        allocator->invalidate(buffer.allocation.get());
+        EXPECT_EQ(0, std::memcmp(buffer.allocation->mappedData, data.data(), data.size()));
+    }
+
+    TEST_F(Utility_UploadSchedulerTest, AbnormalCase_ConflictingImageUploads) {
+        UploadScheduler scheduler { physicalDevice, *allocator, 0, 0, 1024 };
+        AllocatedImage image = createImage(vk::Extent2D { 4, 4 });
+        std::vector<std::uint8_t> data(16, 1);
+        ImageUploadRegion region { data.data(), data.size(), vk::Offset3D { 0, 0, 0 }, vk::Extent3D { 4, 4, 1 } };
+
+        scheduler.uploadImage(image.image.get(), region, vk::ImageLayout::eUndefined, vk::ImageLayout::eShaderReadOnlyOptimal);
+        EXPECT_THROW(scheduler.uploadImage(image.image.get(), region, vk::ImageLayout::eUndefined, vk::ImageLayout::eGeneral), std::logic_error);
+        scheduler.wait(scheduler.flush(queue));
+    }
+}
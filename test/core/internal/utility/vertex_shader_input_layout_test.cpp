@@ -8,6 +8,7 @@
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.hpp>
 
+#include <fuji/core/internal/utility/packed_formats.hpp>
 #include <fuji/core/internal/utility/vertex_shader_input_layout.hpp>
 
 using namespace fuji::core::utility;
@@ -41,8 +42,11 @@ namespace {
         EXPECT_EQ(4 + sizeof(glm::mat4), binding.getStride());
         EXPECT_EQ(0, binding.getAttributeDescriptions()[0].offset);
         EXPECT_EQ(vk::Format::eR8Uint, binding.getAttributeDescriptions()[0].format);
-        EXPECT_EQ(4, binding.getAttributeDescriptions()[1].offset);
-        EXPECT_EQ(vk::Format::eAstc4x4SfloatBlock, binding.getAttributeDescriptions()[1].format);
+        EXPECT_EQ(5, binding.getAttributeDescriptions().size());
+        for(std::uint32_t column = 0; column < 4; column++) {
+            EXPECT_EQ(4 + column * sizeof(glm::vec4), binding.getAttributeDescriptions()[1 + column].offset);
+            EXPECT_EQ(vk::Format::eR32G32B32A32Sfloat, binding.getAttributeDescriptions()[1 + column].format);
+        }
     }
 
     TEST(Utility_VertexShaderInputLayoutTest, NormalCase_InstantiateInputLayout) {
@@ -62,6 +66,75 @@ namespace {
         EXPECT_EQ(0, inputLayout.getBindings()[1].getAttributeDescriptions()[0].offset);
         EXPECT_EQ(vk::Format::eR8Uint, inputLayout.getBindings()[1].getAttributeDescriptions()[0].format);
         EXPECT_EQ(4, inputLayout.getBindings()[1].getAttributeDescriptions()[1].offset);
-        EXPECT_EQ(vk::Format::eAstc4x4SfloatBlock, inputLayout.getBindings()[1].getAttributeDescriptions()[1].format);
+        EXPECT_EQ(vk::Format::eR32G32B32A32Sfloat, inputLayout.getBindings()[1].getAttributeDescriptions()[1].format);
+        EXPECT_EQ(52, inputLayout.getBindings()[1].getAttributeDescriptions()[4].offset);
+    }
+
+    using StaticInputLayout = StaticVertexShaderInputLayout<
+        StaticBinding<Vertex1, vk::VertexInputRate::eVertex, FUJI_VERTEX_ATTRIBUTE(Vertex1, attribute1), FUJI_VERTEX_ATTRIBUTE(Vertex1, attribute2)>,
+        StaticBinding<Vertex1, vk::VertexInputRate::eInstance, FUJI_VERTEX_ATTRIBUTE(Vertex1, attribute2)>
+    >;
+
+    static_assert(StaticInputLayout::bindingDescriptions.size() == 2);
+    static_assert(StaticInputLayout::attributeDescriptions.size() == 3);
+    static_assert(StaticInputLayout::attributeDescriptions[1].offset == offsetof(Vertex1, attribute2));
+
+    struct GlyphVertex {
+        Half2 position;
+        Unorm16x2 coord;
+    };
+
+    using PackedInputLayout = StaticVertexShaderInputLayout<
+        StaticBinding<GlyphVertex, vk::VertexInputRate::eVertex, FUJI_VERTEX_ATTRIBUTE(GlyphVertex, position), FUJI_VERTEX_ATTRIBUTE(GlyphVertex, coord)>
+    >;
+
+    static_assert(sizeof(GlyphVertex) == 8);
+
+    TEST(Utility_VertexShaderInputLayoutTest, NormalCase_PackedFormats) {
+        EXPECT_EQ(8, PackedInputLayout::bindingDescriptions[0].stride);
+        EXPECT_EQ(vk::Format::eR16G16Sfloat, PackedInputLayout::attributeDescriptions[0].format);
+        EXPECT_EQ(vk::Format::eR16G16Unorm, PackedInputLayout::attributeDescriptions[1].format);
+        EXPECT_EQ(4, PackedInputLayout::attributeDescriptions[1].offset);
+
+        GlyphVertex vertex;
+        vertex.position = glm::vec2(0.5f, -2.0f);
+        vertex.coord = glm::vec2(1.0f, 0.0f);
+        EXPECT_EQ(glm::vec2(0.5f, -2.0f), vertex.position.get());
+        EXPECT_EQ(glm::vec2(1.0f, 0.0f), vertex.coord.get());
+
+        Unorm10x3x2 normal = glm::vec4(1.0f, 0.0f, 1.0f, 1.0f);
+        EXPECT_EQ(0xFFF003FFu, normal.packed);
+    }
+
+    TEST(Utility_VertexShaderInputLayoutTest, NormalCase_StaticMatrixAttribute) {
+        using InputLayout = StaticVertexShaderInputLayout<
+            StaticBinding<Vertex2, vk::VertexInputRate::eInstance, FUJI_VERTEX_ATTRIBUTE(Vertex2, attribute1), FUJI_VERTEX_ATTRIBUTE(Vertex2, attribute2)>
+        >;
+
+        EXPECT_EQ(5, InputLayout::attributeDescriptions.size());
+        for(std::uint32_t column = 0; column < 4; column++) {
+            EXPECT_EQ(1 + column, InputLayout::attributeDescriptions[1 + column].location);
+            EXPECT_EQ(4 + column * sizeof(glm::vec4), InputLayout::attributeDescriptions[1 + column].offset);
+            EXPECT_EQ(vk::Format::eR32G32B32A32Sfloat, InputLayout::attributeDescriptions[1 + column].format);
+        }
+    }
+
+    TEST(Utility_VertexShaderInputLayoutTest, NormalCase_StaticInputLayout) {
+        EXPECT_EQ(0, StaticInputLayout::bindingDescriptions[0].binding);
+        EXPECT_EQ(sizeof(Vertex1), StaticInputLayout::bindingDescriptions[0].stride);
+        EXPECT_EQ(vk::VertexInputRate::eVertex, StaticInputLayout::bindingDescriptions[0].inputRate);
+        EXPECT_EQ(1, StaticInputLayout::bindingDescriptions[1].binding);
+        EXPECT_EQ(vk::VertexInputRate::eInstance, StaticInputLayout::bindingDescriptions[1].inputRate);
+
+        EXPECT_EQ(0, StaticInputLayout::attributeDescriptions[0].location);
+        EXPECT_EQ(0, StaticInputLayout::attributeDescriptions[0].binding);
+        EXPECT_EQ(0, StaticInputLayout::attributeDescriptions[0].offset);
+        EXPECT_EQ(vk::Format::eR32G32Sfloat, StaticInputLayout::attributeDescriptions[0].format);
+        EXPECT_EQ(1, StaticInputLayout::attributeDescriptions[1].location);
+        EXPECT_EQ(8, StaticInputLayout::attributeDescriptions[1].offset);
+        EXPECT_EQ(vk::Format::eR32G32B32A32Sfloat, StaticInputLayout::attributeDescriptions[1].format);
+        EXPECT_EQ(2, StaticInputLayout::attributeDescriptions[2].location);
+        EXPECT_EQ(1, StaticInputLayout::attributeDescriptions[2].binding);
+        EXPECT_EQ(8, StaticInputLayout::attributeDescriptions[2].offset);
     }
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <fuji/core/internal/utility/work_stealing_thread_pool.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    TEST(Utility_WorkStealingThreadPoolTest, NormalCase_RunAllTasks) {
+        WorkStealingThreadPool pool { 4 };
+        std::atomic<int> sum { 0 };
+
+        std::vector<WorkStealingThreadPool::Task> tasks;
+        for(int i = 1; i <= 1000; i++) {
+            tasks.push_back([&sum, i] { sum += i; });
+        }
+        pool.submit(std::move(tasks));
+        pool.wait();
+
+        EXPECT_EQ(4, pool.getWorkerCount());
+        EXPECT_EQ(500500, sum.load());
+        EXPECT_EQ(0, pool.getPendingTaskCount());
+    }
+
+    TEST(Utility_WorkStealingThreadPoolTest, NormalCase_SubmitFromWorker) {
+        WorkStealingThreadPool pool { 2 };
+        std::atomic<int> count { 0 };
+
+        for(int i = 0; i < 8; i++) {
+            pool.submit([&pool, &count] {
+                for(int j = 0; j < 16; j++) {
+                    pool.submit([&count] { count++; });
+                }
+            });
+        }
+        pool.wait();
+
+        EXPECT_EQ(128, count.load());
+    }
+
+    TEST(Utility_WorkStealingThreadPoolTest, NormalCase_DefaultWorkerCount) {
+        WorkStealingThreadPool pool {};
+
+        EXPECT_LE(1, pool.getWorkerCount());
+        pool.wait();
+    }
+
+    TEST(Utility_WorkStealingThreadPoolTest, AbnormalCase_RethrowTaskException) {
+        WorkStealingThreadPool pool { 2 };
+        std::atomic<int> count { 0 };
+
+        pool.submit([] { throw std::runtime_error("failed"); });
+        pool.submit([&count] { count++; });
+
+        EXPECT_THROW(pool.wait(), std::runtime_error);
+        EXPECT_EQ(1, count.load());
+        EXPECT_NO_THROW(pool.wait());
+    }
+}
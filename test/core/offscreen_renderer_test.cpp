@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/instance.hpp>
+#include <fuji/core/offscreen_renderer.hpp>
+#include <fuji/core/offscreen_target.hpp>
+#include <fuji/core/internal/utility/graphics_pipeline_create_info_template.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/shader_module.hpp>
+#include <fuji/core/internal/utility/shader_stage_flow.hpp>
+
+using namespace fuji::core::utility;
+
+namespace {
+    std::vector<char> readCode(const char* path) {
+        std::ifstream fin { path, std::ios::in | std::ios::binary };
+        return std::vector<char> { std::istreambuf_iterator<char> { fin }, std::istreambuf_iterator<char> {} };
+    }
+
+    class OffscreenRendererTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->instance = vk::createInstanceUnique({});
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+            float priority = 1.0f;
+            vk::DeviceQueueCreateInfo queueInfo { {}, 0, 1, &priority };
+            this->device = this->physicalDevice.createDeviceUnique(vk::DeviceCreateInfo { {}, queueInfo });
+            this->queue = this->device->getQueue(0, 0);
+        }
+        void TearDown() override {
+            device.reset();
+            instance.reset();
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+        vk::Queue queue;
+    };
+
+    TEST_F(OffscreenRendererTest, NormalCase_ReadbackClearColor) {
+        fuji::Instance fujiInstance { device, 0, vk::Format::eR8G8B8A8Unorm, 2, {}, vk::ImageLayout::eTransferSrcOptimal };
+        fujiInstance.setClearColor({ 1.0f, 0.0f, 0.0f, 1.0f });
+        MemoryAllocator allocator { physicalDevice, device.get() };
+        fuji::OffscreenTarget first { allocator, fujiInstance.getRenderPass(), vk::Format::eR8G8B8A8Unorm, vk::Extent2D { 4, 4 } };
+        fuji::OffscreenTarget second { allocator, fujiInstance.getRenderPass(), vk::Format::eR8G8B8A8Unorm, vk::Extent2D { 3, 5 } };
+
+        fuji::OffscreenRenderer renderer { physicalDevice, fujiInstance, queue };
+        std::uint64_t batch = renderer.submit({ &first, &second });
+        EXPECT_EQ(1, renderer.getPendingBatchCount());
+
+        std::vector<std::size_t> indices;
+        renderer.collect(batch, [&indices](std::size_t index, const std::uint8_t* pixels, vk::Extent2D extent) {
+            indices.push_back(index);
+            for(std::uint32_t i = 0; i < extent.width * extent.height; i++) {
+                EXPECT_EQ(255, pixels[i * 4 + 0]);
+                EXPECT_EQ(0, pixels[i * 4 + 1]);
+                EXPECT_EQ(0, pixels[i * 4 + 2]);
+                EXPECT_EQ(255, pixels[i * 4 + 3]);
+            }
+        });
+        EXPECT_EQ((std::vector<std::size_t> { 0, 1 }), indices);
+        EXPECT_TRUE(renderer.isComplete(batch));
+        EXPECT_EQ(0, renderer.getPendingBatchCount());
+    }
+
+    TEST_F(OffscreenRendererTest, NormalCase_ReadbackDrawnPixels) {
+        fuji::Instance fujiInstance { device, 0, vk::Format::eR8G8B8A8Unorm, 2, {}, vk::ImageLayout::eTransferSrcOptimal };
+        fujiInstance.setClearColor({ 1.0f, 0.0f, 0.0f, 1.0f });
+        MemoryAllocator allocator { physicalDevice, device.get() };
+        fuji::OffscreenTarget cleared { allocator, fujiInstance.getRenderPass(), vk::Format::eR8G8B8A8Unorm, vk::Extent2D { 4, 4 } };
+        fuji::OffscreenTarget drawn { allocator, fujiInstance.getRenderPass(), vk::Format::eR8G8B8A8Unorm, vk::Extent2D { 3, 5 } };
+
+        vk::UniquePipelineLayout pipelineLayout = device->createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo {});
+        std::vector<ShaderModule> shaderModules;
+        shaderModules.emplace_back(device.get(), readCode(FULLSCREEN_VERT_SPV_FILE), vk::ShaderStageFlagBits::eVertex);
+        shaderModules.emplace_back(device.get(), readCode(SOLID_FRAG_SPV_FILE), vk::ShaderStageFlagBits::eFragment);
+        auto createInfoTemplate = std::make_unique<GraphicsPipelineCreateInfoTemplate>(
+            std::make_unique<ShaderStageFlow>(std::move(shaderModules), VertexShaderInputLayout { std::initializer_list<Binding> {} }));
+        createInfoTemplate->setPipelineLayout(pipelineLayout.get());
+        createInfoTemplate->setRenderPass(fujiInstance.getRenderPass());
+        vk::Device deviceHandle = device.get();
+        auto pipelines = GraphicsPipelineCreateInfoTemplate::createGraphicsPipeline(deviceHandle, createInfoTemplate);
+
+        fuji::OffscreenRenderer renderer { physicalDevice, fujiInstance, queue };
+        std::uint64_t batch = renderer.submit({ &cleared, &drawn }, [&fujiInstance, &pipelines](vk::CommandBuffer& commandBuffer, std::size_t index) {
+            if(index == 1) {
+                fujiInstance.bindPipeline(commandBuffer, pipelines[0].get());
+                commandBuffer.draw(3, 1, 0, 0);
+            }
+        });
+
+        renderer.collect(batch, [](std::size_t index, const std::uint8_t* pixels, vk::Extent2D extent) {
+            std::uint8_t red = index == 0 ? 255 : 0;
+            std::uint8_t green = index == 0 ? 0 : 255;
+            for(std::uint32_t i = 0; i < extent.width * extent.height; i++) {
+                EXPECT_EQ(red, pixels[i * 4 + 0]);
+                EXPECT_EQ(green, pixels[i * 4 + 1]);
+                EXPECT_EQ(0, pixels[i * 4 + 2]);
+                EXPECT_EQ(255, pixels[i * 4 + 3]);
+            }
+        });
+    }
+
+    TEST_F(OffscreenRendererTest, AbnormalCase_InvalidArguments) {
+        fuji::Instance attachmentInstance { device, 0, vk::Format::eR8G8B8A8Unorm, 2, {}, vk::ImageLayout::eColorAttachmentOptimal };
+        EXPECT_THROW((fuji::OffscreenRenderer { physicalDevice, attachmentInstance, queue }), std::invalid_argument);
+
+        fuji::Instance fujiInstance { device, 0, vk::Format::eR8G8B8A8Unorm, 2, {}, vk::ImageLayout::eTransferSrcOptimal };
+        fuji::OffscreenRenderer renderer { physicalDevice, fujiInstance, queue };
+        EXPECT_THROW(renderer.collect(1, [](std::size_t, const std::uint8_t*, vk::Extent2D) {}), std::out_of_range);
+    }
+}
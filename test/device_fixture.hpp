@@ -0,0 +1,100 @@
+#ifndef TEST_DEVICE_FIXTURE_HPP
+#define TEST_DEVICE_FIXTURE_HPP
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/core/internal/utility/upload_scheduler.hpp>
+
+namespace fuji::test {
+    // a Vulkan 1.2 device with timeline semaphores on queue family 0, a MemoryAllocator and an UploadScheduler
+    class DeviceFixture : public testing::Test {
+    protected:
+        void SetUp() override {
+            vk::ApplicationInfo applicationInfo {};
+            applicationInfo.apiVersion = VK_API_VERSION_1_2;
+            this->instance = vk::createInstanceUnique(vk::InstanceCreateInfo { {}, &applicationInfo });
+            this->physicalDevice = this->instance->enumeratePhysicalDevices()[0];
+
+            float priority = 1.0f;
+            vk::DeviceQueueCreateInfo queueInfo { {}, 0, 1, &priority };
+            vk::PhysicalDeviceFeatures features = this->getEnabledFeatures();
+            vk::PhysicalDeviceVulkan12Features vulkan12Features = this->getEnabledVulkan12Features();
+            vk::DeviceCreateInfo deviceInfo { {}, queueInfo, {}, {}, &features };
+            deviceInfo.pNext = &vulkan12Features;
+            this->device = this->physicalDevice.createDeviceUnique(deviceInfo);
+            this->queue = this->device->getQueue(0, 0);
+            this->allocator = std::make_unique<core::utility::MemoryAllocator>(this->physicalDevice, this->device.get());
+            this->uploadScheduler = std::make_unique<core::utility::UploadScheduler>(this->physicalDevice, *this->allocator, 0, 0, 64 * 1024);
+        }
+        void TearDown() override {
+            uploadScheduler.reset();
+            allocator.reset();
+            device.reset();
+            instance.reset();
+        }
+
+        virtual vk::PhysicalDeviceFeatures getEnabledFeatures() {
+            return vk::PhysicalDeviceFeatures {};
+        }
+
+        virtual vk::PhysicalDeviceVulkan12Features getEnabledVulkan12Features() {
+            vk::PhysicalDeviceVulkan12Features features {};
+            features.timelineSemaphore = VK_TRUE;
+            return features;
+        }
+
+        core::utility::AllocatedBuffer createHostBuffer(vk::DeviceSize size, vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eTransferDst) {
+            vk::BufferCreateInfo bufferInfo {};
+            bufferInfo.size = size;
+            bufferInfo.usage = usage;
+            bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+            return this->allocator->createBuffer(bufferInfo, vk::MemoryPropertyFlagBits::eHostVisible);
+        }
+
+        void copyImageToBuffer(const vk::Image& image, vk::Extent2D extent, const vk::Buffer& buffer, vk::ImageLayout layout = vk::ImageLayout::eTransferSrcOptimal) {
+            vk::CommandPoolCreateInfo poolInfo {};
+            poolInfo.queueFamilyIndex = 0;
+            vk::UniqueCommandPool commandPool = this->device->createCommandPoolUnique(poolInfo);
+            vk::CommandBufferAllocateInfo allocInfo { commandPool.get(), vk::CommandBufferLevel::ePrimary, 1 };
+            vk::UniqueCommandBuffer commandBuffer = std::move(this->device->allocateCommandBuffersUnique(allocInfo)[0]);
+
+            commandBuffer->begin(vk::CommandBufferBeginInfo { vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+            if(layout != vk::ImageLayout::eTransferSrcOptimal) {
+                vk::ImageMemoryBarrier barrier {};
+                barrier.dstAccessMask = vk::AccessFlagBits::eTransferRead;
+                barrier.oldLayout = layout;
+                barrier.newLayout = vk::ImageLayout::eTransferSrcOptimal;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.image = image;
+                barrier.subresourceRange = vk::ImageSubresourceRange { vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 };
+                commandBuffer->pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags {}, {}, {}, { barrier });
+            }
+            vk::BufferImageCopy region {};
+            region.imageSubresource = vk::ImageSubresourceLayers { vk::ImageAspectFlagBits::eColor, 0, 0, 1 };
+            region.imageExtent = vk::Extent3D { extent.width, extent.height, 1 };
+            commandBuffer->copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, buffer, { region });
+            commandBuffer->end();
+
+            vk::SubmitInfo submitInfo {};
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &commandBuffer.get();
+            this->queue.submit({ submitInfo }, VK_NULL_HANDLE);
+            this->queue.waitIdle();
+        }
+    protected:
+        vk::UniqueInstance instance;
+        vk::PhysicalDevice physicalDevice;
+        vk::UniqueDevice device;
+        vk::Queue queue;
+        std::unique_ptr<core::utility::MemoryAllocator> allocator;
+        std::unique_ptr<core::utility::UploadScheduler> uploadScheduler;
+    };
+}
+
+#endif
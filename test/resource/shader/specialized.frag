@@ -0,0 +1,18 @@
+#version 460
+
+layout (constant_id = 0) const uint mode = 0;
+layout (constant_id = 1) const bool tinted = false;
+
+layout (location = 0) in vec2 coord;
+
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform sampler2D tex;
+
+void main() {
+    vec4 color = texture(tex, coord);
+    if(tinted) {
+        color.rgb *= 0.5;
+    }
+    outColor = mode == 0u ? color : vec4(color.a);
+}
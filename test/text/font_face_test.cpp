@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fuji/text/font_face.hpp>
+
+using namespace fuji::text;
+using namespace fuji::text::utility;
+
+namespace {
+    using Bytes = std::vector<std::uint8_t>;
+
+    void put16(Bytes& bytes, std::uint16_t value) {
+        bytes.push_back(static_cast<std::uint8_t>(value >> 8));
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void put32(Bytes& bytes, std::uint32_t value) {
+        put16(bytes, static_cast<std::uint16_t>(value >> 16));
+        put16(bytes, static_cast<std::uint16_t>(value));
+    }
+
+    Bytes createHead() {
+        Bytes head(54, 0);
+        head[18] = 0x03;
+        head[19] = 0xE8;
+        return head;
+    }
+
+    Bytes createHhea() {
+        Bytes hhea;
+        put32(hhea, 0x00010000);
+        put16(hhea, 800);
+        put16(hhea, static_cast<std::uint16_t>(-200));
+        put16(hhea, 90);
+        hhea.resize(34, 0);
+        put16(hhea, 2);
+        return hhea;
+    }
+
+    Bytes createMaxp() {
+        Bytes maxp;
+        put32(maxp, 0x00005000);
+        put16(maxp, 3);
+        return maxp;
+    }
+
+    Bytes createHmtx() {
+        Bytes hmtx;
+        put16(hmtx, 500);
+        put16(hmtx, 0);
+        put16(hmtx, 600);
+        put16(hmtx, 50);
+        put16(hmtx, 10);
+        return hmtx;
+    }
+
+    Bytes createFormat4() {
+        Bytes format4;
+        put16(format4, 4);
+        put16(format4, 42);
+        put16(format4, 0);
+        put16(format4, 6);
+        put16(format4, 4);
+        put16(format4, 1);
+        put16(format4, 2);
+        for(std::uint16_t endCode : { 0x42, 0x61, 0xFFFF }) {
+            put16(format4, endCode);
+        }
+        put16(format4, 0);
+        for(std::uint16_t startCode : { 0x41, 0x61, 0xFFFF }) {
+            put16(format4, startCode);
+        }
+        for(std::uint16_t idDelta : { 0xFFC0, 0, 1 }) {
+            put16(format4, idDelta);
+        }
+        for(std::uint16_t idRangeOffset : { 0, 4, 0 }) {
+            put16(format4, idRangeOffset);
+        }
+        put16(format4, 2);
+        return format4;
+    }
+
+    Bytes createFormat12() {
+        Bytes format12;
+        put16(format12, 12);
+        put16(format12, 0);
+        put32(format12, 40);
+        put32(format12, 0);
+        put32(format12, 2);
+        for(std::uint32_t value : { 0x41u, 0x42u, 1u, 0x1F600u, 0x1F600u, 2u }) {
+            put32(format12, value);
+        }
+        return format12;
+    }
+
+    Bytes createCmap(bool withFormat12) {
+        Bytes format4 = createFormat4();
+        Bytes cmap;
+        put16(cmap, 0);
+        put16(cmap, withFormat12 ? 2 : 1);
+        std::uint32_t offset = withFormat12 ? 20 : 12;
+        put16(cmap, 3);
+        put16(cmap, 1);
+        put32(cmap, offset);
+        if(withFormat12) {
+            put16(cmap, 3);
+            put16(cmap, 10);
+            put32(cmap, offset + static_cast<std::uint32_t>(format4.size()));
+        }
+        cmap.insert(cmap.end(), format4.begin(), format4.end());
+        if(withFormat12) {
+            Bytes format12 = createFormat12();
+            cmap.insert(cmap.end(), format12.begin(), format12.end());
+        }
+        return cmap;
+    }
+
+    Bytes createGlyf() {
+        Bytes glyf;
+        put16(glyf, 1);
+        for(std::uint16_t bound : { 0, 0, 100, 100 }) {
+            put16(glyf, bound);
+        }
+        put16(glyf, 3);
+        put16(glyf, 0);
+        for(std::uint8_t flag : { 0x01, 0x01, 0x00, 0x01 }) {
+            glyf.push_back(flag);
+        }
+        for(std::int16_t x : { 0, 100, 0, -100 }) {
+            put16(glyf, static_cast<std::uint16_t>(x));
+        }
+        for(std::int16_t y : { 0, 0, 100, 0 }) {
+            put16(glyf, static_cast<std::uint16_t>(y));
+        }
+        glyf.resize(36, 0);
+
+        put16(glyf, static_cast<std::uint16_t>(-1));
+        for(std::uint16_t bound : { 200, 50, 300, 150 }) {
+            put16(glyf, bound);
+        }
+        put16(glyf, 0x0003);
+        put16(glyf, 1);
+        put16(glyf, 200);
+        put16(glyf, 50);
+        return glyf;
+    }
+
+    Bytes createLoca() {
+        Bytes loca;
+        for(std::uint16_t offset : { 0, 0, 18, 27 }) {
+            put16(loca, offset);
+        }
+        return loca;
+    }
+
+    Bytes createFont(bool withFormat12, std::uint32_t baseOffset = 0) {
+        std::vector<std::pair<std::uint32_t, Bytes>> tables {
+            { makeTag('c', 'm', 'a', 'p'), createCmap(withFormat12) },
+            { makeTag('g', 'l', 'y', 'f'), createGlyf() },
+            { makeTag('h', 'e', 'a', 'd'), createHead() },
+            { makeTag('h', 'h', 'e', 'a'), createHhea() },
+            { makeTag('h', 'm', 't', 'x'), createHmtx() },
+            { makeTag('l', 'o', 'c', 'a'), createLoca() },
+            { makeTag('m', 'a', 'x', 'p'), createMaxp() }
+        };
+
+        Bytes font;
+        put32(font, 0x00010000);
+        put16(font, static_cast<std::uint16_t>(tables.size()));
+        put16(font, 0);
+        put16(font, 0);
+        put16(font, 0);
+        std::uint32_t offset = baseOffset + 12 + static_cast<std::uint32_t>(tables.size()) * 16;
+        for(auto& [tag, table] : tables) {
+            put32(font, tag);
+            put32(font, 0);
+            put32(font, offset);
+            put32(font, static_cast<std::uint32_t>(table.size()));
+            offset += static_cast<std::uint32_t>((table.size() + 3) & ~std::size_t { 3 });
+        }
+        for(auto& [tag, table] : tables) {
+            font.insert(font.end(), table.begin(), table.end());
+            font.resize((font.size() + 3) & ~std::size_t { 3 }, 0);
+        }
+        return font;
+    }
+
+    Bytes createCollection() {
+        Bytes collection;
+        put32(collection, makeTag('t', 't', 'c', 'f'));
+        put32(collection, 0x00010000);
+        put32(collection, 2);
+        put32(collection, 20);
+        Bytes first = createFont(true, 20);
+        put32(collection, 20 + static_cast<std::uint32_t>(first.size()));
+        Bytes second = createFont(false, 20 + static_cast<std::uint32_t>(first.size()));
+        collection.insert(collection.end(), first.begin(), first.end());
+        collection.insert(collection.end(), second.begin(), second.end());
+        return collection;
+    }
+
+    class Text_FontFaceTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            this->filePath = std::filesystem::temp_directory_path() / "fuji_font_face_test.ttf";
+        }
+        void TearDown() override {
+            std::filesystem::remove(this->filePath);
+        }
+        void write(const Bytes& bytes) {
+            std::ofstream fout { this->filePath, std::ios::out | std::ios::binary | std::ios::trunc };
+            fout.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+    protected:
+        std::filesystem::path filePath;
+    };
+
+    TEST_F(Text_FontFaceTest, NormalCase_Metrics) {
+        write(createFont(true));
+        FontFace face { filePath };
+
+        EXPECT_EQ(1000, face.getMetrics().unitsPerEm);
+        EXPECT_EQ(800, face.getMetrics().ascender);
+        EXPECT_EQ(-200, face.getMetrics().descender);
+        EXPECT_EQ(90, face.getMetrics().lineGap);
+        EXPECT_EQ(3, face.getMetrics().glyphCount);
+        EXPECT_TRUE(face.hasTable(makeTag('g', 'l', 'y', 'f')));
+        EXPECT_FALSE(face.hasTable(makeTag('C', 'F', 'F', ' ')));
+
+        EXPECT_EQ(500, face.getGlyphMetrics(0).advanceWidth);
+        EXPECT_EQ(50, face.getGlyphMetrics(1).leftSideBearing);
+        EXPECT_EQ(600, face.getGlyphMetrics(2).advanceWidth);
+        EXPECT_EQ(10, face.getGlyphMetrics(2).leftSideBearing);
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_CharacterMapFormat12) {
+        write(createFont(true));
+        FontFace face { filePath };
+
+        EXPECT_EQ(1, face.getGlyphIndex(U'A'));
+        EXPECT_EQ(2, face.getGlyphIndex(U'B'));
+        EXPECT_EQ(2, face.getGlyphIndex(U'\U0001F600'));
+        EXPECT_EQ(0, face.getGlyphIndex(U'a'));
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_CharacterMapFormat4) {
+        write(createFont(false));
+        FontFace face { filePath };
+
+        EXPECT_EQ(1, face.getGlyphIndex(U'A'));
+        EXPECT_EQ(2, face.getGlyphIndex(U'B'));
+        EXPECT_EQ(2, face.getGlyphIndex(U'a'));
+        EXPECT_EQ(0, face.getGlyphIndex(U'z'));
+        EXPECT_EQ(0, face.getGlyphIndex(U'\U0001F600'));
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_GlyphIndicesBatch) {
+        write(createFont(false));
+        FontFace face { filePath };
+
+        std::vector<std::uint32_t> expected { 1, 2, 2, 0, 1, 0 };
+        EXPECT_EQ(expected, face.getGlyphIndices(U"ABaxA\U0001F600"));
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_SimpleGlyphOutline) {
+        write(createFont(true));
+        FontFace face { filePath };
+
+        Outline outline = face.getOutline(1);
+        std::vector<Outline::Verb> verbs {
+            Outline::Verb::eMoveTo, Outline::Verb::eLineTo, Outline::Verb::eQuadTo, Outline::Verb::eLineTo, Outline::Verb::eClose
+        };
+        EXPECT_EQ(verbs, outline.getVerbs());
+        ASSERT_EQ(5, outline.getPoints().size());
+        EXPECT_FLOAT_EQ(100.0f, outline.getPoints()[2].x);
+        EXPECT_FLOAT_EQ(100.0f, outline.getPoints()[2].y);
+        EXPECT_FLOAT_EQ(0.0f, outline.getPoints()[3].x);
+        EXPECT_FLOAT_EQ(100.0f, outline.getPoints()[3].y);
+
+        EXPECT_TRUE(face.getOutline(0).empty());
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_CompositeGlyphOutline) {
+        write(createFont(true));
+        FontFace face { filePath };
+
+        OutlineBounds bounds = face.getOutline(2).getBounds();
+        EXPECT_FLOAT_EQ(200.0f, bounds.minX);
+        EXPECT_FLOAT_EQ(50.0f, bounds.minY);
+        EXPECT_FLOAT_EQ(300.0f, bounds.maxX);
+        EXPECT_FLOAT_EQ(150.0f, bounds.maxY);
+    }
+
+    TEST_F(Text_FontFaceTest, NormalCase_Collection) {
+        write(createCollection());
+        auto file = std::make_shared<const fuji::core::utility::MappedFile>(filePath);
+
+        EXPECT_EQ(2, FontFace::getFaceCount(*file));
+        FontFace first { file, 0 };
+        FontFace second { file, 1 };
+        EXPECT_EQ(0, first.getGlyphIndex(U'a'));
+        EXPECT_EQ(2, second.getGlyphIndex(U'a'));
+        EXPECT_EQ(1, second.getFaceIndex());
+        EXPECT_FALSE(second.getOutline(1).empty());
+        EXPECT_THROW(FontFace(file, 2), std::invalid_argument);
+    }
+
+    TEST_F(Text_FontFaceTest, AbnormalCase_InvalidFont) {
+        write(Bytes { 'n', 'o', 't', ' ', 'a', ' ', 'f', 'o', 'n', 't', 0, 0 });
+        EXPECT_THROW(FontFace { filePath }, std::runtime_error);
+
+        Bytes truncated = createFont(true);
+        truncated.resize(40);
+        write(truncated);
+        EXPECT_THROW(FontFace { filePath }, std::runtime_error);
+    }
+
+    TEST_F(Text_FontFaceTest, AbnormalCase_GlyphIndexOutOfRange) {
+        write(createFont(true));
+        FontFace face { filePath };
+
+        EXPECT_THROW(face.getOutline(3), std::out_of_range);
+        EXPECT_EQ(0, face.getGlyphMetrics(3).advanceWidth);
+    }
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/glyph_atlas.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    constexpr std::uint32_t atlasSize = 16;
+
+    class Text_GlyphAtlasTest : public fuji::test::DeviceFixture {
+    protected:
+        std::vector<std::uint8_t> readback(const GlyphAtlas& atlas) {
+            AllocatedBuffer buffer = createHostBuffer(atlasSize * atlasSize);
+            copyImageToBuffer(atlas.getImage(), atlas.getExtent(), buffer.buffer.get(), vk::ImageLayout::eShaderReadOnlyOptimal);
+            allocator->invalidate(buffer.allocation.get());
+            return std::vector<std::uint8_t> { buffer.allocation->mappedData, buffer.allocation->mappedData + atlasSize * atlasSize };
+        }
+    };
+
+    TEST_F(Text_GlyphAtlasTest, NormalCase_CommittedGlyphsReadBack) {
+        GlyphAtlas atlas { *allocator, *uploadScheduler, atlasSize, atlasSize };
+        std::vector<std::uint8_t> first { 1, 2, 3, 4, 5, 6 };
+        std::vector<std::uint8_t> second { 7, 8, 0, 0, 9, 10, 0, 0 };
+
+        auto firstRegion = atlas.add(first.data(), 3, 2);
+        auto secondRegion = atlas.add(second.data(), 2, 2, 4);
+        ASSERT_TRUE(firstRegion);
+        ASSERT_TRUE(secondRegion);
+        EXPECT_EQ(2, atlas.getPendingRegionCount());
+        EXPECT_EQ(5 * 4 + 4 * 4, atlas.getPendingUploadSize());
+        EXPECT_FLOAT_EQ(static_cast<float>(firstRegion->x) / atlasSize, firstRegion->u0);
+        EXPECT_FLOAT_EQ(static_cast<float>(firstRegion->x + 3) / atlasSize, firstRegion->u1);
+
+        EXPECT_TRUE(atlas.commit());
+        EXPECT_EQ(0, atlas.getPendingRegionCount());
+        uploadScheduler->wait(uploadScheduler->flush(queue));
+
+        std::vector<std::uint8_t> pixels = readback(atlas);
+        auto pixel = [&pixels](std::uint32_t x, std::uint32_t y) { return pixels[y * atlasSize + x]; };
+        for(std::uint32_t y = 0; y < 2; y++) {
+            for(std::uint32_t x = 0; x < 3; x++) {
+                EXPECT_EQ(first[y * 3 + x], pixel(firstRegion->x + x, firstRegion->y + y));
+            }
+            for(std::uint32_t x = 0; x < 2; x++) {
+                EXPECT_EQ(second[y * 4 + x], pixel(secondRegion->x + x, secondRegion->y + y));
+            }
+        }
+        EXPECT_EQ(0, pixel(firstRegion->x - 1, firstRegion->y));
+        EXPECT_EQ(0, pixel(firstRegion->x + 3, firstRegion->y + 1));
+        EXPECT_EQ(0, pixel(secondRegion->x, secondRegion->y + 2));
+    }
+
+    TEST_F(Text_GlyphAtlasTest, AbnormalCase_GlyphDoesNotFit) {
+        GlyphAtlas atlas { *allocator, *uploadScheduler, atlasSize, atlasSize };
+        std::vector<std::uint8_t> coverage(atlasSize * atlasSize, 255);
+        EXPECT_FALSE(atlas.add(coverage.data(), atlasSize, atlasSize));
+        EXPECT_EQ(0, atlas.getPendingRegionCount());
+        EXPECT_FALSE(atlas.commit());
+    }
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/glyph_cache.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    constexpr std::uint32_t pageSize = 16;
+    constexpr vk::DeviceSize pageBytes = pageSize * pageSize;
+
+    class Text_GlyphCacheTest : public fuji::test::DeviceFixture {};
+
+    TEST_F(Text_GlyphCacheTest, NormalCase_InsertAndFind) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes * 2, pageSize };
+        EXPECT_EQ(2, glyphCache.getMaxPageCount());
+        EXPECT_EQ(1, glyphCache.getPageCount());
+        EXPECT_EQ(0, glyphCache.getGlyphCount());
+        EXPECT_EQ(2, glyphCache.getPageImageViews().size());
+
+        std::vector<std::uint8_t> coverage(4 * 4, 255);
+        GlyphKey key { 0, 1, 12, 0 };
+        auto inserted = glyphCache.insert(key, coverage.data(), 4, 4);
+        ASSERT_TRUE(inserted);
+        EXPECT_EQ(4, inserted->region.width);
+        EXPECT_EQ(4, inserted->region.height);
+        EXPECT_EQ(1, glyphCache.getPageCount());
+        EXPECT_EQ(1, glyphCache.getGlyphCount());
+
+        auto found = glyphCache.find(key);
+        ASSERT_TRUE(found);
+        EXPECT_EQ(inserted->layer, found->layer);
+        EXPECT_EQ(inserted->region.x, found->region.x);
+        EXPECT_EQ(inserted->region.y, found->region.y);
+        EXPECT_FALSE(glyphCache.find(GlyphKey { 0, 2, 12, 0 }));
+
+        EXPECT_TRUE(glyphCache.commit());
+        EXPECT_FALSE(glyphCache.commit());
+        uploadScheduler->wait(uploadScheduler->flush(queue));
+    }
+
+    TEST_F(Text_GlyphCacheTest, NormalCase_EvictOnlyCompletedPages) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes * 2, pageSize };
+        std::vector<std::uint8_t> coverage(10 * 10, 255);
+        GlyphKey first { 0, 1, 12, 0 };
+        GlyphKey second { 0, 2, 12, 0 };
+        GlyphKey third { 0, 3, 12, 0 };
+
+        ASSERT_TRUE(glyphCache.insert(first, coverage.data(), 10, 10));
+        ASSERT_TRUE(glyphCache.insert(second, coverage.data(), 10, 10));
+        EXPECT_FALSE(glyphCache.insert(third, coverage.data(), 10, 10));
+        EXPECT_EQ(0, glyphCache.getEvictionCount());
+
+        glyphCache.beginFrame(2, 0);
+        EXPECT_TRUE(glyphCache.find(second));
+        EXPECT_FALSE(glyphCache.insert(third, coverage.data(), 10, 10));
+
+        glyphCache.beginFrame(3, 1);
+        auto inserted = glyphCache.insert(third, coverage.data(), 10, 10);
+        ASSERT_TRUE(inserted);
+        EXPECT_EQ(1, glyphCache.getEvictionCount());
+        EXPECT_FALSE(glyphCache.find(first));
+        EXPECT_TRUE(glyphCache.find(second));
+        auto evictedKeys = glyphCache.takeEvictedKeys();
+        ASSERT_EQ(1, evictedKeys.size());
+        EXPECT_EQ(first, evictedKeys[0]);
+        EXPECT_TRUE(glyphCache.takeEvictedKeys().empty());
+
+        glyphCache.commit();
+        uploadScheduler->wait(uploadScheduler->flush(queue));
+    }
+
+    TEST_F(Text_GlyphCacheTest, NormalCase_PlaceholderSurvivesEviction) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        CachedGlyph placeholder = glyphCache.getPlaceholder();
+        EXPECT_EQ(0, placeholder.layer);
+        EXPECT_EQ(1, placeholder.region.width);
+        EXPECT_EQ(1, placeholder.region.height);
+        EXPECT_TRUE(glyphCache.canFit(pageSize - 2, pageSize - 5));
+        EXPECT_FALSE(glyphCache.canFit(pageSize - 2, pageSize - 2));
+
+        std::vector<std::uint8_t> coverage(10 * 10, 255);
+        ASSERT_TRUE(glyphCache.insert(GlyphKey { 0, 1, 12, 0 }, coverage.data(), 10, 10));
+        glyphCache.beginFrame(2, 1);
+        auto inserted = glyphCache.insert(GlyphKey { 0, 2, 12, 0 }, coverage.data(), 10, 10);
+        ASSERT_TRUE(inserted);
+        EXPECT_EQ(1, glyphCache.getEvictionCount());
+        EXPECT_GE(inserted->region.x, placeholder.region.x + placeholder.region.width);
+        EXPECT_EQ(placeholder.region.x, glyphCache.getPlaceholder().region.x);
+        EXPECT_EQ(placeholder.region.y, glyphCache.getPlaceholder().region.y);
+
+        glyphCache.commit();
+        uploadScheduler->wait(uploadScheduler->flush(queue));
+    }
+
+    TEST_F(Text_GlyphCacheTest, NormalCase_PageCountIsClampedToMaxImageArrayLayers) {
+        std::uint32_t maxImageArrayLayers = physicalDevice.getProperties().limits.maxImageArrayLayers;
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes * (maxImageArrayLayers + 8), pageSize };
+        EXPECT_EQ(maxImageArrayLayers, glyphCache.getMaxPageCount());
+    }
+
+    TEST_F(Text_GlyphCacheTest, AbnormalCase_InvalidArguments) {
+        std::uint32_t maxImageDimension2D = physicalDevice.getProperties().limits.maxImageDimension2D;
+        EXPECT_THROW((GlyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, maxImageDimension2D + 1 }), std::invalid_argument);
+
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        std::vector<std::uint8_t> coverage(pageSize * pageSize, 255);
+        EXPECT_FALSE(glyphCache.insert(GlyphKey { 0, 1, 12, 0 }, coverage.data(), pageSize, pageSize));
+        EXPECT_EQ(0, glyphCache.getGlyphCount());
+    }
+}
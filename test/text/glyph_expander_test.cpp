@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/glyph_expander.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    class Text_GlyphExpanderTest : public fuji::test::DeviceFixture {
+    protected:
+        // records the expansion and copies the instance and indirect buffers back to the host
+        void expand(const GlyphExpander& expander, vk::Extent2D viewport, glm::vec2 scale, glm::vec2 translation, const vk::Buffer& instances, const vk::Buffer& command) {
+            this->uploadScheduler->flush(this->queue);
+
+            vk::CommandPoolCreateInfo poolInfo {};
+            poolInfo.queueFamilyIndex = 0;
+            vk::UniqueCommandPool commandPool = this->device->createCommandPoolUnique(poolInfo);
+            vk::CommandBufferAllocateInfo allocInfo { commandPool.get(), vk::CommandBufferLevel::ePrimary, 1 };
+            vk::UniqueCommandBuffer commandBuffer = std::move(this->device->allocateCommandBuffersUnique(allocInfo)[0]);
+
+            commandBuffer->begin(vk::CommandBufferBeginInfo { vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+            std::uint64_t uploadValue = expander.record(*commandBuffer, viewport, scale, translation);
+            vk::MemoryBarrier readbackBarrier { vk::AccessFlagBits::eShaderWrite, vk::AccessFlagBits::eTransferRead };
+            commandBuffer->pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eTransfer, vk::DependencyFlags {}, { readbackBarrier }, {}, {});
+            vk::DeviceSize instanceBytes = sizeof(GlyphInstance) * static_cast<vk::DeviceSize>(expander.getMaxGlyphCount());
+            commandBuffer->copyBuffer(expander.getInstanceBuffer(), instances, { vk::BufferCopy { 0, 0, instanceBytes } });
+            commandBuffer->copyBuffer(expander.getIndirectBuffer(), command, { vk::BufferCopy { 0, 0, sizeof(vk::DrawIndirectCommand) } });
+            commandBuffer->end();
+
+            vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eComputeShader;
+            vk::TimelineSemaphoreSubmitInfo timelineInfo {};
+            timelineInfo.waitSemaphoreValueCount = 1;
+            timelineInfo.pWaitSemaphoreValues = &uploadValue;
+            vk::SubmitInfo submitInfo {};
+            submitInfo.pNext = &timelineInfo;
+            submitInfo.waitSemaphoreCount = 1;
+            submitInfo.pWaitSemaphores = &this->uploadScheduler->getTimelineSemaphore();
+            submitInfo.pWaitDstStageMask = &waitStage;
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &commandBuffer.get();
+            this->queue.submit({ submitInfo }, VK_NULL_HANDLE);
+            this->queue.waitIdle();
+        }
+    };
+
+    TEST_F(Text_GlyphExpanderTest, NormalCase_ExpandScalesAndCulls) {
+        GlyphExpander expander { *allocator, *uploadScheduler, 8, 4 };
+        GlyphInstance glyph {};
+        glyph.position = glm::vec2(1.0f, -2.0f);
+        glyph.atlasRect = glm::u16vec4(3, 5, 4, 6);
+        glyph.layer = 2;
+        expander.setGlyph(1, glyph);
+        expander.commit();
+
+        // the last glyph is only visible once its quad is scaled with the text
+        expander.setPlacedGlyphs({
+            PlacedGlyph { glm::vec2(10.0f, 20.0f), 1, 3 },
+            PlacedGlyph { glm::vec2(200.0f, 0.0f), 1, 3 },
+            PlacedGlyph { glm::vec2(10.0f, 10.0f), 0, 3 },
+            PlacedGlyph { glm::vec2(10.0f, 10.0f), 7, 3 },
+            PlacedGlyph { glm::vec2(-6.0f, 10.0f), 1, 4 }
+        });
+        EXPECT_EQ(5, expander.getGlyphCount());
+
+        AllocatedBuffer instances = createHostBuffer(sizeof(GlyphInstance) * 8);
+        AllocatedBuffer command = createHostBuffer(sizeof(vk::DrawIndirectCommand));
+        expand(expander, vk::Extent2D { 100, 100 }, glm::vec2(2.0f), glm::vec2(5.0f), instances.buffer.get(), command.buffer.get());
+
+        allocator->invalidate(command.allocation.get());
+        vk::DrawIndirectCommand drawCommand {};
+        std::memcpy(&drawCommand, command.allocation->mappedData, sizeof(drawCommand));
+        EXPECT_EQ(4, drawCommand.vertexCount);
+        ASSERT_EQ(2, drawCommand.instanceCount);
+        EXPECT_EQ(0, drawCommand.firstInstance);
+
+        allocator->invalidate(instances.allocation.get());
+        std::vector<GlyphInstance> expanded(2);
+        std::memcpy(expanded.data(), instances.allocation->mappedData, sizeof(GlyphInstance) * expanded.size());
+        std::sort(expanded.begin(), expanded.end(), [](auto& a, auto& b) { return a.position.x < b.position.x; });
+
+        EXPECT_FLOAT_EQ(-5.0f, expanded[0].position.x);
+        EXPECT_FLOAT_EQ(21.0f, expanded[0].position.y);
+        EXPECT_EQ(4, expanded[0].colorIndex);
+        EXPECT_FLOAT_EQ(27.0f, expanded[1].position.x);
+        EXPECT_FLOAT_EQ(41.0f, expanded[1].position.y);
+        EXPECT_EQ(3, expanded[1].colorIndex);
+        EXPECT_EQ(glyph.atlasRect, expanded[1].atlasRect);
+        EXPECT_EQ(2, expanded[1].layer);
+    }
+
+    TEST_F(Text_GlyphExpanderTest, AbnormalCase_TooManyPlacedGlyphs) {
+        GlyphExpander expander { *allocator, *uploadScheduler, 1, 4 };
+        EXPECT_THROW(expander.setPlacedGlyphs(std::vector<PlacedGlyph>(2)), std::invalid_argument);
+        EXPECT_THROW(expander.setGlyph(4, GlyphInstance {}), std::out_of_range);
+    }
+
+    TEST_F(Text_GlyphExpanderTest, AbnormalCase_RecordBeforeFlush) {
+        GlyphExpander expander { *allocator, *uploadScheduler, 1, 4 };
+        expander.setPlacedGlyphs({ PlacedGlyph { glm::vec2(0.0f), 0, 0 } });
+
+        vk::CommandPoolCreateInfo poolInfo {};
+        poolInfo.queueFamilyIndex = 0;
+        vk::UniqueCommandPool commandPool = device->createCommandPoolUnique(poolInfo);
+        vk::UniqueCommandBuffer commandBuffer = std::move(device->allocateCommandBuffersUnique(vk::CommandBufferAllocateInfo { commandPool.get(), vk::CommandBufferLevel::ePrimary, 1 })[0]);
+        commandBuffer->begin(vk::CommandBufferBeginInfo { vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+        EXPECT_THROW(expander.record(*commandBuffer, vk::Extent2D { 16, 16 }), std::logic_error);
+        commandBuffer->end();
+        uploadScheduler->wait(uploadScheduler->flush(queue));
+    }
+}
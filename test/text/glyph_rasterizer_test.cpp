@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/glyph_cache.hpp>
+#include <fuji/text/glyph_rasterizer.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    constexpr std::uint32_t pageSize = 16;
+    constexpr vk::DeviceSize pageBytes = pageSize * pageSize;
+
+    // glyph 0 fails to rasterize; every other glyph is a square bitmap of pixelSize texels
+    std::optional<GlyphBitmap> rasterizeGlyph(const GlyphKey& key) {
+        if(key.glyphIndex == 0) {
+            return std::nullopt;
+        }
+        return GlyphBitmap {
+            key.pixelSize,
+            key.pixelSize,
+            static_cast<std::int32_t>(key.glyphIndex),
+            2,
+            std::vector<std::uint8_t>(static_cast<std::size_t>(key.pixelSize) * key.pixelSize, 255)
+        };
+    }
+
+    class Text_GlyphRasterizerTest : public fuji::test::DeviceFixture {
+    protected:
+        void rasterize(GlyphRasterizer& rasterizer) {
+            rasterizer.dispatch();
+            rasterizer.wait();
+            rasterizer.upload();
+            this->uploadScheduler->wait(this->uploadScheduler->flush(this->queue));
+        }
+    };
+
+    TEST_F(Text_GlyphRasterizerTest, NormalCase_RequestReturnsPlaceholderUntilUploaded) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        GlyphRasterizer rasterizer { glyphCache, rasterizeGlyph, 2 };
+        EXPECT_EQ(2, rasterizer.getThreadCount());
+
+        GlyphKey key { 0, 5, 4, 0 };
+        GlyphLookup lookup = rasterizer.request(key);
+        EXPECT_FALSE(lookup.resident);
+        EXPECT_EQ(glyphCache.getPlaceholder().region.x, lookup.glyph.region.x);
+        EXPECT_EQ(glyphCache.getPlaceholder().region.y, lookup.glyph.region.y);
+        EXPECT_EQ(1, rasterizer.getInFlightCount());
+
+        rasterize(rasterizer);
+        EXPECT_EQ(0, rasterizer.getInFlightCount());
+        lookup = rasterizer.request(key);
+        EXPECT_TRUE(lookup.resident);
+        EXPECT_EQ(4, lookup.glyph.region.width);
+        EXPECT_EQ(5, lookup.left);
+        EXPECT_EQ(2, lookup.top);
+    }
+
+    TEST_F(Text_GlyphRasterizerTest, NormalCase_OversizedGlyphDoesNotBlockLaterGlyphs) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        GlyphRasterizer rasterizer { glyphCache, rasterizeGlyph, 1 };
+
+        rasterizer.request(GlyphKey { 0, 1, pageSize, 0 });
+        rasterizer.request(GlyphKey { 0, 0, 4, 0 });
+        rasterizer.request(GlyphKey { 0, 2, 4, 0 });
+        rasterize(rasterizer);
+
+        EXPECT_EQ(2, rasterizer.getFailedCount());
+        EXPECT_EQ(0, rasterizer.getReadyCount());
+        EXPECT_EQ(0, rasterizer.getInFlightCount());
+        EXPECT_TRUE(rasterizer.request(GlyphKey { 0, 2, 4, 0 }).resident);
+        EXPECT_FALSE(rasterizer.request(GlyphKey { 0, 1, pageSize, 0 }).resident);
+        EXPECT_EQ(0, rasterizer.getInFlightCount());
+    }
+
+    TEST_F(Text_GlyphRasterizerTest, NormalCase_PlaceholderIsNotEvicted) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        GlyphRasterizer rasterizer { glyphCache, rasterizeGlyph, 1 };
+        CachedGlyph placeholder = glyphCache.getPlaceholder();
+
+        GlyphKey first { 0, 1, 10, 0 };
+        GlyphKey second { 0, 2, 10, 0 };
+        rasterizer.request(first);
+        rasterize(rasterizer);
+        EXPECT_TRUE(rasterizer.request(first).resident);
+
+        rasterizer.beginFrame(2, 1);
+        rasterizer.request(second);
+        rasterize(rasterizer);
+        EXPECT_EQ(1, glyphCache.getEvictionCount());
+
+        GlyphLookup lookup = rasterizer.request(second);
+        EXPECT_TRUE(lookup.resident);
+        EXPECT_EQ(2, lookup.left);
+        lookup = rasterizer.request(first);
+        EXPECT_FALSE(lookup.resident);
+        EXPECT_EQ(placeholder.layer, lookup.glyph.layer);
+        EXPECT_EQ(placeholder.region.x, lookup.glyph.region.x);
+        EXPECT_EQ(placeholder.region.y, lookup.glyph.region.y);
+    }
+
+    TEST_F(Text_GlyphRasterizerTest, AbnormalCase_MissingRasterizeCallback) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageBytes, pageSize };
+        EXPECT_THROW((GlyphRasterizer { glyphCache, GlyphRasterizer::Rasterize {} }), std::invalid_argument);
+    }
+}
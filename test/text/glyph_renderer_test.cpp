@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/instance.hpp>
+#include <fuji/core/offscreen_renderer.hpp>
+#include <fuji/core/offscreen_target.hpp>
+#include <fuji/core/internal/utility/bindless_image_table.hpp>
+#include <fuji/core/internal/utility/pipeline_cache.hpp>
+#include <fuji/text/glyph_cache.hpp>
+#include <fuji/text/glyph_instance.hpp>
+#include <fuji/text/glyph_renderer.hpp>
+#include <fuji/text/text_batch_queue.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    constexpr std::uint32_t targetSize = 8;
+    constexpr std::uint32_t pageSize = 16;
+
+    class Text_GlyphRendererDrawTest : public fuji::test::DeviceFixture {
+    protected:
+        void SetUp() override {
+            DeviceFixture::SetUp();
+            this->fujiInstance = std::make_unique<fuji::Instance>(this->device, 0, vk::Format::eR8G8B8A8Unorm, 2, DynamicStateSupport {}, vk::ImageLayout::eTransferSrcOptimal);
+            this->fujiInstance->setClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+            this->pipelineCache = std::make_unique<PipelineCache>(this->device.get());
+        }
+        void TearDown() override {
+            pipelineCache.reset();
+            fujiInstance.reset();
+            DeviceFixture::TearDown();
+        }
+
+        // descriptor indexing is enabled where supported so the bindless renderer can be drawn with
+        vk::PhysicalDeviceVulkan12Features getEnabledVulkan12Features() override {
+            vk::PhysicalDeviceVulkan12Features features = DeviceFixture::getEnabledVulkan12Features();
+            if(BindlessImageTable::isSupported(this->physicalDevice)) {
+                features.runtimeDescriptorArray = VK_TRUE;
+                features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+                features.descriptorBindingPartiallyBound = VK_TRUE;
+                features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+                features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            }
+            return features;
+        }
+
+        // palette entry 1 is blue and entry 2 is green
+        AllocatedBuffer createPalette() {
+            std::vector<glm::vec4> colors(GlyphRenderer::paletteSize, glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+            colors[1] = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+            colors[2] = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+            AllocatedBuffer palette = createHostBuffer(GlyphRenderer::paletteByteSize, vk::BufferUsageFlagBits::eUniformBuffer);
+            std::memcpy(palette.allocation->mappedData, colors.data(), GlyphRenderer::paletteByteSize);
+            allocator->flush(palette.allocation.get());
+            return palette;
+        }
+
+        AllocatedBuffer createInstanceBuffer(const std::vector<GlyphInstance>& instances) {
+            AllocatedBuffer buffer = createHostBuffer(sizeof(GlyphInstance) * instances.size(), vk::BufferUsageFlagBits::eVertexBuffer);
+            std::memcpy(buffer.allocation->mappedData, instances.data(), sizeof(GlyphInstance) * instances.size());
+            allocator->flush(buffer.allocation.get());
+            return buffer;
+        }
+
+        // uploads a fully covered size x size glyph and returns it once the upload has completed
+        CachedGlyph insertGlyph(GlyphCache& glyphCache, std::uint32_t glyphIndex, std::uint32_t size) {
+            std::vector<std::uint8_t> coverage(size * size, 255);
+            auto glyph = glyphCache.insert(GlyphKey { 0, glyphIndex, size, 0 }, coverage.data(), size, size);
+            glyphCache.commit();
+            uploadScheduler->wait(uploadScheduler->flush(queue));
+            return glyph.value();
+        }
+
+        // renders into a targetSize x targetSize target cleared to black and returns its RGBA8 texels
+        std::vector<std::uint8_t> render(const fuji::OffscreenRenderer::Draw& draw) {
+            fuji::OffscreenTarget target { *allocator, fujiInstance->getRenderPass(), vk::Format::eR8G8B8A8Unorm, vk::Extent2D { targetSize, targetSize } };
+            fuji::OffscreenRenderer renderer { physicalDevice, *fujiInstance, queue };
+            std::vector<std::uint8_t> pixels;
+            renderer.collect(renderer.submit({ &target }, draw), [&pixels](std::size_t, const std::uint8_t* data, vk::Extent2D extent) {
+                pixels.assign(data, data + extent.width * extent.height * 4);
+            });
+            return pixels;
+        }
+
+        static glm::u8vec4 getPixel(const std::vector<std::uint8_t>& pixels, std::uint32_t x, std::uint32_t y) {
+            const std::uint8_t* texel = pixels.data() + (y * targetSize + x) * 4;
+            return glm::u8vec4(texel[0], texel[1], texel[2], texel[3]);
+        }
+    protected:
+        std::unique_ptr<fuji::Instance> fujiInstance;
+        std::unique_ptr<PipelineCache> pipelineCache;
+    };
+
+    TEST(Text_GlyphRendererTest, NormalCase_InstanceBinding) {
+        auto& bindings = GlyphInputLayout::bindingDescriptions;
+        auto& attributes = GlyphInputLayout::attributeDescriptions;
+
+        ASSERT_EQ(1, bindings.size());
+        EXPECT_EQ(vk::VertexInputRate::eInstance, bindings[0].inputRate);
+        EXPECT_EQ(sizeof(GlyphInstance), bindings[0].stride);
+
+        ASSERT_EQ(4, attributes.size());
+        EXPECT_EQ(vk::Format::eR32G32Sfloat, attributes[0].format);
+        EXPECT_EQ(vk::Format::eR16G16B16A16Uint, attributes[1].format);
+        EXPECT_EQ(8, attributes[1].offset);
+        EXPECT_EQ(vk::Format::eR16Uint, attributes[2].format);
+        EXPECT_EQ(16, attributes[2].offset);
+        EXPECT_EQ(vk::Format::eR16Uint, attributes[3].format);
+        EXPECT_EQ(18, attributes[3].offset);
+        for(std::uint32_t i = 0; i < attributes.size(); i++) {
+            EXPECT_EQ(i, attributes[i].location);
+        }
+    }
+
+    TEST(Text_GlyphRendererTest, NormalCase_CreateInstance) {
+        GlyphLookup lookup {};
+        lookup.glyph.layer = 3;
+        lookup.glyph.region = AtlasRegion { 40, 72, 12, 17, 0.0f, 0.0f, 0.0f, 0.0f };
+        lookup.left = 1;
+        lookup.top = 14;
+        lookup.resident = true;
+
+        GlyphInstance instance = GlyphRenderer::createInstance(glm::vec2(100.0f, 50.0f), lookup, 7);
+        EXPECT_FLOAT_EQ(101.0f, instance.position.x);
+        EXPECT_FLOAT_EQ(36.0f, instance.position.y);
+        EXPECT_EQ(40, instance.atlasRect.x);
+        EXPECT_EQ(72, instance.atlasRect.y);
+        EXPECT_EQ(12, instance.atlasRect.z);
+        EXPECT_EQ(17, instance.atlasRect.w);
+        EXPECT_EQ(3, instance.layer);
+        EXPECT_EQ(7, instance.colorIndex);
+    }
+
+    TEST(Text_GlyphRendererTest, NormalCase_CreateInstanceWithFirstPage) {
+        GlyphLookup lookup {};
+        lookup.glyph.layer = 3;
+        lookup.resident = true;
+
+        GlyphInstance instance = GlyphRenderer::createInstance(glm::vec2(0.0f), lookup, 0, 8);
+        EXPECT_EQ(11, instance.layer);
+    }
+
+    TEST_F(Text_GlyphRendererDrawTest, NormalCase_DrawGlyphFromCache) {
+        GlyphCache glyphCache { physicalDevice, *allocator, *uploadScheduler, pageSize * pageSize, pageSize };
+        CachedGlyph glyph = insertGlyph(glyphCache, 1, 4);
+
+        GlyphRenderer renderer { device.get(), *pipelineCache, fujiInstance->getRenderPass() };
+        EXPECT_FALSE(renderer.isBindless());
+        std::array<vk::DescriptorPoolSize, 2> poolSizes {
+            vk::DescriptorPoolSize { vk::DescriptorType::eCombinedImageSampler, 1 },
+            vk::DescriptorPoolSize { vk::DescriptorType::eUniformBuffer, 1 }
+        };
+        vk::UniqueDescriptorPool descriptorPool = device->createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo { {}, 1, poolSizes });
+        vk::DescriptorSet descriptorSet = device->allocateDescriptorSets(vk::DescriptorSetAllocateInfo { descriptorPool.get(), renderer.getDescriptorSetLayout() })[0];
+        AllocatedBuffer palette = createPalette();
+        renderer.writeDescriptorSet(descriptorSet, glyphCache, palette.buffer.get());
+        AllocatedBuffer instances = createInstanceBuffer({ GlyphRenderer::createInstance(glm::vec2(2.0f, 2.0f), GlyphLookup { glyph, 0, 0, true }, 1) });
+
+        std::vector<std::uint8_t> pixels = render([&](vk::CommandBuffer& commandBuffer, std::size_t) {
+            renderer.bind(commandBuffer, descriptorSet, vk::Extent2D { targetSize, targetSize }, glyphCache.getPageSize());
+            renderer.draw(commandBuffer, instances.buffer.get(), 0, 1);
+        });
+        for(std::uint32_t y = 0; y < targetSize; y++) {
+            for(std::uint32_t x = 0; x < targetSize; x++) {
+                bool covered = x >= 2 && x < 6 && y >= 2 && y < 6;
+                EXPECT_EQ(glm::u8vec4(0, 0, covered ? 255 : 0, 255), getPixel(pixels, x, y));
+            }
+        }
+    }
+
+    TEST_F(Text_GlyphRendererDrawTest, NormalCase_DrawTwoCachesInOneBindlessBatch) {
+        if(!BindlessImageTable::isSupported(physicalDevice)) {
+            GTEST_SKIP() << "descriptor indexing is not supported";
+        }
+        GlyphCache firstCache { physicalDevice, *allocator, *uploadScheduler, pageSize * pageSize, pageSize };
+        GlyphCache secondCache { physicalDevice, *allocator, *uploadScheduler, pageSize * pageSize, pageSize };
+        CachedGlyph firstGlyph = insertGlyph(firstCache, 1, 2);
+        CachedGlyph secondGlyph = insertGlyph(secondCache, 2, 2);
+
+        BindlessImageTable imageTable { physicalDevice, device.get(), 16 };
+        std::uint32_t firstPage = imageTable.add(firstCache.getPageImageViews(), vk::ImageLayout::eGeneral);
+        std::uint32_t secondPage = imageTable.add(secondCache.getPageImageViews(), vk::ImageLayout::eGeneral);
+        EXPECT_NE(firstPage, secondPage);
+
+        GlyphRenderer renderer { device.get(), *pipelineCache, fujiInstance->getRenderPass(), imageTable };
+        EXPECT_TRUE(renderer.isBindless());
+        std::array<vk::DescriptorPoolSize, 2> poolSizes {
+            vk::DescriptorPoolSize { vk::DescriptorType::eSampler, 1 },
+            vk::DescriptorPoolSize { vk::DescriptorType::eUniformBuffer, 1 }
+        };
+        vk::UniqueDescriptorPool descriptorPool = device->createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo { {}, 1, poolSizes });
+        vk::DescriptorSet descriptorSet = device->allocateDescriptorSets(vk::DescriptorSetAllocateInfo { descriptorPool.get(), renderer.getDescriptorSetLayout() })[0];
+        AllocatedBuffer palette = createPalette();
+        renderer.writeDescriptorSet(descriptorSet, palette.buffer.get());
+
+        TextBatchKey key {};
+        key.pipeline = renderer.getPipeline();
+        key.descriptorSet = descriptorSet;
+        key.atlasPageSize = pageSize;
+        TextBatchQueue queue;
+        queue.add(key, glm::vec2(1.0f, 1.0f), { GlyphRenderer::createInstance(glm::vec2(0.0f), GlyphLookup { firstGlyph, 0, 0, true }, 1, firstPage) });
+        queue.add(key, glm::vec2(5.0f, 5.0f), { GlyphRenderer::createInstance(glm::vec2(0.0f), GlyphLookup { secondGlyph, 0, 0, true }, 2, secondPage) });
+        queue.build();
+        ASSERT_EQ(1, queue.getBatches().size());
+        const TextBatch& batch = queue.getBatches()[0];
+        AllocatedBuffer instances = createInstanceBuffer(queue.getInstances());
+
+        std::vector<std::uint8_t> pixels = render([&](vk::CommandBuffer& commandBuffer, std::size_t) {
+            renderer.bind(commandBuffer, batch.key.descriptorSet, vk::Extent2D { targetSize, targetSize }, batch.key.atlasPageSize);
+            renderer.draw(commandBuffer, instances.buffer.get(), 0, batch.instanceCount);
+        });
+        EXPECT_EQ(glm::u8vec4(0, 0, 255, 255), getPixel(pixels, 1, 1));
+        EXPECT_EQ(glm::u8vec4(0, 0, 255, 255), getPixel(pixels, 2, 2));
+        EXPECT_EQ(glm::u8vec4(0, 255, 0, 255), getPixel(pixels, 5, 5));
+        EXPECT_EQ(glm::u8vec4(0, 255, 0, 255), getPixel(pixels, 6, 6));
+        EXPECT_EQ(glm::u8vec4(0, 0, 0, 255), getPixel(pixels, 0, 0));
+        EXPECT_EQ(glm::u8vec4(0, 0, 0, 255), getPixel(pixels, 3, 3));
+        EXPECT_EQ(glm::u8vec4(0, 0, 0, 255), getPixel(pixels, 7, 7));
+    }
+}
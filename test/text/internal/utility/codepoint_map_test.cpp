@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fuji/text/internal/utility/codepoint_map.hpp>
+
+using namespace fuji::text::utility;
+
+namespace {
+    std::uint32_t resolveTestGlyph(char32_t codepoint) {
+        if(codepoint >= U'A' && codepoint <= U'Z') {
+            return codepoint - U'A' + 1;
+        }
+        if(codepoint == U'é') {
+            return 30;
+        }
+        if(codepoint >= U'あ' && codepoint <= U'ん') {
+            return codepoint - U'あ' + 100;
+        }
+        return 0;
+    }
+
+    TEST(Utility_CodepointMapTest, NormalCase_FindBuildsPagesOnDemand) {
+        std::atomic<int> resolveCount { 0 };
+        CodepointMap map { [&resolveCount](char32_t codepoint) { resolveCount++; return resolveTestGlyph(codepoint); } };
+
+        EXPECT_EQ(0, map.getBuiltPageCount());
+        EXPECT_EQ(1, map.find(U'A'));
+        EXPECT_EQ(26, map.find(U'Z'));
+        EXPECT_EQ(30, map.find(U'é'));
+        EXPECT_EQ(0, map.find(U'a'));
+        EXPECT_EQ(1, map.getBuiltPageCount());
+        EXPECT_EQ(256, resolveCount.load());
+
+        EXPECT_EQ(100, map.find(U'あ'));
+        EXPECT_EQ(0, map.find(U'一'));
+        EXPECT_EQ(3, map.getBuiltPageCount());
+        EXPECT_EQ(0, map.find(static_cast<char32_t>(0x110000)));
+    }
+
+    TEST(Utility_CodepointMapTest, NormalCase_BatchMatchesSingleLookup) {
+        CodepointMap map { resolveTestGlyph };
+        std::u32string text = U"ABあCéんんZ!\U0001F600";
+        text.push_back(static_cast<char32_t>(0x110000));
+
+        std::vector<std::uint32_t> glyphIndices(text.size());
+        map.find(text.data(), text.size(), glyphIndices.data());
+        for(std::size_t i = 0; i < text.size(); i++) {
+            EXPECT_EQ(resolveTestGlyph(text[i]), glyphIndices[i]);
+        }
+    }
+
+    TEST(Utility_CodepointMapTest, NormalCase_ConcurrentLookup) {
+        CodepointMap map { resolveTestGlyph };
+        std::atomic<int> mismatchCount { 0 };
+
+        std::vector<std::thread> threads;
+        for(int t = 0; t < 4; t++) {
+            threads.emplace_back([&map, &mismatchCount] {
+                for(char32_t codepoint = 0; codepoint < 0x4000; codepoint++) {
+                    if(map.find(codepoint) != resolveTestGlyph(codepoint)) {
+                        mismatchCount++;
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount.load());
+        EXPECT_EQ(0x4000 / CodepointMap::pageSize, map.getBuiltPageCount());
+    }
+
+    TEST(Utility_CodepointMapTest, AbnormalCase_NoResolver) {
+        EXPECT_THROW(CodepointMap { CodepointMap::Resolve {} }, std::invalid_argument);
+    }
+}
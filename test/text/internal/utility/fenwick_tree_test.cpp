@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <fuji/text/internal/utility/fenwick_tree.hpp>
+
+using namespace fuji::text::utility;
+
+namespace {
+    void expectPrefixSums(const FenwickTree& tree, const std::vector<std::int64_t>& values) {
+        ASSERT_EQ(values.size(), tree.size());
+        std::int64_t sum = 0;
+        for(std::size_t i = 0; i <= values.size(); i++) {
+            EXPECT_EQ(sum, tree.prefixSum(i));
+            if(i < values.size()) {
+                EXPECT_EQ(values[i], tree.get(i));
+                sum += values[i];
+            }
+        }
+    }
+
+    TEST(Utility_FenwickTreeTest, NormalCase_PrefixSum) {
+        std::vector<std::int64_t> values { 3, 1, 4, 1, 5, 9, 2, 6, 5 };
+        FenwickTree tree { values };
+        expectPrefixSums(tree, values);
+        EXPECT_EQ(36, tree.total());
+
+        tree.add(3, 10);
+        values[3] += 10;
+        tree.set(8, 0);
+        values[8] = 0;
+        expectPrefixSums(tree, values);
+    }
+
+    TEST(Utility_FenwickTreeTest, NormalCase_PushBackInsertErase) {
+        FenwickTree tree;
+        std::vector<std::int64_t> values;
+        for(std::int64_t i = 1; i <= 37; i++) {
+            tree.pushBack(i % 5 + 1);
+            values.push_back(i % 5 + 1);
+        }
+        expectPrefixSums(tree, values);
+
+        tree.insert(4, 7);
+        values.insert(values.begin() + 4, 7);
+        tree.erase(0);
+        values.erase(values.begin());
+        tree.erase(values.size() - 1);
+        values.pop_back();
+        expectPrefixSums(tree, values);
+    }
+
+    TEST(Utility_FenwickTreeTest, NormalCase_UpperBound) {
+        FenwickTree tree { { 2, 1, 3 } };
+
+        EXPECT_EQ(0, tree.upperBound(0));
+        EXPECT_EQ(0, tree.upperBound(1));
+        EXPECT_EQ(1, tree.upperBound(2));
+        EXPECT_EQ(2, tree.upperBound(3));
+        EXPECT_EQ(2, tree.upperBound(5));
+        EXPECT_EQ(3, tree.upperBound(6));
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <fuji/text/internal/utility/paged_glyph_index.hpp>
+
+using namespace fuji::text;
+using namespace fuji::text::utility;
+
+namespace {
+    GlyphKey createKey(std::uint32_t glyphIndex) {
+        return GlyphKey { 0, glyphIndex, 16, 0 };
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, NormalCase_FindTouchesEntry) {
+        PagedGlyphIndex index { 32, 32, 2 };
+
+        auto insertion = index.insert(createKey(1), 16, 16, 1, 0);
+        ASSERT_TRUE(insertion.has_value());
+        EXPECT_FALSE(insertion->evictedPage.has_value());
+
+        auto entry = index.find(createKey(1), 5);
+        ASSERT_NE(nullptr, entry);
+        EXPECT_EQ(5, entry->lastUsedFrame);
+        EXPECT_EQ(nullptr, index.find(createKey(2), 5));
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, NormalCase_EvictLeastRecentlyUsedPage) {
+        PagedGlyphIndex index { 32, 32, 2 };
+
+        ASSERT_TRUE(index.insert(createKey(1), 32, 32, 1, 0).has_value());
+        ASSERT_TRUE(index.insert(createKey(2), 32, 32, 2, 0).has_value());
+        index.find(createKey(1), 3);
+
+        auto insertion = index.insert(createKey(3), 32, 32, 6, 4);
+        ASSERT_TRUE(insertion.has_value());
+        ASSERT_TRUE(insertion->evictedPage.has_value());
+        EXPECT_EQ(1, insertion->evictedPage.value());
+        EXPECT_EQ(nullptr, index.find(createKey(2), 6));
+        EXPECT_NE(nullptr, index.find(createKey(1), 6));
+        EXPECT_EQ(1, index.getEvictionCount());
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, NormalCase_ReservedRegionSurvivesEviction) {
+        PagedGlyphIndex index { 32, 32, 1 };
+        auto reserved = index.reserve(4, 4);
+        EXPECT_EQ(0, reserved.page);
+        EXPECT_EQ(0, reserved.rect.x);
+        EXPECT_EQ(0, reserved.rect.y);
+        EXPECT_EQ(1, index.getPageCount());
+        EXPECT_EQ(0, index.getGlyphCount());
+        EXPECT_TRUE(index.canFit(28, 32));
+        EXPECT_TRUE(index.canFit(32, 28));
+        EXPECT_FALSE(index.canFit(32, 32));
+
+        ASSERT_TRUE(index.insert(createKey(1), 28, 32, 1, 0).has_value());
+        auto insertion = index.insert(createKey(2), 28, 32, 2, 1);
+        ASSERT_TRUE(insertion.has_value());
+        ASSERT_TRUE(insertion->evictedPage.has_value());
+        ASSERT_EQ(1, insertion->evictedKeys.size());
+        EXPECT_EQ(createKey(1), insertion->evictedKeys[0]);
+        EXPECT_EQ(4, insertion->entry.rect.x);
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, NormalCase_ReservedPageSkippedWhenGlyphCannotFit) {
+        PagedGlyphIndex index { 32, 32, 2 };
+        index.reserve(4, 4);
+
+        auto first = index.insert(createKey(1), 32, 30, 1, 0);
+        ASSERT_TRUE(first.has_value());
+        EXPECT_EQ(1, first->entry.page);
+
+        auto second = index.insert(createKey(2), 32, 30, 2, 1);
+        ASSERT_TRUE(second.has_value());
+        ASSERT_TRUE(second->evictedPage.has_value());
+        EXPECT_EQ(1, second->evictedPage.value());
+        EXPECT_EQ(1, second->entry.page);
+
+        EXPECT_FALSE(index.insert(createKey(3), 32, 30, 3, 1).has_value());
+        EXPECT_NE(nullptr, index.find(createKey(2), 3));
+        EXPECT_EQ(1, index.getEvictionCount());
+
+        index.clear();
+        EXPECT_EQ(0, index.getEvictionCount());
+        EXPECT_EQ(0, index.getGlyphCount());
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, AbnormalCase_InFlightPagesAreKept) {
+        PagedGlyphIndex index { 32, 32, 1 };
+
+        ASSERT_TRUE(index.insert(createKey(1), 32, 32, 3, 0).has_value());
+        EXPECT_FALSE(index.insert(createKey(2), 32, 32, 4, 2).has_value());
+        EXPECT_NE(nullptr, index.find(createKey(1), 4));
+        EXPECT_FALSE(index.insert(createKey(3), 64, 8, 4, 4).has_value());
+    }
+
+    TEST(Utility_PagedGlyphIndexTest, AbnormalCase_InvalidReservation) {
+        PagedGlyphIndex index { 32, 32, 2 };
+        EXPECT_THROW(index.reserve(64, 4), std::invalid_argument);
+        ASSERT_TRUE(index.insert(createKey(1), 8, 8, 1, 0).has_value());
+        EXPECT_THROW(index.reserve(4, 4), std::logic_error);
+    }
+}
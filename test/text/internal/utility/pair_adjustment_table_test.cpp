@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <fuji/text/internal/utility/pair_adjustment_table.hpp>
+
+using namespace fuji::text::utility;
+
+namespace {
+    using Bytes = std::vector<std::uint8_t>;
+
+    void put16(Bytes& bytes, std::uint16_t value) {
+        bytes.push_back(static_cast<std::uint8_t>(value >> 8));
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    void put32(Bytes& bytes, std::uint32_t value) {
+        put16(bytes, static_cast<std::uint16_t>(value >> 16));
+        put16(bytes, static_cast<std::uint16_t>(value));
+    }
+
+    void append(Bytes& bytes, const Bytes& other) {
+        bytes.insert(bytes.end(), other.begin(), other.end());
+    }
+
+    SfntReader toReader(const Bytes& bytes) {
+        return SfntReader { bytes.data(), bytes.size() };
+    }
+
+    Bytes createKern() {
+        Bytes kern;
+        put16(kern, 0);
+        put16(kern, 2);
+
+        put16(kern, 0);
+        put16(kern, 14 + 2 * 6);
+        put16(kern, 0x0001);
+        put16(kern, 2);
+        put16(kern, 12);
+        put16(kern, 1);
+        put16(kern, 0);
+        put16(kern, 1);
+        put16(kern, 2);
+        put16(kern, static_cast<std::uint16_t>(-80));
+        put16(kern, 3);
+        put16(kern, 4);
+        put16(kern, 40);
+
+        put16(kern, 0);
+        put16(kern, 14 + 6);
+        put16(kern, 0x0004 | 0x0001);
+        put16(kern, 1);
+        put16(kern, 6);
+        put16(kern, 0);
+        put16(kern, 0);
+        put16(kern, 5);
+        put16(kern, 6);
+        put16(kern, 99);
+        return kern;
+    }
+
+    Bytes createPairPosFormat1() {
+        Bytes subtable;
+        put16(subtable, 1);
+        put16(subtable, 12);
+        put16(subtable, 0x0004);
+        put16(subtable, 0);
+        put16(subtable, 1);
+        put16(subtable, 18);
+        put16(subtable, 1);
+        put16(subtable, 1);
+        put16(subtable, 10);
+        put16(subtable, 1);
+        put16(subtable, 20);
+        put16(subtable, static_cast<std::uint16_t>(-50));
+        return subtable;
+    }
+
+    Bytes createPairPosFormat2() {
+        Bytes subtable;
+        put16(subtable, 2);
+        put16(subtable, 32);
+        put16(subtable, 0x0005);
+        put16(subtable, 0);
+        put16(subtable, 42);
+        put16(subtable, 54);
+        put16(subtable, 2);
+        put16(subtable, 2);
+        for(std::int16_t value : { 0, 0, 0, 0, 0, 0, 7, -30 }) {
+            put16(subtable, static_cast<std::uint16_t>(value));
+        }
+        put16(subtable, 2);
+        put16(subtable, 1);
+        put16(subtable, 10);
+        put16(subtable, 12);
+        put16(subtable, 0);
+        put16(subtable, 1);
+        put16(subtable, 10);
+        put16(subtable, 3);
+        put16(subtable, 1);
+        put16(subtable, 0);
+        put16(subtable, 1);
+        put16(subtable, 2);
+        put16(subtable, 1);
+        put16(subtable, 30);
+        put16(subtable, 31);
+        put16(subtable, 1);
+        return subtable;
+    }
+
+    Bytes createGpos() {
+        Bytes pairPos1 = createPairPosFormat1();
+        Bytes pairPos2 = createPairPosFormat2();
+
+        Bytes featureList;
+        put16(featureList, 2);
+        put32(featureList, makeTag('l', 'i', 'g', 'a'));
+        put16(featureList, 14);
+        put32(featureList, makeTag('k', 'e', 'r', 'n'));
+        put16(featureList, 20);
+        put16(featureList, 0);
+        put16(featureList, 1);
+        put16(featureList, 2);
+        put16(featureList, 0);
+        put16(featureList, 2);
+        put16(featureList, 1);
+        put16(featureList, 0);
+
+        Bytes extension;
+        put16(extension, 1);
+        put16(extension, 2);
+        put32(extension, 8);
+        append(extension, pairPos2);
+
+        Bytes lookup0;
+        put16(lookup0, 2);
+        put16(lookup0, 0);
+        put16(lookup0, 1);
+        put16(lookup0, 8);
+        append(lookup0, pairPos1);
+
+        Bytes lookup1;
+        put16(lookup1, 9);
+        put16(lookup1, 0);
+        put16(lookup1, 1);
+        put16(lookup1, 8);
+        append(lookup1, extension);
+
+        Bytes lookup2;
+        put16(lookup2, 2);
+        put16(lookup2, 0);
+        put16(lookup2, 1);
+        put16(lookup2, 8);
+        Bytes unused = createPairPosFormat1();
+        unused[unused.size() - 1] = 1;
+        append(lookup2, unused);
+
+        Bytes lookupList;
+        put16(lookupList, 3);
+        std::uint16_t offset = 8;
+        for(const Bytes* lookup : { &lookup0, &lookup1, &lookup2 }) {
+            put16(lookupList, offset);
+            offset += static_cast<std::uint16_t>(lookup->size());
+        }
+        append(lookupList, lookup0);
+        append(lookupList, lookup1);
+        append(lookupList, lookup2);
+
+        Bytes gpos;
+        put16(gpos, 1);
+        put16(gpos, 0);
+        put16(gpos, 0);
+        put16(gpos, 10);
+        put16(gpos, static_cast<std::uint16_t>(10 + featureList.size()));
+        append(gpos, featureList);
+        append(gpos, lookupList);
+        return gpos;
+    }
+
+    TEST(Utility_PairAdjustmentTableTest, NormalCase_Kern) {
+        Bytes kern = createKern();
+        PairAdjustmentTable table = PairAdjustmentTable::fromKern(toReader(kern));
+
+        EXPECT_EQ(2, table.getPairCount());
+        EXPECT_EQ(-80, table.find(1, 2));
+        EXPECT_EQ(40, table.find(3, 4));
+        EXPECT_EQ(0, table.find(2, 1));
+        EXPECT_EQ(0, table.find(5, 6));
+    }
+
+    TEST(Utility_PairAdjustmentTableTest, NormalCase_Gpos) {
+        Bytes gpos = createGpos();
+        PairAdjustmentTable table = PairAdjustmentTable::fromGpos(toReader(gpos));
+
+        EXPECT_EQ(1, table.getPairCount());
+        EXPECT_EQ(1, table.getClassSubtableCount());
+        EXPECT_EQ(-50, table.find(10, 20));
+        EXPECT_EQ(-30, table.find(10, 30));
+        EXPECT_EQ(-30, table.find(12, 31));
+        EXPECT_EQ(0, table.find(12, 32));
+        EXPECT_EQ(0, table.find(11, 30));
+    }
+
+    TEST(Utility_PairAdjustmentTableTest, NormalCase_ApplyRun) {
+        Bytes gpos = createGpos();
+        PairAdjustmentTable table = PairAdjustmentTable::fromGpos(toReader(gpos));
+
+        std::vector<std::uint32_t> glyphs { 10, 20, 12, 30, 70000, 10 };
+        std::vector<std::int32_t> adjustments(glyphs.size(), 1);
+        table.apply(glyphs.data(), glyphs.size(), adjustments.data());
+
+        std::vector<std::int32_t> expected { -50, 0, -30, 0, 0, 0 };
+        EXPECT_EQ(expected, adjustments);
+    }
+
+    TEST(Utility_PairAdjustmentTableTest, NormalCase_ManyPairs) {
+        Bytes kern;
+        put16(kern, 0);
+        put16(kern, 1);
+        put16(kern, 0);
+        put16(kern, static_cast<std::uint16_t>(14 + 1000 * 6));
+        put16(kern, 0x0001);
+        put16(kern, 1000);
+        put16(kern, 0);
+        put16(kern, 0);
+        put16(kern, 0);
+        for(std::uint16_t i = 0; i < 1000; i++) {
+            put16(kern, i);
+            put16(kern, static_cast<std::uint16_t>(i + 1));
+            put16(kern, static_cast<std::uint16_t>(-static_cast<std::int16_t>(i % 100)));
+        }
+        PairAdjustmentTable table = PairAdjustmentTable::fromKern(toReader(kern));
+
+        EXPECT_EQ(1000, table.getPairCount());
+        for(std::uint16_t i = 0; i < 1000; i++) {
+            EXPECT_EQ(-static_cast<std::int16_t>(i % 100), table.find(i, static_cast<std::uint16_t>(i + 1)));
+        }
+    }
+
+    TEST(Utility_PairAdjustmentTableTest, AbnormalCase_Truncated) {
+        Bytes gpos = createGpos();
+        gpos.resize(30);
+
+        EXPECT_THROW(PairAdjustmentTable::fromGpos(toReader(gpos)), std::runtime_error);
+        EXPECT_TRUE(PairAdjustmentTable {}.empty());
+    }
+}
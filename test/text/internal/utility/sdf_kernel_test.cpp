@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <fuji/text/internal/utility/sdf_kernel.hpp>
+
+using namespace fuji::text::utility;
+
+namespace {
+    TEST(Utility_SdfKernelTest, NormalCase_MatchesScalar) {
+        std::vector<LineSegment> segments = {
+            { 1.0f, 1.0f, 20.0f, 3.0f },
+            { 20.0f, 3.0f, 7.5f, 9.0f },
+            { 7.5f, 9.0f, 1.0f, 1.0f },
+            { 4.0f, 4.0f, 4.0f, 4.0f }
+        };
+        for(float y : { 0.5f, 3.5f, 8.25f }) {
+            std::vector<float> expected(37, 1000.0f);
+            std::vector<float> actual(37, 1000.0f);
+            updateRowDistancesScalar(expected.data(), 37, y, segments.data(), segments.size());
+            updateRowDistances(actual.data(), 37, y, segments.data(), segments.size());
+            for(std::size_t i = 0; i < expected.size(); i++) {
+                EXPECT_NEAR(expected[i], actual[i], 1e-3f) << getSdfKernelName() << " x=" << i << " y=" << y;
+            }
+        }
+    }
+
+    TEST(Utility_SdfKernelTest, NormalCase_DistanceToHorizontalSegment) {
+        LineSegment segment { 2.0f, 5.0f, 6.0f, 5.0f };
+        std::vector<float> distances(10, 1000.0f);
+        updateRowDistances(distances.data(), 10, 2.0f, &segment, 1);
+
+        EXPECT_FLOAT_EQ(9.0f, distances[3]);
+        EXPECT_FLOAT_EQ(1.5f * 1.5f + 9.0f, distances[0]);
+        EXPECT_FLOAT_EQ(3.5f * 3.5f + 9.0f, distances[9]);
+    }
+}
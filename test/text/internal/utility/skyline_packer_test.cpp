@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <fuji/text/internal/utility/skyline_packer.hpp>
+
+using namespace fuji::text::utility;
+
+namespace {
+    bool overlaps(const PackedRect& lhs, const PackedRect& rhs) {
+        return lhs.x < rhs.x + rhs.width && rhs.x < lhs.x + lhs.width
+            && lhs.y < rhs.y + rhs.height && rhs.y < lhs.y + lhs.height;
+    }
+
+    TEST(Utility_SkylinePackerTest, NormalCase_PackBottomLeft) {
+        SkylinePacker packer { 64, 64 };
+
+        auto first = packer.pack(32, 16);
+        auto second = packer.pack(32, 8);
+        auto third = packer.pack(16, 16);
+        ASSERT_TRUE(first.has_value());
+        ASSERT_TRUE(second.has_value());
+        ASSERT_TRUE(third.has_value());
+        EXPECT_EQ(0, first->x);
+        EXPECT_EQ(0, first->y);
+        EXPECT_EQ(32, second->x);
+        EXPECT_EQ(0, second->y);
+        EXPECT_EQ(32, third->x);
+        EXPECT_EQ(8, third->y);
+    }
+
+    TEST(Utility_SkylinePackerTest, NormalCase_NoOverlap) {
+        SkylinePacker packer { 128, 128 };
+        std::vector<PackedRect> rects;
+        for(std::uint32_t i = 0; i < 64; i++) {
+            auto rect = packer.pack(5 + i % 11, 7 + i % 5);
+            ASSERT_TRUE(rect.has_value());
+            for(auto& other : rects) {
+                EXPECT_FALSE(overlaps(*rect, other));
+            }
+            EXPECT_LE(rect->x + rect->width, 128);
+            EXPECT_LE(rect->y + rect->height, 128);
+            rects.push_back(*rect);
+        }
+        EXPECT_GT(packer.getOccupancy(), 0.0f);
+    }
+
+    TEST(Utility_SkylinePackerTest, AbnormalCase_Full) {
+        SkylinePacker packer { 32, 32 };
+
+        EXPECT_TRUE(packer.pack(32, 32).has_value());
+        EXPECT_FALSE(packer.pack(1, 1).has_value());
+        EXPECT_FALSE(SkylinePacker(16, 16).pack(17, 1).has_value());
+
+        packer.reset();
+        EXPECT_TRUE(packer.pack(1, 1).has_value());
+    }
+}
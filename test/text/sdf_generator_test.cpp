@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <fuji/text/sdf_generator.hpp>
+
+using namespace fuji::text;
+
+namespace {
+    Outline createSquare(float size) {
+        Outline outline;
+        outline.moveTo(0.0f, 0.0f);
+        outline.lineTo(size, 0.0f);
+        outline.lineTo(size, size);
+        outline.lineTo(0.0f, size);
+        outline.close();
+        return outline;
+    }
+
+    TEST(Text_SdfGeneratorTest, NormalCase_Square) {
+        SdfGenerator generator { 4.0f };
+        SdfBitmap bitmap = generator.generate(createSquare(16.0f), 1.0f);
+
+        ASSERT_EQ(24, bitmap.width);
+        ASSERT_EQ(24, bitmap.height);
+        EXPECT_EQ(-4, bitmap.left);
+        EXPECT_EQ(20, bitmap.top);
+
+        auto at = [&bitmap](std::uint32_t x, std::uint32_t y) { return bitmap.pixels[y * bitmap.width + x]; };
+        EXPECT_EQ(255, at(12, 12));
+        EXPECT_EQ(0, at(0, 0));
+        EXPECT_NEAR(128, at(4, 12), 20);
+        EXPECT_GT(at(5, 12), at(4, 12));
+        EXPECT_LT(at(3, 12), at(4, 12));
+    }
+
+    TEST(Text_SdfGeneratorTest, NormalCase_ScaleIndependentEdge) {
+        SdfGenerator generator { 4.0f };
+        Outline outline;
+        outline.moveTo(0.0f, 0.0f);
+        outline.quadTo(50.0f, 100.0f, 100.0f, 0.0f);
+        outline.close();
+
+        SdfBitmap small = generator.generate(outline, 0.1f);
+        SdfBitmap large = generator.generate(outline, 0.5f);
+        EXPECT_LT(small.width, large.width);
+        EXPECT_LT(small.height, large.height);
+    }
+
+    TEST(Text_SdfGeneratorTest, AbnormalCase_EmptyOutline) {
+        SdfBitmap bitmap = SdfGenerator {}.generate(Outline {}, 1.0f);
+        EXPECT_EQ(0, bitmap.width);
+        EXPECT_TRUE(bitmap.pixels.empty());
+    }
+}
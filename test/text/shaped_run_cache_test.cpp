@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fuji/text/shaped_run_cache.hpp>
+
+using namespace fuji::text;
+
+namespace {
+    ShapedRun shapeBytes(const ShapingKey& key, std::string_view text) {
+        ShapedRun run { {}, 0.0f };
+        for(std::size_t i = 0; i < text.size(); i++) {
+            run.glyphs.push_back(ShapedGlyph { static_cast<std::uint8_t>(text[i]), static_cast<std::uint32_t>(i), key.size * 0.5f, 0.0f, 0.0f });
+            run.advance += key.size * 0.5f;
+        }
+        return run;
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_HitAndMiss) {
+        ShapedRunCache cache { 1 << 20 };
+        ShapingKey key { 1, 16.0f, {} };
+        int shapeCount = 0;
+        auto shaper = [&shapeCount](const ShapingKey& key, std::string_view text) { shapeCount++; return shapeBytes(key, text); };
+
+        auto first = cache.shape(key, "File", shaper);
+        auto second = cache.shape(key, "File", shaper);
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(1, shapeCount);
+        EXPECT_EQ(1, cache.getHitCount());
+        EXPECT_EQ(1, cache.getMissCount());
+        EXPECT_FLOAT_EQ(32.0f, first->advance);
+
+        cache.shape(ShapingKey { 1, 24.0f, {} }, "File", shaper);
+        cache.shape(ShapingKey { 2, 16.0f, {} }, "File", shaper);
+        cache.shape(ShapingKey { 1, 16.0f, { FontFeature { 0x6C696761, 0 } } }, "File", shaper);
+        EXPECT_EQ(4, shapeCount);
+        EXPECT_EQ(4, cache.getEntryCount());
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_FeatureHashIgnoresOrder) {
+        std::vector<FontFeature> features { FontFeature { 0x6B65726E, 1 }, FontFeature { 0x6C696761, 0 } };
+        std::vector<FontFeature> reversed { features[1], features[0] };
+
+        EXPECT_EQ(ShapingKey::hashFeatures(features), ShapingKey::hashFeatures(reversed));
+        EXPECT_NE(ShapingKey::hashFeatures(features), ShapingKey::hashFeatures({ features[0] }));
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_CanonicalizeFeatures) {
+        FontFeature kerningOff { 0x6B65726E, 0 };
+        FontFeature kerningOn { 0x6B65726E, 1 };
+        FontFeature ligatures { 0x6C696761, 0 };
+
+        std::vector<FontFeature> expected { kerningOn, ligatures };
+        EXPECT_EQ(expected, ShapingKey::canonicalizeFeatures({ ligatures, kerningOff, kerningOn }));
+        EXPECT_EQ(expected, ShapingKey::canonicalizeFeatures({ kerningOn, ligatures, kerningOn }));
+        EXPECT_NE(ShapingKey::hashFeatures({ kerningOff, kerningOn }), ShapingKey::hashFeatures({ kerningOn, kerningOff }));
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_KeyComparesFeatureLists) {
+        ShapedRunCache cache { 1 << 20 };
+        FontFeature kerning { 0x6B65726E, 1 };
+        FontFeature ligatures { 0x6C696761, 0 };
+        int shapeCount = 0;
+        auto shaper = [&shapeCount](const ShapingKey& key, std::string_view text) { shapeCount++; return shapeBytes(key, text); };
+
+        auto first = cache.shape(ShapingKey { 1, 16.0f, { kerning, ligatures } }, "File", shaper);
+        EXPECT_EQ(first, cache.shape(ShapingKey { 1, 16.0f, { ligatures, kerning } }, "File", shaper));
+        EXPECT_EQ(1, shapeCount);
+
+        cache.shape(ShapingKey { 1, 16.0f, { kerning, FontFeature { 0x6C696761, 1 } } }, "File", shaper);
+        cache.shape(ShapingKey { 1, 16.0f, { kerning, kerning } }, "File", shaper);
+        cache.shape(ShapingKey { 1, 16.0f, { kerning } }, "File", shaper);
+        EXPECT_EQ(3, shapeCount);
+
+        FontFeature noKerning { 0x6B65726E, 0 };
+        cache.shape(ShapingKey { 1, 16.0f, { noKerning, kerning } }, "File", shaper);
+        EXPECT_EQ(3, shapeCount);
+        cache.shape(ShapingKey { 1, 16.0f, { kerning, noKerning } }, "File", shaper);
+        EXPECT_EQ(4, shapeCount);
+        EXPECT_EQ(4, cache.getEntryCount());
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_EvictLeastRecentlyUsed) {
+        ShapingKey key { 1, 16.0f, {} };
+        ShapedRunCache probe { 1 << 20 };
+        probe.insert(key, "aaaa", shapeBytes(key, "aaaa"));
+        std::size_t entrySize = probe.getMemoryUsage();
+
+        ShapedRunCache cache { entrySize * 2 };
+        auto held = cache.insert(key, "aaaa", shapeBytes(key, "aaaa"));
+        cache.insert(key, "bbbb", shapeBytes(key, "bbbb"));
+        EXPECT_NE(nullptr, cache.find(key, "aaaa"));
+        cache.insert(key, "cccc", shapeBytes(key, "cccc"));
+
+        EXPECT_EQ(2, cache.getEntryCount());
+        EXPECT_EQ(1, cache.getEvictionCount());
+        EXPECT_LE(cache.getMemoryUsage(), cache.getMemoryBudget());
+        EXPECT_NE(nullptr, cache.find(key, "aaaa"));
+        EXPECT_EQ(nullptr, cache.find(key, "bbbb"));
+        EXPECT_EQ(4, held->glyphs.size());
+    }
+
+    TEST(Text_ShapedRunCacheTest, NormalCase_SplitWords) {
+        ShapedRunCache cache { 1 << 20 };
+        ShapingKey key { 1, 16.0f, {} };
+        std::vector<std::string> shaped;
+        auto shaper = [&shaped](const ShapingKey& key, std::string_view text) { shaped.emplace_back(text); return shapeBytes(key, text); };
+
+        auto run = cache.shape(key, "open  the file", shaper, true);
+        ASSERT_EQ(14, run->glyphs.size());
+        for(std::size_t i = 0; i < run->glyphs.size(); i++) {
+            EXPECT_EQ(i, run->glyphs[i].cluster);
+        }
+        EXPECT_FLOAT_EQ(112.0f, run->advance);
+
+        cache.shape(key, "close the file", shaper, true);
+        std::vector<std::string> expected { "open  ", "the ", "file", "close " };
+        EXPECT_EQ(expected, shaped);
+        EXPECT_EQ(shaped.size(), cache.getMissCount());
+        EXPECT_EQ(run, cache.shape(key, "open  the file", shaper, true));
+    }
+
+    TEST(Text_ShapedRunCacheTest, AbnormalCase_RunLargerThanBudget) {
+        ShapedRunCache cache { 16 };
+        ShapingKey key { 1, 16.0f, {} };
+
+        auto run = cache.insert(key, "label", shapeBytes(key, "label"));
+        EXPECT_EQ(5, run->glyphs.size());
+        EXPECT_EQ(0, cache.getEntryCount());
+        EXPECT_EQ(0, cache.getMemoryUsage());
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/text/text_batch_queue.hpp>
+
+using namespace fuji::text;
+
+namespace {
+    class Text_TextBatchQueueTest : public testing::Test {
+    protected:
+        static TextBatchKey createKey(std::uintptr_t pipeline, std::uintptr_t descriptorSet, std::int32_t order = 0) {
+            TextBatchKey key {};
+            key.order = order;
+            key.pipeline = vk::Pipeline { reinterpret_cast<VkPipeline>(pipeline) };
+            key.descriptorSet = vk::DescriptorSet { reinterpret_cast<VkDescriptorSet>(descriptorSet) };
+            return key;
+        }
+
+        static std::vector<GlyphInstance> createInstances(std::uint16_t colorIndex, std::size_t count) {
+            std::vector<GlyphInstance> instances(count);
+            for(std::size_t i = 0; i < count; i++) {
+                instances[i].position = glm::vec2(static_cast<float>(i), 0.0f);
+                instances[i].colorIndex = colorIndex;
+            }
+            return instances;
+        }
+    };
+
+    TEST_F(Text_TextBatchQueueTest, NormalCase_MergeBlocksWithSameState) {
+        TextBatchQueue queue;
+        for(std::uint16_t i = 0; i < 100; i++) {
+            queue.add(createKey(1 + i % 2, 7), glm::vec2(0.0f, 10.0f * i), createInstances(i, 3));
+        }
+        queue.build();
+
+        ASSERT_EQ(2, queue.getBatches().size());
+        EXPECT_EQ(100, queue.getBlockCount());
+        EXPECT_EQ(300, queue.getInstances().size());
+        for(auto& batch : queue.getBatches()) {
+            EXPECT_EQ(50, batch.blockCount);
+            EXPECT_EQ(150, batch.instanceCount);
+        }
+        EXPECT_EQ(0, queue.getBatches()[0].firstInstance);
+        EXPECT_EQ(150, queue.getBatches()[1].firstInstance);
+
+        const GlyphInstance& instance = queue.getInstances()[4];
+        EXPECT_EQ(2, instance.colorIndex);
+        EXPECT_FLOAT_EQ(1.0f, instance.position.x);
+        EXPECT_FLOAT_EQ(20.0f, instance.position.y);
+    }
+
+    TEST_F(Text_TextBatchQueueTest, NormalCase_OrderSplitsBatches) {
+        TextBatchQueue queue;
+        queue.add(createKey(2, 1, 1), glm::vec2(0.0f), createInstances(0, 1));
+        queue.add(createKey(1, 1, 0), glm::vec2(0.0f), createInstances(1, 1));
+        queue.add(createKey(2, 1, 0), glm::vec2(0.0f), createInstances(2, 1));
+        queue.add(createKey(1, 1, 2), glm::vec2(0.0f), createInstances(3, 1));
+        queue.build();
+
+        ASSERT_EQ(3, queue.getBatches().size());
+        EXPECT_EQ(1, queue.getBatches()[0].instanceCount);
+        EXPECT_EQ(2, queue.getBatches()[1].instanceCount);
+        EXPECT_EQ(2, queue.getBatches()[1].blockCount);
+        EXPECT_EQ(2, queue.getBatches()[2].key.order);
+
+        std::vector<std::uint16_t> colors;
+        for(auto& instance : queue.getInstances()) {
+            colors.push_back(instance.colorIndex);
+        }
+        std::vector<std::uint16_t> expected { 1, 2, 0, 3 };
+        EXPECT_EQ(expected, colors);
+    }
+
+    TEST_F(Text_TextBatchQueueTest, NormalCase_AtlasPageSizeSplitsBatches) {
+        TextBatchQueue queue;
+        TextBatchKey small = createKey(1, 1);
+        small.atlasPageSize = 512;
+        TextBatchKey large = createKey(1, 1);
+        large.atlasPageSize = 1024;
+        queue.add(small, glm::vec2(0.0f), createInstances(0, 2));
+        queue.add(large, glm::vec2(0.0f), createInstances(1, 1));
+        queue.add(small, glm::vec2(0.0f), createInstances(2, 1));
+        queue.build();
+
+        ASSERT_EQ(2, queue.getBatches().size());
+        EXPECT_EQ(512, queue.getBatches()[0].key.atlasPageSize);
+        EXPECT_EQ(3, queue.getBatches()[0].instanceCount);
+        EXPECT_EQ(1024, queue.getBatches()[1].key.atlasPageSize);
+        EXPECT_EQ(1, queue.getBatches()[1].instanceCount);
+    }
+
+    TEST_F(Text_TextBatchQueueTest, NormalCase_ClearAndEmptyBlocks) {
+        TextBatchQueue queue;
+        queue.add(createKey(1, 1), glm::vec2(0.0f), std::vector<GlyphInstance> {});
+        EXPECT_TRUE(queue.empty());
+
+        queue.add(createKey(1, 1), glm::vec2(0.0f), createInstances(0, 2));
+        queue.build();
+        EXPECT_EQ(1, queue.getBatches().size());
+
+        queue.clear();
+        EXPECT_TRUE(queue.empty());
+        EXPECT_TRUE(queue.getBatches().empty());
+        EXPECT_TRUE(queue.getInstances().empty());
+    }
+}
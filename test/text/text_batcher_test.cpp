@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <fuji/core/internal/utility/frame_ring.hpp>
+#include <fuji/core/internal/utility/memory_allocator.hpp>
+#include <fuji/text/text_batcher.hpp>
+
+#include "device_fixture.hpp"
+
+using namespace fuji::core::utility;
+using namespace fuji::text;
+
+namespace {
+    class Text_TextBatcherTest : public fuji::test::DeviceFixture {
+    protected:
+        void SetUp() override {
+            DeviceFixture::SetUp();
+            this->frameRing = std::make_unique<FrameRing>(this->device.get(), 0, 2);
+
+            vk::CommandPoolCreateInfo poolInfo {};
+            poolInfo.queueFamilyIndex = 0;
+            this->commandPool = this->device->createCommandPoolUnique(poolInfo);
+            vk::CommandBufferAllocateInfo allocInfo { this->commandPool.get(), vk::CommandBufferLevel::ePrimary, 1 };
+            this->commandBuffer = std::move(this->device->allocateCommandBuffersUnique(allocInfo)[0]);
+        }
+        void TearDown() override {
+            commandBuffer.reset();
+            commandPool.reset();
+            frameRing.reset();
+            DeviceFixture::TearDown();
+        }
+
+        vk::PhysicalDeviceFeatures getEnabledFeatures() override {
+            this->firstInstanceSupported = TextBatcher::isFirstInstanceSupported(this->physicalDevice);
+            vk::PhysicalDeviceFeatures features {};
+            features.drawIndirectFirstInstance = this->firstInstanceSupported;
+            return features;
+        }
+
+        static TextBatchKey createKey(std::uintptr_t pipeline, std::int32_t order = 0) {
+            TextBatchKey key {};
+            key.order = order;
+            key.pipeline = vk::Pipeline { reinterpret_cast<VkPipeline>(pipeline) };
+            return key;
+        }
+
+        // the draws are recorded into a command buffer that is never submitted; the frame itself only retires the rings
+        std::vector<TextBatchKey> record(TextBatcher& batcher) {
+            std::vector<TextBatchKey> boundKeys;
+            this->commandBuffer->begin(vk::CommandBufferBeginInfo { vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+            batcher.record(*this->commandBuffer, [&boundKeys](vk::CommandBuffer&, const TextBatchKey& key) { boundKeys.push_back(key); });
+            this->commandBuffer->end();
+            return boundKeys;
+        }
+    protected:
+        std::unique_ptr<FrameRing> frameRing;
+        vk::UniqueCommandPool commandPool;
+        vk::UniqueCommandBuffer commandBuffer;
+        bool firstInstanceSupported = false;
+    };
+
+    TEST_F(Text_TextBatcherTest, NormalCase_DrawCommandsWithoutFirstInstance) {
+        TextBatcher batcher { *allocator, *frameRing, 64 * sizeof(GlyphInstance), 16 };
+        std::vector<GlyphInstance> instances(3);
+
+        frameRing->acquire();
+        batcher.beginFrame();
+        batcher.add(createKey(2), glm::vec2(0.0f), instances);
+        batcher.add(createKey(1), glm::vec2(0.0f), instances);
+        batcher.add(createKey(1), glm::vec2(0.0f, 10.0f), instances);
+        std::vector<TextBatchKey> boundKeys = record(batcher);
+
+        ASSERT_EQ(2, boundKeys.size());
+        EXPECT_EQ(createKey(1).pipeline, boundKeys[0].pipeline);
+        EXPECT_EQ(createKey(2).pipeline, boundKeys[1].pipeline);
+
+        const std::vector<vk::DrawIndirectCommand>& commands = batcher.getDrawCommands();
+        ASSERT_EQ(2, commands.size());
+        EXPECT_EQ(4, commands[0].vertexCount);
+        EXPECT_EQ(6, commands[0].instanceCount);
+        EXPECT_EQ(0, commands[0].firstInstance);
+        EXPECT_EQ(3, commands[1].instanceCount);
+        EXPECT_EQ(0, commands[1].firstInstance);
+
+        EXPECT_EQ(3, batcher.getStatistics().blockCount);
+        EXPECT_EQ(2, batcher.getStatistics().batchCount);
+        EXPECT_EQ(2, batcher.getStatistics().drawCallCount);
+        EXPECT_EQ(9, batcher.getStatistics().instanceCount);
+        batcher.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+
+    TEST_F(Text_TextBatcherTest, NormalCase_DrawCommandsWithFirstInstance) {
+        if(!firstInstanceSupported) {
+            GTEST_SKIP();
+        }
+        TextBatcher batcher { *allocator, *frameRing, 64 * sizeof(GlyphInstance), 16, true };
+        std::vector<GlyphInstance> instances(3);
+
+        frameRing->acquire();
+        batcher.beginFrame();
+        batcher.add(createKey(1, 0), glm::vec2(0.0f), instances);
+        batcher.add(createKey(1, 1), glm::vec2(0.0f), instances);
+        EXPECT_EQ(2, record(batcher).size());
+
+        const std::vector<vk::DrawIndirectCommand>& commands = batcher.getDrawCommands();
+        ASSERT_EQ(2, commands.size());
+        EXPECT_EQ(0, commands[0].firstInstance);
+        EXPECT_EQ(3, commands[1].firstInstance);
+        batcher.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+
+    TEST_F(Text_TextBatcherTest, AbnormalCase_InstanceBufferTooSmall) {
+        TextBatcher batcher { *allocator, *frameRing, 4 * sizeof(GlyphInstance), 16 };
+        std::vector<GlyphInstance> instances(8);
+
+        frameRing->acquire();
+        batcher.beginFrame();
+        batcher.add(createKey(1), glm::vec2(0.0f), instances);
+        commandBuffer->begin(vk::CommandBufferBeginInfo { vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+        EXPECT_THROW(batcher.record(*commandBuffer, [](vk::CommandBuffer&, const TextBatchKey&) {}), std::runtime_error);
+        commandBuffer->end();
+        batcher.endFrame();
+        frameRing->submit(queue);
+        frameRing->waitIdle();
+    }
+}
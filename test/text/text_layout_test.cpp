@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fuji/text/text_layout.hpp>
+
+using namespace fuji::text;
+
+namespace {
+    class Text_TextLayoutTest : public testing::Test {
+    protected:
+        // every glyph advances 10 except 'W', which advances 30
+        TextLayout::Shape createShaper() {
+            return [this](std::string_view text) {
+                this->shaped.emplace_back(text);
+                auto run = std::make_shared<ShapedRun>();
+                run->advance = 0.0f;
+                for(std::size_t i = 0; i < text.size(); i++) {
+                    float advance = text[i] == 'W' ? 30.0f : 10.0f;
+                    run->glyphs.push_back(ShapedGlyph { static_cast<std::uint8_t>(text[i]), static_cast<std::uint32_t>(i), advance, 0.0f, 0.0f });
+                    run->advance += advance;
+                }
+                return std::shared_ptr<const ShapedRun> { run };
+            };
+        }
+
+        std::vector<std::string> getLineTexts(const TextLayout& layout, std::size_t index) {
+            const ParagraphLayout& paragraph = layout.getParagraph(index);
+            std::vector<std::string> texts;
+            for(auto& line : paragraph.lines) {
+                texts.push_back(paragraph.text.substr(line.textBegin, line.textEnd - line.textBegin));
+            }
+            return texts;
+        }
+    protected:
+        std::vector<std::string> shaped;
+    };
+
+    TEST_F(Text_TextLayoutTest, NormalCase_WrapAtSpaces) {
+        TextLayout layout { createShaper(), 20.0f, 100.0f };
+        layout.setText("the quick brown fox");
+        EXPECT_EQ(1, layout.update());
+
+        std::vector<std::string> expected { "the quick ", "brown fox" };
+        EXPECT_EQ(expected, getLineTexts(layout, 0));
+        EXPECT_FLOAT_EQ(90.0f, layout.getParagraph(0).lines[0].width);
+        EXPECT_FLOAT_EQ(90.0f, layout.getParagraph(0).lines[1].width);
+        EXPECT_EQ(2, layout.getLineCount());
+        EXPECT_FLOAT_EQ(40.0f, layout.getHeight());
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_BreakLongWord) {
+        TextLayout layout { createShaper(), 20.0f, 40.0f };
+        layout.setText("abcdefghij");
+        layout.update();
+
+        std::vector<std::string> expected { "abcd", "efgh", "ij" };
+        EXPECT_EQ(expected, getLineTexts(layout, 0));
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_CarriedOverWordStillOverflows) {
+        TextLayout layout { createShaper(), 20.0f, 40.0f };
+        layout.setText("a bcW");
+        layout.update();
+
+        std::vector<std::string> expected { "a ", "bc", "W" };
+        EXPECT_EQ(expected, getLineTexts(layout, 0));
+        for(auto& line : layout.getParagraph(0).lines) {
+            EXPECT_LE(line.width, 40.0f);
+        }
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_EditReflowsOnlyEditedParagraph) {
+        TextLayout layout { createShaper(), 20.0f, 100.0f };
+        layout.setText("first line\nsecond paragraph here\n\nlast");
+        EXPECT_EQ(4, layout.update());
+        EXPECT_EQ(4, shaped.size());
+        EXPECT_FLOAT_EQ(20.0f, layout.getParagraphTop(1));
+        EXPECT_FLOAT_EQ(80.0f, layout.getParagraphTop(2));
+        EXPECT_FLOAT_EQ(100.0f, layout.getParagraphTop(3));
+        std::uint64_t lastGeneration = layout.getParagraph(3).shapedGeneration;
+
+        layout.setParagraph(0, "first line that now wraps");
+        EXPECT_TRUE(layout.isDirty());
+        EXPECT_EQ(1, layout.update());
+        EXPECT_EQ(5, shaped.size());
+        EXPECT_EQ("first line that now wraps", shaped.back());
+        EXPECT_EQ(3, layout.getParagraph(0).lines.size());
+        EXPECT_FLOAT_EQ(140.0f, layout.getParagraphTop(3));
+        EXPECT_EQ(lastGeneration, layout.getParagraph(3).shapedGeneration);
+        EXPECT_EQ(0, layout.update());
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_AppendAndErase) {
+        TextLayout layout { createShaper(), 10.0f };
+        layout.setText("a\nb");
+        layout.update();
+
+        layout.appendParagraph("c");
+        layout.insertParagraph(0, "z");
+        EXPECT_EQ(2, layout.update());
+        EXPECT_EQ(4, layout.getParagraphCount());
+        EXPECT_EQ("z", layout.getParagraph(0).text);
+        EXPECT_EQ("c", layout.getParagraph(3).text);
+
+        layout.eraseParagraph(1);
+        EXPECT_EQ(0, layout.update());
+        EXPECT_EQ(3, layout.getLineCount());
+        EXPECT_EQ(1, layout.findParagraph(15.0f));
+        EXPECT_EQ(2, layout.findParagraph(29.0f));
+        EXPECT_EQ(2, layout.findParagraph(1000.0f));
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_WidthChangeRebreaksWithoutReshaping) {
+        TextLayout layout { createShaper(), 20.0f, 100.0f };
+        layout.setText("the quick brown fox\njumps");
+        layout.update();
+        ASSERT_EQ(2, shaped.size());
+
+        layout.setWidth(50.0f);
+        EXPECT_EQ(2, layout.update());
+        EXPECT_EQ(2, shaped.size());
+        std::vector<std::string> expected { "the ", "quick ", "brown ", "fox" };
+        EXPECT_EQ(expected, getLineTexts(layout, 0));
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_Alignment) {
+        TextLayout layout { createShaper(), 20.0f, 100.0f, TextAlignment::eRight };
+        layout.setText("abc");
+        layout.update();
+        EXPECT_FLOAT_EQ(70.0f, layout.getParagraph(0).lines[0].x);
+
+        layout.setAlignment(TextAlignment::eCenter);
+        layout.update();
+        EXPECT_FLOAT_EQ(35.0f, layout.getParagraph(0).lines[0].x);
+        EXPECT_EQ(1, shaped.size());
+    }
+
+    TEST_F(Text_TextLayoutTest, NormalCase_EmptyParagraph) {
+        TextLayout layout { createShaper(), 20.0f, 100.0f };
+        layout.setText("");
+        layout.update();
+
+        ASSERT_EQ(1, layout.getParagraph(0).lines.size());
+        EXPECT_EQ(0, layout.getParagraph(0).lines[0].glyphCount);
+        EXPECT_FLOAT_EQ(20.0f, layout.getHeight());
+    }
+
+    TEST_F(Text_TextLayoutTest, AbnormalCase_OutOfRange) {
+        TextLayout layout { createShaper(), 20.0f };
+        layout.setText("a");
+
+        EXPECT_THROW(layout.setParagraph(1, "b"), std::out_of_range);
+        EXPECT_THROW(layout.insertParagraph(2, "b"), std::out_of_range);
+        EXPECT_THROW(layout.eraseParagraph(1), std::out_of_range);
+        EXPECT_THROW(TextLayout(TextLayout::Shape {}, 20.0f), std::invalid_argument);
+    }
+}